@@ -0,0 +1,182 @@
+/**
+ * @fileName	:	bench_interface.h
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for the host benchmark helpers
+ *
+ * Host builds only, the benchmarks run the real SOS on the SIM register file.
+ * Two clocks are reported for every measurement:
+ * 			sim cycles	virtual AVR cycles, SIM_CYCLES_PER_ACCESS per register access
+ * 						plus the cycles charged with sim_consume_cycles, it counts
+ * 						the I/O and critical section work of a path, not its ALU work
+ * 			host ns		wall time of the host running the path and the simulator
+ * The simulator dominates the host time, bench_calibrate measures the host
+ * cost of one register access and of a clock read, the "net" metrics remove
+ * both to leave the host time of the SOS code itself.
+ * Results are written as CSV rows "scenario,kernel,n,dist,param,metric,value",
+ * one value per row so two runs can be compared with diff or joined by key.
+ */
+
+
+#ifndef BENCH_INTERFACE_H_
+#define BENCH_INTERFACE_H_
+
+#include "std.h"
+#include "sos_interface.h"
+
+/* Period distributions of a generated task set */
+typedef enum
+{
+	BENCH_DIST_DUE					= 0	,	/* every task every tick					*/
+	BENCH_DIST_IDLE						,	/* released once, never due again in a run	*/
+	BENCH_DIST_HARMONIC					,	/* 1, 2, 4, 8, 16 ticks						*/
+	BENCH_DIST_RANDOM					,	/* uniform 1 -> 50 ticks					*/
+	BENCH_DIST_TOTAL
+}enu_bench_dist_t_;
+
+/* Priority assignment of a generated task set */
+typedef enum
+{
+	BENCH_PRIO_RM					= 0	,	/* rate monotonic, shorter period higher priority	*/
+	BENCH_PRIO_RANDOM					,	/* random order										*/
+	BENCH_PRIO_TOTAL
+}enu_bench_prio_t_;
+
+/* One generated task, the execution time is simulated with sim_consume_cycles */
+typedef struct
+{
+	f64_t_		f64_utilization;				/* share of the CPU, wcet / period			*/
+	uint32_t_	uint32_wcet_cycles;				/* execution time of every job				*/
+	uint16_t_	uint16_period;					/* ticks									*/
+	uint8_t_	uint8_priority;
+}str_bench_task_spec_t_;
+
+
+/**
+ *	@brief		                            :	Opens the result file and writes the CSV header
+ *  @param[in]      ptr_str_path            :   File path, NULL_PTR writes to stdout
+ *
+ *  @Return     TRUE on success
+ */
+uint8_t_ bench_open(const char * ptr_str_path);
+
+/**
+ *	@brief		                            :	Writes one result row
+ *  @param[in]      ptr_str_scenario        :   Benchmark name
+ *  @param[in]      uint8_n                 :   Task count or size swept
+ *  @param[in]      ptr_str_dist            :   Period distribution or "-"
+ *  @param[in]      ptr_str_param           :   Operation or parameter or "-"
+ *  @param[in]      ptr_str_metric          :   Metric name with its unit
+ *  @param[in]      f64_value               :   Value
+ */
+void bench_emit(const char * ptr_str_scenario, uint8_t_ uint8_n, const char * ptr_str_dist,
+				const char * ptr_str_param, const char * ptr_str_metric, f64_t_ f64_value);
+
+/**
+ *	@brief		                            :	Flushes and closes the result file
+ */
+void bench_close(void);
+
+/**
+ *	@brief		                            :	Gets the host monotonic time
+ *
+ *  @Return     Nanoseconds
+ */
+uint64_t_ bench_host_ns(void);
+
+/**
+ *	@brief		                            :	Gets the simulated time the MCU was not idle
+ *
+ *  @Return     CPU cycles since the last bench_sos_start
+ */
+uint64_t_ bench_busy_cycles(void);
+
+/**
+ *	@brief		                            :	Measures the host cost of a simulated register access and of a
+ *	                                            bench_host_ns pair, writes both as "calibration" rows.
+ *	                                            Call after bench_sos_start
+ */
+void bench_calibrate(void);
+
+/**
+ *	@brief		                            :	Removes the simulator and clock cost from a measured host time
+ *  @param[in]      uint64_ns               :   Measured host time
+ *  @param[in]      uint64_cycles           :   Simulated cycles of the same code (register accesses)
+ *
+ *  @Return     Host nanoseconds of the SOS code, 0 at least
+ */
+f64_t_ bench_net_ns(uint64_t_ uint64_ns, uint64_t_ uint64_cycles);
+
+/**
+ *	@brief		                            :	Seeds the benchmark random generator (xorshift32), same seed same run
+ *  @param[in]      uint32_seed             :   Seed, 0 is replaced by 1
+ */
+void bench_seed(uint32_t_ uint32_seed);
+
+/**
+ *	@brief		                            :	Gets a random number in a range
+ *  @param[in]      uint32_min              :   Lowest value
+ *  @param[in]      uint32_max              :   Highest value
+ *
+ *  @Return     uint32_min -> uint32_max
+ */
+uint32_t_ bench_random(uint32_t_ uint32_min, uint32_t_ uint32_max);
+
+/**
+ *	@brief		                            :	Gets a task period from a distribution
+ *  @param[in]      enu_dist                :   Distribution
+ *  @param[in]      uint8_index             :   Task index in the set
+ *
+ *  @Return     Period in ticks
+ */
+uint16_t_ bench_period(enu_bench_dist_t_ enu_dist, uint8_t_ uint8_index);
+
+/**
+ *	@brief		                            :	Generates a task set with a total utilization, UUniFast splits the
+ *	                                            utilization uniformly over the tasks
+ *  @param[out]     arr_str_specs           :   uint8_n task specs
+ *  @param[in]      uint8_n                 :   Task count
+ *  @param[in]      f64_utilization         :   Total utilization, 1.0 is a fully loaded CPU
+ *  @param[in]      enu_dist                :   BENCH_DIST_HARMONIC or BENCH_DIST_RANDOM periods
+ *  @param[in]      enu_prio                :   Priority assignment
+ *  @param[in]      uint8_first_priority    :   Priority of the highest priority task, the others follow
+ */
+void bench_generate_taskset(str_bench_task_spec_t_ * arr_str_specs, uint8_t_ uint8_n, f64_t_ f64_utilization,
+							enu_bench_dist_t_ enu_dist, enu_bench_prio_t_ enu_prio, uint8_t_ uint8_first_priority);
+
+/**
+ *	@brief		                            :	Gets the name of a distribution for the result rows
+ */
+const char * bench_dist_name(enu_bench_dist_t_ enu_dist);
+
+/**
+ *	@brief		                            :	Gets the name of a priority assignment for the result rows
+ */
+const char * bench_prio_name(enu_bench_prio_t_ enu_prio);
+
+/**
+ *	@brief		                            :	Gets the name of the configured SOS kernel for the result rows
+ */
+const char * bench_kernel_name(void);
+
+/**
+ *	@brief		                            :	Resets the simulator, initializes SOS and the high resolution timers
+ *	                                            (TIMER_1 1 us counter) and enables the interrupts
+ *
+ *  @Return     TRUE on success
+ */
+uint8_t_ bench_sos_start(void);
+
+/**
+ *	@brief		                            :	Runs sos_run for a number of system ticks of virtual time, then
+ *	                                            stops the scheduler and returns
+ *  @param[in]      uint32_ticks            :   Ticks to run
+ */
+void bench_sos_run_ticks(uint32_t_ uint32_ticks);
+
+/**
+ *	@brief		                            :	Removes every task, sos_deinit
+ */
+void bench_sos_stop(void);
+
+#endif /* BENCH_INTERFACE_H_ */
@@ -0,0 +1,322 @@
+/**
+ * @fileName	:	bench_program.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Host benchmark helpers, result file, clocks and a simulated SOS run
+ */
+
+#define _POSIX_C_SOURCE		199309L		/* clock_gettime */
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "bench_interface.h"
+#include "sim_interface.h"
+#include "sim_cfg.h"
+#include "hrt_interface.h"
+#include "interrupts.h"
+#include "registers.h"
+
+#define BENCH_RANDOM_MAX_PERIOD			50
+#define BENCH_IDLE_PERIOD				60000
+#define BENCH_CALIBRATION_LOOPS			100000UL
+#define BENCH_SREG						0x5F
+#define BENCH_HARMONIC_PERIODS			5			/* 1 -> 16 ticks, bench_period */
+#define BENCH_UNIFORM_RESOLUTION		0x1000000UL
+#define BENCH_CYCLES_PER_TICK			((SIM_CPU_FREQ_HZ / 1000UL) * SOS_SYS_TICK_TIME_MS)
+
+static void bench_end_run(void);
+
+static FILE *		gl_ptr_bench_file	= NULL_PTR;
+static INSTANCE uint32_t_	gl_uint32_bench_seed = 1;
+static INSTANCE f64_t_	gl_f64_bench_access_ns = 0.0;
+static INSTANCE f64_t_	gl_f64_bench_clock_ns = 0.0;
+
+static const char * const gl_arr_ptr_bench_dist_names[BENCH_DIST_TOTAL] =
+{
+		"due", "idle", "harmonic", "random"
+};
+
+static const char * const gl_arr_ptr_bench_prio_names[BENCH_PRIO_TOTAL] =
+{
+		"rm", "random"
+};
+
+
+uint8_t_ bench_open(const char * ptr_str_path)
+{
+	uint8_t_ bool_retval = TRUE;
+
+	gl_ptr_bench_file = (NULL_PTR != ptr_str_path) ? fopen(ptr_str_path, "w") : stdout;
+
+	if(NULL_PTR == gl_ptr_bench_file)
+	{
+		bool_retval = FALSE;
+	}
+	else
+	{
+		fprintf(gl_ptr_bench_file, "scenario,kernel,n,dist,param,metric,value\n");
+	}
+
+	return bool_retval;
+}
+
+void bench_emit(const char * ptr_str_scenario, uint8_t_ uint8_n, const char * ptr_str_dist,
+				const char * ptr_str_param, const char * ptr_str_metric, f64_t_ f64_value)
+{
+	if(NULL_PTR != gl_ptr_bench_file)
+	{
+		fprintf(gl_ptr_bench_file, "%s,%s,%u,%s,%s,%s,%.3f\n", ptr_str_scenario, bench_kernel_name(), uint8_n,
+				ptr_str_dist, ptr_str_param, ptr_str_metric, f64_value);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void bench_close(void)
+{
+	if(
+			(NULL_PTR != gl_ptr_bench_file) &&
+			(stdout != gl_ptr_bench_file)
+			)
+	{
+		fclose(gl_ptr_bench_file);
+	}
+	else if(NULL_PTR != gl_ptr_bench_file)
+	{
+		fflush(gl_ptr_bench_file);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	gl_ptr_bench_file = NULL_PTR;
+}
+
+uint64_t_ bench_host_ns(void)
+{
+	struct timespec str_now;
+
+	clock_gettime(CLOCK_MONOTONIC, &str_now);
+
+	return ((uint64_t_)str_now.tv_sec * 1000000000ULL) + (uint64_t_)str_now.tv_nsec;
+}
+
+uint64_t_ bench_busy_cycles(void)
+{
+	return sim_get_cycles() - sim_get_idle_cycles();
+}
+
+void bench_calibrate(void)
+{
+	volatile uint8_t_ uint8_sink;
+	uint64_t_ uint64_ns;
+	uint64_t_ uint64_clock_ns = 0;
+
+	uint64_ns = bench_host_ns();
+	for(uint32_t_ uint32_loop = 0; uint32_loop < BENCH_CALIBRATION_LOOPS; uint32_loop++)
+	{
+		uint8_sink = REG8(BENCH_SREG);
+	}
+	gl_f64_bench_access_ns = (f64_t_)(bench_host_ns() - uint64_ns) / BENCH_CALIBRATION_LOOPS;
+	(void)uint8_sink;
+
+	for(uint32_t_ uint32_loop = 0; uint32_loop < BENCH_CALIBRATION_LOOPS; uint32_loop++)
+	{
+		uint64_ns = bench_host_ns();
+		uint64_clock_ns += bench_host_ns() - uint64_ns;
+	}
+	gl_f64_bench_clock_ns = (f64_t_)uint64_clock_ns / BENCH_CALIBRATION_LOOPS;
+
+	bench_emit("calibration", 0, "-", "-", "access_ns", gl_f64_bench_access_ns);
+	bench_emit("calibration", 0, "-", "-", "clock_ns", gl_f64_bench_clock_ns);
+}
+
+f64_t_ bench_net_ns(uint64_t_ uint64_ns, uint64_t_ uint64_cycles)
+{
+	f64_t_ f64_net = (f64_t_)uint64_ns - gl_f64_bench_clock_ns -
+					 ((f64_t_)uint64_cycles / SIM_CYCLES_PER_ACCESS) * gl_f64_bench_access_ns;
+
+	return (f64_net > 0.0) ? f64_net : 0.0;
+}
+
+void bench_seed(uint32_t_ uint32_seed)
+{
+	gl_uint32_bench_seed = (0 != uint32_seed) ? uint32_seed : 1;
+}
+
+uint32_t_ bench_random(uint32_t_ uint32_min, uint32_t_ uint32_max)
+{
+	gl_uint32_bench_seed ^= gl_uint32_bench_seed << 13;
+	gl_uint32_bench_seed ^= gl_uint32_bench_seed >> 17;
+	gl_uint32_bench_seed ^= gl_uint32_bench_seed << 5;
+
+	return uint32_min + (gl_uint32_bench_seed % (uint32_max - uint32_min + 1));
+}
+
+uint16_t_ bench_period(enu_bench_dist_t_ enu_dist, uint8_t_ uint8_index)
+{
+	uint16_t_ uint16_period;
+
+	switch(enu_dist)
+	{
+		case BENCH_DIST_DUE:
+			uint16_period = 1;
+			break;
+
+		case BENCH_DIST_IDLE:
+			uint16_period = BENCH_IDLE_PERIOD;
+			break;
+
+		case BENCH_DIST_HARMONIC:
+			uint16_period = (uint16_t_)(1 << (uint8_index % 5));
+			break;
+
+		default:
+			uint16_period = (uint16_t_)bench_random(1, BENCH_RANDOM_MAX_PERIOD);
+			break;
+	}
+
+	return uint16_period;
+}
+
+void bench_generate_taskset(str_bench_task_spec_t_ * arr_str_specs, uint8_t_ uint8_n, f64_t_ f64_utilization,
+							enu_bench_dist_t_ enu_dist, enu_bench_prio_t_ enu_prio, uint8_t_ uint8_first_priority)
+{
+	f64_t_ f64_sum = f64_utilization;
+	f64_t_ f64_next;
+	f64_t_ f64_uniform;
+	uint8_t_ uint8_rank;
+	uint8_t_ uint8_swap;
+	uint8_t_ uint8_other;
+
+	/* UUniFast, Bini and Buttazzo */
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		if(uint8_index < (uint8_n - 1))
+		{
+			f64_uniform	= (f64_t_)bench_random(1, BENCH_UNIFORM_RESOLUTION - 1) / BENCH_UNIFORM_RESOLUTION;
+			f64_next	= f64_sum * pow(f64_uniform, 1.0 / (f64_t_)(uint8_n - 1 - uint8_index));
+		}
+		else
+		{
+			f64_next	= 0.0;
+		}
+		arr_str_specs[uint8_index].f64_utilization	= f64_sum - f64_next;
+		f64_sum										= f64_next;
+
+		arr_str_specs[uint8_index].uint16_period	= (BENCH_DIST_HARMONIC == enu_dist) ?
+				bench_period(BENCH_DIST_HARMONIC, (uint8_t_)bench_random(0, BENCH_HARMONIC_PERIODS - 1)) :
+				bench_period(enu_dist, uint8_index);
+		arr_str_specs[uint8_index].uint32_wcet_cycles = (uint32_t_)(arr_str_specs[uint8_index].f64_utilization *
+				arr_str_specs[uint8_index].uint16_period * BENCH_CYCLES_PER_TICK + 0.5);
+	}
+
+	if(BENCH_PRIO_RM == enu_prio)
+	{
+		/* rank by period, equal periods keep the generation order */
+		for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+		{
+			uint8_rank = 0;
+			for(uint8_other = 0; uint8_other < uint8_n; uint8_other++)
+			{
+				if(
+						(arr_str_specs[uint8_other].uint16_period < arr_str_specs[uint8_index].uint16_period) ||
+						(
+								(arr_str_specs[uint8_other].uint16_period == arr_str_specs[uint8_index].uint16_period) &&
+								(uint8_other < uint8_index)
+								)
+						)
+				{
+					uint8_rank++;
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+			}
+			arr_str_specs[uint8_index].uint8_priority = uint8_first_priority + uint8_rank;
+		}
+	}
+	else
+	{
+		/* Fisher-Yates shuffle of the ranks */
+		for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+		{
+			arr_str_specs[uint8_index].uint8_priority = uint8_first_priority + uint8_index;
+		}
+		for(uint8_t_ uint8_index = uint8_n; uint8_index > 1; uint8_index--)
+		{
+			uint8_other = (uint8_t_)bench_random(0, uint8_index - 1);
+			uint8_swap	= arr_str_specs[uint8_index - 1].uint8_priority;
+			arr_str_specs[uint8_index - 1].uint8_priority	= arr_str_specs[uint8_other].uint8_priority;
+			arr_str_specs[uint8_other].uint8_priority		= uint8_swap;
+		}
+	}
+}
+
+const char * bench_dist_name(enu_bench_dist_t_ enu_dist)
+{
+	return (BENCH_DIST_TOTAL > enu_dist) ? gl_arr_ptr_bench_dist_names[enu_dist] : "-";
+}
+
+const char * bench_prio_name(enu_bench_prio_t_ enu_prio)
+{
+	return (BENCH_PRIO_TOTAL > enu_prio) ? gl_arr_ptr_bench_prio_names[enu_prio] : "-";
+}
+
+const char * bench_kernel_name(void)
+{
+	return (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE) ? "preemptive" : "cooperative";
+}
+
+uint8_t_ bench_sos_start(void)
+{
+	uint8_t_ bool_retval = FALSE;
+
+	sim_init();
+	sim_set_end(0, NULL_PTR);
+
+	if(
+			(SOS_STATUS_SUCCESS == sos_init()) &&
+			(HRT_STATUS_SUCCESS == hrt_init())
+			)
+	{
+		sei();
+		bool_retval = TRUE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return bool_retval;
+}
+
+void bench_sos_run_ticks(uint32_t_ uint32_ticks)
+{
+	uint32_t_ uint32_now_ms = (uint32_t_)(sim_get_cycles() / (SIM_CPU_FREQ_HZ / 1000UL));
+
+	sim_set_end(uint32_now_ms + SOS_TICKS_TO_MS(uint32_ticks), bench_end_run);
+	sos_run();
+	sim_set_end(0, NULL_PTR);
+}
+
+void bench_sos_stop(void)
+{
+	sos_deinit();
+}
+
+/**
+ * @brief a private function called by the simulator at the end of a timed
+ *		  run, sos_run returns after its current pass
+ *
+ * @return
+ */
+static void bench_end_run(void)
+{
+	sos_disable();
+}
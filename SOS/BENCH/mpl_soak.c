@@ -0,0 +1,309 @@
+/**
+ * @fileName	:	mpl_soak.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Alloc/free soak test of the fixed-block memory pools
+ *
+ * usage: mpl_soak [results.csv] [rounds] [seed]
+ *
+ * Random alloc and free operations on a private pool, alloc while nothing is
+ * held, free while everything is. Every held block carries a unique tag over
+ * its whole size, a block handed out twice is overwritten by its other owner.
+ * Every free is tried a second time and must be refused (MPL_STATUS_DOUBLE_FREE).
+ * At the end everything is given back and the whole pool must be allocatable
+ * in one go (no leak, no fragmentation).
+ * Rows, n is the block count:
+ * 			ops					alloc/free operations done
+ * 			errors				0, lost/overlapping blocks, wrong counts or
+ * 								statuses (exit code 1)
+ * 			alloc/free			per call, means:
+ * 								host_ns			host time of the call and of the
+ * 												simulator under it
+ * 								net_ns			host_ns without the simulated
+ * 												accesses and the clock reads, the
+ * 												free list and free map work
+ * 								access_cycles	sim cycles of the register accesses,
+ * 												the critical section only, the same
+ * 												whatever the pool does inside it
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_interface.h"
+#include "sim_interface.h"
+#include "mpl_interface.h"
+
+#define SOAK_DEFAULT_SEED				0x5EEDu
+#define SOAK_DEFAULT_ROUNDS				100000UL
+#define SOAK_BLOCK_SIZE					8
+#define SOAK_BLOCK_COUNT				16
+#define SOAK_TAG_FREE					0x00
+
+static void			soak_free				(uint8_t_ uint8_index);
+static void			soak_alloc				(void);
+static void			soak_error				(const char * ptr_str_what);
+
+static void *			gl_arr_soak_storage[MPL_STORAGE_WORDS(SOAK_BLOCK_SIZE, SOAK_BLOCK_COUNT)];
+static str_mpl_pool_t_	gl_str_soak_pool;
+static uint8_t_ *		gl_arr_ptr_uint8_soak_held[SOAK_BLOCK_COUNT];
+static uint8_t_			gl_uint8_soak_held = 0;
+static uint8_t_			gl_uint8_soak_tag = SOAK_TAG_FREE;
+static uint32_t_		gl_uint32_soak_errors = 0;
+
+static uint64_t_		gl_uint64_soak_alloc_cycles = 0;
+static uint64_t_		gl_uint64_soak_alloc_ns = 0;
+static f64_t_			gl_f64_soak_alloc_net_ns = 0.0;
+static uint32_t_		gl_uint32_soak_allocs = 0;
+static uint64_t_		gl_uint64_soak_free_cycles = 0;
+static uint64_t_		gl_uint64_soak_free_ns = 0;
+static f64_t_			gl_f64_soak_free_net_ns = 0.0;
+static uint32_t_		gl_uint32_soak_frees = 0;
+
+
+int main(int argc, char * argv[])
+{
+	uint32_t_ uint32_rounds = (argc > 2) ? (uint32_t_)strtoul(argv[2], NULL_PTR, 0) : SOAK_DEFAULT_ROUNDS;
+	uint32_t_ uint32_seed = (argc > 3) ? (uint32_t_)strtoul(argv[3], NULL_PTR, 0) : SOAK_DEFAULT_SEED;
+	void * ptr_block;
+
+	if(FALSE == bench_open((argc > 1) ? argv[1] : NULL_PTR))
+	{
+		fprintf(stderr, "mpl_soak: can not open %s\n", argv[1]);
+		return 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* the pool calls only touch SREG, the sim clock moves at every critical section */
+	sim_init();
+	bench_calibrate();
+	bench_seed(uint32_seed);
+
+	if(MPL_STATUS_SUCCESS != mpl_init(&gl_str_soak_pool, gl_arr_soak_storage, SOAK_BLOCK_SIZE, SOAK_BLOCK_COUNT))
+	{
+		soak_error("mpl_init");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint32_t_ uint32_round = 0; uint32_round < uint32_rounds; uint32_round++)
+	{
+		if(
+				(0 == gl_uint8_soak_held) ||
+				((SOAK_BLOCK_COUNT != gl_uint8_soak_held) && (0 != bench_random(0, 1)))
+				)
+		{
+			soak_alloc();
+		}
+		else
+		{
+			soak_free((uint8_t_)bench_random(0, gl_uint8_soak_held - 1));
+		}
+
+		if((SOAK_BLOCK_COUNT - gl_uint8_soak_held) != gl_str_soak_pool.uint8_free_count)
+		{
+			soak_error("free count");
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	/* give everything back, then the whole pool must be allocatable in one go */
+	while(0 != gl_uint8_soak_held)
+	{
+		soak_free(gl_uint8_soak_held - 1);
+	}
+	for(uint8_t_ uint8_index = 0; uint8_index < SOAK_BLOCK_COUNT; uint8_index++)
+	{
+		if(MPL_STATUS_SUCCESS != mpl_alloc(&gl_str_soak_pool, &ptr_block))
+		{
+			soak_error("full pool alloc");
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	if(MPL_STATUS_EMPTY != mpl_alloc(&gl_str_soak_pool, &ptr_block))
+	{
+		soak_error("alloc past the pool");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_emit("mpl_soak", SOAK_BLOCK_COUNT, "-", "-", "ops", (f64_t_)uint32_rounds);
+	bench_emit("mpl_soak", SOAK_BLOCK_COUNT, "-", "-", "errors", (f64_t_)gl_uint32_soak_errors);
+	if(0 != gl_uint32_soak_allocs)
+	{
+		bench_emit("mpl_soak", SOAK_BLOCK_COUNT, "-", "alloc", "host_ns", (f64_t_)gl_uint64_soak_alloc_ns / gl_uint32_soak_allocs);
+		bench_emit("mpl_soak", SOAK_BLOCK_COUNT, "-", "alloc", "net_ns", gl_f64_soak_alloc_net_ns / gl_uint32_soak_allocs);
+		bench_emit("mpl_soak", SOAK_BLOCK_COUNT, "-", "alloc", "access_cycles", (f64_t_)gl_uint64_soak_alloc_cycles / gl_uint32_soak_allocs);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	if(0 != gl_uint32_soak_frees)
+	{
+		bench_emit("mpl_soak", SOAK_BLOCK_COUNT, "-", "free", "host_ns", (f64_t_)gl_uint64_soak_free_ns / gl_uint32_soak_frees);
+		bench_emit("mpl_soak", SOAK_BLOCK_COUNT, "-", "free", "net_ns", gl_f64_soak_free_net_ns / gl_uint32_soak_frees);
+		bench_emit("mpl_soak", SOAK_BLOCK_COUNT, "-", "free", "access_cycles", (f64_t_)gl_uint64_soak_free_cycles / gl_uint32_soak_frees);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	bench_close();
+
+	return (0 == gl_uint32_soak_errors) ? 0 : 1;
+}
+
+/**
+ * @brief a private function to take a block, tag it and hold it
+ *
+ * @return
+ */
+static void soak_alloc(void)
+{
+	uint64_t_ uint64_ns = bench_host_ns();
+	uint64_t_ uint64_cycles = sim_get_cycles();
+	enu_mpl_status_t_ enu_status;
+	void * ptr_block;
+
+	enu_status = mpl_alloc(&gl_str_soak_pool, &ptr_block);
+	uint64_ns = bench_host_ns() - uint64_ns;
+	uint64_cycles = sim_get_cycles() - uint64_cycles;
+
+	if(MPL_STATUS_SUCCESS != enu_status)
+	{
+		soak_error("alloc");
+		return;
+	}
+	else
+	{
+		gl_uint64_soak_alloc_cycles += uint64_cycles;
+		gl_uint64_soak_alloc_ns += uint64_ns;
+		gl_f64_soak_alloc_net_ns += bench_net_ns(uint64_ns, uint64_cycles);
+		gl_uint32_soak_allocs++;
+	}
+
+	/* every held block carries a unique tag over its whole size */
+	gl_uint8_soak_tag = (uint8_t_)(gl_uint8_soak_tag + 1);
+	if(SOAK_TAG_FREE == gl_uint8_soak_tag)
+	{
+		gl_uint8_soak_tag = 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	for(uint8_t_ uint8_byte = 0; uint8_byte < SOAK_BLOCK_SIZE; uint8_byte++)
+	{
+		((uint8_t_ *)ptr_block)[uint8_byte] = gl_uint8_soak_tag;
+	}
+	gl_arr_ptr_uint8_soak_held[gl_uint8_soak_held] = (uint8_t_ *)ptr_block;
+	gl_uint8_soak_held++;
+}
+
+/**
+ * @brief a private function to check a held block and give it back, twice,
+ *		  the second free must be refused
+ *
+ * @param uint8_index : index in the held blocks
+ *
+ * @return
+ */
+static void soak_free(uint8_t_ uint8_index)
+{
+	uint8_t_ * ptr_uint8_block = gl_arr_ptr_uint8_soak_held[uint8_index];
+	enu_mpl_status_t_ enu_status;
+	uint64_t_ uint64_cycles;
+	uint64_t_ uint64_ns;
+
+	/* a block handed out twice has been overwritten by its other owner */
+	for(uint8_t_ uint8_byte = 1; uint8_byte < SOAK_BLOCK_SIZE; uint8_byte++)
+	{
+		if(ptr_uint8_block[uint8_byte] != ptr_uint8_block[0])
+		{
+			soak_error("block overwritten");
+			break;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	for(uint8_t_ uint8_other = 0; uint8_other < gl_uint8_soak_held; uint8_other++)
+	{
+		if(
+				(uint8_other != uint8_index) &&
+				(gl_arr_ptr_uint8_soak_held[uint8_other] == ptr_uint8_block)
+				)
+		{
+			soak_error("block held twice");
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	gl_uint8_soak_held--;
+	gl_arr_ptr_uint8_soak_held[uint8_index] = gl_arr_ptr_uint8_soak_held[gl_uint8_soak_held];
+
+	uint64_ns = bench_host_ns();
+	uint64_cycles = sim_get_cycles();
+	enu_status = mpl_free(&gl_str_soak_pool, ptr_uint8_block);
+	uint64_ns = bench_host_ns() - uint64_ns;
+	uint64_cycles = sim_get_cycles() - uint64_cycles;
+
+	if(MPL_STATUS_SUCCESS != enu_status)
+	{
+		soak_error("free");
+	}
+	else
+	{
+		gl_uint64_soak_free_cycles += uint64_cycles;
+		gl_uint64_soak_free_ns += uint64_ns;
+		gl_f64_soak_free_net_ns += bench_net_ns(uint64_ns, uint64_cycles);
+		gl_uint32_soak_frees++;
+	}
+
+	if(MPL_STATUS_DOUBLE_FREE != mpl_free(&gl_str_soak_pool, ptr_uint8_block))
+	{
+		soak_error("double free not refused");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to count an error, the first one is printed
+ *
+ * @param ptr_str_what : failed check
+ *
+ * @return
+ */
+static void soak_error(const char * ptr_str_what)
+{
+	if(0 == gl_uint32_soak_errors)
+	{
+		fprintf(stderr, "mpl_soak: %s, %u blocks held\n", ptr_str_what, gl_uint8_soak_held);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	gl_uint32_soak_errors++;
+}
@@ -0,0 +1,1001 @@
+/**
+ * @fileName	:	sos_bench.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Scheduler micro-benchmarks on the host simulator
+ *
+ * usage: sos_bench [results.csv]
+ *
+ * 			api			create/modify/delete cost for 1 -> SOS_NUMBER_OF_TASKS tasks
+ * 						and every period distribution
+ * 			tick		cost of a system tick with N tasks of every distribution,
+ * 						"due" is N due tasks, "idle" is N tasks not due, the host
+ * 						ns rows carry the scaling in N, the sim access cycles are
+ * 						the register traffic of the tick only, the scheduler code
+ * 						between the accesses is not charged
+ * 			chain		end to end latency of a chain of stages (sos_chain_tasks)
+ * 			hrt			firing error of the high resolution timers per delay
+ * 			dwq			deferred work post and drain cost per queued item
+ * 			critical	enter/exit_critical pair cost, single and nested
+ * 			fairness	mean start offset in the tick of equal priority tasks
+ * 						(round-robin groups)
+ * 			mode		worst mode switch latency in ticks, switches requested
+ * 						by a running task at random ticks, per switch point
+ * 			dispatch	worst dispatch latency of the highest priority task behind
+ * 						a long low priority job, 1 us resolution, the
+ * 						sos_bench_preemptive build gives the same rows for the
+ * 						preemptive kernel, context switch included
+ * 			isr			longest time the interrupts stay masked with an INT0 call
+ * 						back of growing work run in its ISR (immediate) or moved
+ * 						to the deferred work queue (deferred)
+ * 			delay		a task returning its next activation delay instead of
+ * 						running on its period (5, 45, 1, 3, 20 ticks in turn),
+ * 						jobs run and intervals that differ from the returned delay
+ * Every run uses the same random seed so two builds can be diffed row by row.
+ */
+
+#include <stdio.h>
+
+#include "bench_interface.h"
+#include "sim_interface.h"
+#include "sim_cfg.h"
+#include "hrt_interface.h"
+#include "dwq_interface.h"
+#include "dwq_preconfig.h"
+#include "critical.h"
+#include "exi_interface.h"
+
+#define BENCH_SEED						0x5EEDu
+#define BENCH_API_REPS					200
+#define BENCH_TICKS						2000
+#define BENCH_CHAIN_TICKS				200
+#define BENCH_CHAIN_MAX_STAGES			8
+#define BENCH_HRT_REPS					100
+#define BENCH_DWQ_REPS					1000
+#define BENCH_CRITICAL_REPS				10000
+#define BENCH_FAIRNESS_TICKS			200
+#define BENCH_FAIRNESS_WORK_CYCLES		2000
+#define BENCH_MODE_TICKS				2000
+#define BENCH_MODE_GAP_MIN				33			/* ticks between requests, over two harmonic hyper-periods */
+#define BENCH_MODE_GAP_MAX				64
+#define BENCH_DISPATCH_TICKS			400
+#define BENCH_DISPATCH_LO_PERIOD		4
+#define BENCH_DISPATCH_CHUNK_CYCLES		1000		/* the interrupts are served between chunks */
+#define BENCH_CYCLES_PER_TICK			((SIM_CPU_FREQ_HZ / 1000UL) * SOS_SYS_TICK_TIME_MS)
+#define BENCH_CYCLES_PER_US				(SIM_CPU_FREQ_HZ / 1000000UL)
+#define BENCH_ISR_TICKS					200			/* INT0 rises every other tick */
+#define BENCH_DELAY_TICKS				400
+#define BENCH_DELAY_PERIOD				50			/* never used, every job returns its delay */
+
+/* Min/max/total of one measured operation */
+typedef struct
+{
+	uint64_t_	uint64_total_cycles;
+	uint64_t_	uint64_max_cycles;
+	uint64_t_	uint64_total_ns;
+	f64_t_		f64_total_net_ns;
+	uint32_t_	uint32_count;
+}str_bench_sample_t_;
+
+static void			bench_sample_add		(str_bench_sample_t_ * ptr_str_sample, uint64_t_ uint64_cycles, uint64_t_ uint64_ns);
+static void			bench_sample_emit		(const char * ptr_str_scenario, uint8_t_ uint8_n, const char * ptr_str_dist,
+											 const char * ptr_str_param, const str_bench_sample_t_ * ptr_str_sample);
+static void			bench_make_tasks		(uint8_t_ uint8_n, enu_bench_dist_t_ enu_dist, uint8_t_ bool_same_priority);
+static uint16_t_	bench_task				(void);
+static void			bench_hrt_fired			(void);
+static void			bench_dwq_work			(void);
+static void			bench_api				(uint8_t_ uint8_n, enu_bench_dist_t_ enu_dist);
+static void			bench_tick				(uint8_t_ uint8_n, enu_bench_dist_t_ enu_dist);
+static void			bench_chain				(uint8_t_ uint8_stages, uint32_t_ uint32_work_cycles);
+static void			bench_hrt				(uint16_t_ uint16_delay_us);
+static void			bench_dwq				(uint8_t_ uint8_batch);
+static void			bench_critical			(void);
+static void			bench_fairness			(uint8_t_ uint8_n);
+static uint16_t_	bench_mode_task			(void);
+static void			bench_mode				(uint8_t_ uint8_n, enu_sos_mode_switch_t_ enu_switch_point);
+static uint16_t_	bench_dispatch_lo_task	(void);
+static void			bench_dispatch			(uint16_t_ uint16_lo_work_pct);
+static uint16_t_	bench_isr_pin_task		(void);
+static void			bench_isr_work			(void);
+static void			bench_isr				(enu_exi_cbf_mode_t_ enu_cbf_mode, uint16_t_ uint16_work_us);
+static uint16_t_	bench_delay_task		(void);
+static void			bench_delay				(void);
+
+static str_sos_task_t_		gl_arr_str_bench_tasks[SOS_NUMBER_OF_TASKS];
+static uint32_t_			gl_arr_uint32_bench_work[SOS_NUMBER_OF_TASKS];		/* cycles charged per job */
+static uint32_t_			gl_uint32_bench_jobs = 0;
+
+/* fairness, start offset of each task from the first job of its tick */
+static uint32_t_			gl_uint32_bench_tick_seen = 0;
+static uint64_t_			gl_uint64_bench_tick_base = 0;
+static uint64_t_			gl_arr_uint64_bench_offset[SOS_NUMBER_OF_TASKS];
+static uint32_t_			gl_arr_uint32_bench_starts[SOS_NUMBER_OF_TASKS];
+
+static volatile uint8_t_	gl_uint8_bench_hrt_fired = FALSE;
+
+/* dispatch, work of the low priority job */
+static uint32_t_				gl_uint32_bench_lo_work = 0;
+
+/* isr, work of the INT0 call back */
+static uint32_t_				gl_uint32_bench_isr_work = 0;
+
+/* mode, next request of bench_mode_task */
+static uint32_t_				gl_uint32_bench_mode_next_tick = 0;
+static uint32_t_				gl_uint32_bench_mode_switches = 0;
+static enu_sos_mode_switch_t_	gl_enu_bench_mode_switch_point = SOS_MODE_SWITCH_NEXT_TICK;
+
+/* delay, next activation delays returned by bench_delay_task in turn */
+static const uint16_t_			gl_arr_uint16_bench_delays[] = {5, 45, 1, 3, 20};
+static uint8_t_					gl_uint8_bench_delay_index = 0;		/* delay returned by the last job */
+static uint32_t_				gl_uint32_bench_delay_last_tick = 0;
+static uint32_t_				gl_uint32_bench_delay_jobs = 0;
+static uint32_t_				gl_uint32_bench_delay_errors = 0;
+
+
+int main(int argc, char * argv[])
+{
+	uint8_t_ uint8_n;
+	uint8_t_ uint8_dist;
+	static const uint16_t_ arr_uint16_hrt_delays[] = {10, 20, 50, 100, 200, 500, 1000, 5000, 20000, 60000};
+	static const uint32_t_ arr_uint32_chain_work[] = {0, 2000, 8000};
+	static const uint16_t_ arr_uint16_isr_work_us[] = {0, 50, 200, 1000};
+
+	if(FALSE == bench_open((argc > 1) ? argv[1] : NULL_PTR))
+	{
+		fprintf(stderr, "sos_bench: can not open %s\n", argv[1]);
+		return 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_seed(BENCH_SEED);
+
+	if(TRUE == bench_sos_start())
+	{
+		bench_calibrate();
+		bench_sos_stop();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint8_dist = 0; uint8_dist < BENCH_DIST_TOTAL; uint8_dist++)
+	{
+		for(uint8_n = 1; uint8_n <= SOS_NUMBER_OF_TASKS; uint8_n++)
+		{
+			bench_api(uint8_n, (enu_bench_dist_t_)uint8_dist);
+		}
+	}
+
+	bench_tick(0, BENCH_DIST_DUE);
+	for(uint8_dist = 0; uint8_dist < BENCH_DIST_TOTAL; uint8_dist++)
+	{
+		for(uint8_n = 1; uint8_n <= SOS_NUMBER_OF_TASKS; uint8_n++)
+		{
+			bench_tick(uint8_n, (enu_bench_dist_t_)uint8_dist);
+		}
+	}
+
+	for(uint8_t_ uint8_work = 0; uint8_work < (sizeof(arr_uint32_chain_work) / sizeof(arr_uint32_chain_work[0])); uint8_work++)
+	{
+		for(uint8_n = 2; (uint8_n <= BENCH_CHAIN_MAX_STAGES) && (uint8_n <= SOS_NUMBER_OF_TASKS); uint8_n++)
+		{
+			bench_chain(uint8_n, arr_uint32_chain_work[uint8_work]);
+		}
+	}
+
+	for(uint8_t_ uint8_delay = 0; uint8_delay < (sizeof(arr_uint16_hrt_delays) / sizeof(arr_uint16_hrt_delays[0])); uint8_delay++)
+	{
+		bench_hrt(arr_uint16_hrt_delays[uint8_delay]);
+	}
+
+	bench_dwq(1);
+	bench_dwq(4);
+	bench_dwq(DWQ_QUEUE_SIZE);
+
+	bench_critical();
+
+	for(uint8_n = 2; uint8_n <= SOS_NUMBER_OF_TASKS; uint8_n *= 2)
+	{
+		bench_fairness(uint8_n);
+	}
+
+	for(uint8_n = 2; uint8_n <= SOS_NUMBER_OF_TASKS; uint8_n *= 2)
+	{
+		bench_mode(uint8_n, SOS_MODE_SWITCH_NEXT_TICK);
+		bench_mode(uint8_n, SOS_MODE_SWITCH_HYPER_PERIOD);
+	}
+
+	bench_dispatch(0);
+	bench_dispatch(25);
+	bench_dispatch(75);
+	bench_dispatch(150);
+	bench_dispatch(250);
+
+	for(uint8_t_ uint8_work = 0; uint8_work < (sizeof(arr_uint16_isr_work_us) / sizeof(arr_uint16_isr_work_us[0])); uint8_work++)
+	{
+		bench_isr(EXI_CBF_IMMEDIATE, arr_uint16_isr_work_us[uint8_work]);
+		bench_isr(EXI_CBF_DEFERRED, arr_uint16_isr_work_us[uint8_work]);
+	}
+
+	bench_delay();
+
+	bench_close();
+
+	return 0;
+}
+
+/**
+ * @brief a private function to add one measurement to a sample
+ *
+ * @param ptr_str_sample : sample
+ * @param uint64_cycles  : simulated cycles
+ * @param uint64_ns      : host nanoseconds
+ *
+ * @return
+ */
+static void bench_sample_add(str_bench_sample_t_ * ptr_str_sample, uint64_t_ uint64_cycles, uint64_t_ uint64_ns)
+{
+	ptr_str_sample->uint64_total_cycles += uint64_cycles;
+	ptr_str_sample->uint64_total_ns     += uint64_ns;
+	ptr_str_sample->f64_total_net_ns    += bench_net_ns(uint64_ns, uint64_cycles);
+	ptr_str_sample->uint32_count++;
+	if(uint64_cycles > ptr_str_sample->uint64_max_cycles)
+	{
+		ptr_str_sample->uint64_max_cycles = uint64_cycles;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to write the average/max cycles and the average
+ *		  host time, raw and net, of a sample
+ *
+ * @return
+ */
+static void bench_sample_emit(const char * ptr_str_scenario, uint8_t_ uint8_n, const char * ptr_str_dist,
+							  const char * ptr_str_param, const str_bench_sample_t_ * ptr_str_sample)
+{
+	f64_t_ f64_count = (0 != ptr_str_sample->uint32_count) ? (f64_t_)ptr_str_sample->uint32_count : 1.0;
+
+	bench_emit(ptr_str_scenario, uint8_n, ptr_str_dist, ptr_str_param, "sim_cycles_avg",
+			   (f64_t_)ptr_str_sample->uint64_total_cycles / f64_count);
+	bench_emit(ptr_str_scenario, uint8_n, ptr_str_dist, ptr_str_param, "sim_cycles_max",
+			   (f64_t_)ptr_str_sample->uint64_max_cycles);
+	bench_emit(ptr_str_scenario, uint8_n, ptr_str_dist, ptr_str_param, "host_ns_avg",
+			   (f64_t_)ptr_str_sample->uint64_total_ns / f64_count);
+	bench_emit(ptr_str_scenario, uint8_n, ptr_str_dist, ptr_str_param, "host_net_ns_avg",
+			   ptr_str_sample->f64_total_net_ns / f64_count);
+}
+
+/**
+ * @brief a private function to fill the first tasks of the bench task set,
+ *		  random rate independent priorities unless all are the same
+ *
+ * @return
+ */
+static void bench_make_tasks(uint8_t_ uint8_n, enu_bench_dist_t_ enu_dist, uint8_t_ bool_same_priority)
+{
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		gl_arr_str_bench_tasks[uint8_index] = (str_sos_task_t_){0};
+		gl_arr_str_bench_tasks[uint8_index].uint8_task_priority		= (TRUE == bool_same_priority) ?
+																	  0 : (uint8_t_)bench_random(0, uint8_n - 1);
+		gl_arr_str_bench_tasks[uint8_index].uint16_task_periodicity	= bench_period(enu_dist, uint8_index);
+		gl_arr_str_bench_tasks[uint8_index].ptr_func_task			= bench_task;
+		gl_arr_uint32_bench_work[uint8_index]						= 0;
+	}
+}
+
+/**
+ * @brief a private function, body of every bench task, counts the job,
+ *		  charges its work cycles and records its start offset in the tick
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ bench_task(void)
+{
+	uint8_t_ uint8_index = (uint8_t_)(sos_get_running_task() - gl_arr_str_bench_tasks);
+	uint32_t_ uint32_tick = sos_get_ticks();
+
+	if((uint32_tick != gl_uint32_bench_tick_seen) || (0 == gl_uint64_bench_tick_base))
+	{
+		gl_uint32_bench_tick_seen = uint32_tick;
+		gl_uint64_bench_tick_base = sim_get_cycles();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(SOS_NUMBER_OF_TASKS > uint8_index)
+	{
+		gl_arr_uint64_bench_offset[uint8_index] += sim_get_cycles() - gl_uint64_bench_tick_base;
+		gl_arr_uint32_bench_starts[uint8_index]++;
+		if(0 != gl_arr_uint32_bench_work[uint8_index])
+		{
+			sim_consume_cycles(gl_arr_uint32_bench_work[uint8_index]);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	gl_uint32_bench_jobs++;
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
+
+static void bench_hrt_fired(void)
+{
+	gl_uint8_bench_hrt_fired = TRUE;
+}
+
+static void bench_dwq_work(void)
+{
+	gl_uint32_bench_jobs++;
+}
+
+/**
+ * @brief a private function to time create, then modify (new priority and
+ *		  period), then delete in random order of N tasks
+ *
+ * @return
+ */
+static void bench_api(uint8_t_ uint8_n, enu_bench_dist_t_ enu_dist)
+{
+	str_bench_sample_t_ str_create = {0};
+	str_bench_sample_t_ str_modify = {0};
+	str_bench_sample_t_ str_delete = {0};
+	uint8_t_ arr_uint8_order[SOS_NUMBER_OF_TASKS];
+	uint8_t_ uint8_swap;
+	uint8_t_ uint8_index;
+	uint8_t_ uint8_other;
+	uint64_t_ uint64_cycles;
+	uint64_t_ uint64_ns;
+
+	for(uint16_t_ uint16_rep = 0; uint16_rep < BENCH_API_REPS; uint16_rep++)
+	{
+		if(FALSE == bench_sos_start())
+		{
+			return;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		bench_make_tasks(uint8_n, enu_dist, FALSE);
+
+		for(uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+		{
+			uint64_cycles	= sim_get_cycles();
+			uint64_ns		= bench_host_ns();
+			sos_create_task(&gl_arr_str_bench_tasks[uint8_index]);
+			bench_sample_add(&str_create, sim_get_cycles() - uint64_cycles, bench_host_ns() - uint64_ns);
+		}
+
+		for(uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+		{
+			gl_arr_str_bench_tasks[uint8_index].uint8_task_priority		= (uint8_t_)bench_random(0, uint8_n - 1);
+			gl_arr_str_bench_tasks[uint8_index].uint16_task_periodicity	= bench_period(enu_dist, uint8_index + 1);
+
+			uint64_cycles	= sim_get_cycles();
+			uint64_ns		= bench_host_ns();
+			sos_modify_task(gl_arr_str_bench_tasks[uint8_index].uint8_task_id);
+			bench_sample_add(&str_modify, sim_get_cycles() - uint64_cycles, bench_host_ns() - uint64_ns);
+		}
+
+		for(uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+		{
+			arr_uint8_order[uint8_index] = uint8_index;
+		}
+		for(uint8_index = uint8_n - 1; uint8_index > 0; uint8_index--)
+		{
+			uint8_other = (uint8_t_)bench_random(0, uint8_index);
+			uint8_swap = arr_uint8_order[uint8_index];
+			arr_uint8_order[uint8_index] = arr_uint8_order[uint8_other];
+			arr_uint8_order[uint8_other] = uint8_swap;
+		}
+
+		for(uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+		{
+			uint64_cycles	= sim_get_cycles();
+			uint64_ns		= bench_host_ns();
+			sos_delete_task(gl_arr_str_bench_tasks[arr_uint8_order[uint8_index]].uint8_task_id);
+			bench_sample_add(&str_delete, sim_get_cycles() - uint64_cycles, bench_host_ns() - uint64_ns);
+		}
+
+		bench_sos_stop();
+	}
+
+	bench_sample_emit("api", uint8_n, bench_dist_name(enu_dist), "create", &str_create);
+	bench_sample_emit("api", uint8_n, bench_dist_name(enu_dist), "modify", &str_modify);
+	bench_sample_emit("api", uint8_n, bench_dist_name(enu_dist), "delete", &str_delete);
+}
+
+/**
+ * @brief a private function to measure the busy time per system tick of a
+ *		  run of BENCH_TICKS ticks, the tick ISR, the scheduler pass and the
+ *		  (empty) jobs, n = 0 is the bare tick
+ *
+ * @return
+ */
+static void bench_tick(uint8_t_ uint8_n, enu_bench_dist_t_ enu_dist)
+{
+	uint64_t_ uint64_cycles;
+	uint64_t_ uint64_ns;
+	uint32_t_ uint32_jobs;
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_make_tasks(uint8_n, enu_dist, FALSE);
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		sos_create_task(&gl_arr_str_bench_tasks[uint8_index]);
+	}
+
+	uint64_cycles	= bench_busy_cycles();
+	uint64_ns		= bench_host_ns();
+	uint32_jobs		= gl_uint32_bench_jobs;
+
+	bench_sos_run_ticks(BENCH_TICKS);
+
+	uint64_ns		= bench_host_ns() - uint64_ns;
+	uint64_cycles	= bench_busy_cycles() - uint64_cycles;
+
+	bench_emit("tick", uint8_n, bench_dist_name(enu_dist), "-", "sim_access_cycles_per_tick",
+			   (f64_t_)uint64_cycles / BENCH_TICKS);
+	bench_emit("tick", uint8_n, bench_dist_name(enu_dist), "-", "host_ns_per_tick",
+			   (f64_t_)uint64_ns / BENCH_TICKS);
+	bench_emit("tick", uint8_n, bench_dist_name(enu_dist), "-", "host_net_ns_per_tick",
+			   bench_net_ns(uint64_ns, uint64_cycles) / BENCH_TICKS);
+	bench_emit("tick", uint8_n, bench_dist_name(enu_dist), "-", "jobs_per_tick",
+			   (f64_t_)(gl_uint32_bench_jobs - uint32_jobs) / BENCH_TICKS);
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function to run a linear chain, stage 0 is released every
+ *		  tick and every stage charges the given work, reports the worst end
+ *		  to end latency to the last stage
+ *
+ * @return
+ */
+static void bench_chain(uint8_t_ uint8_stages, uint32_t_ uint32_work_cycles)
+{
+	uint32_t_ uint32_latency_us = 0;
+	char arr_char_param[16];
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* reversed priorities, the chain order has to win over the priority order */
+	bench_make_tasks(uint8_stages, BENCH_DIST_DUE, FALSE);
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_stages; uint8_index++)
+	{
+		gl_arr_str_bench_tasks[uint8_index].uint8_task_priority = (uint8_t_)(uint8_stages - uint8_index);
+		gl_arr_uint32_bench_work[uint8_index] = uint32_work_cycles;
+		sos_create_task(&gl_arr_str_bench_tasks[uint8_index]);
+		if(0 != uint8_index)
+		{
+			sos_chain_tasks(gl_arr_str_bench_tasks[uint8_index - 1].uint8_task_id,
+							gl_arr_str_bench_tasks[uint8_index].uint8_task_id);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	bench_sos_run_ticks(BENCH_CHAIN_TICKS);
+
+	sos_get_chain_latency(gl_arr_str_bench_tasks[uint8_stages - 1].uint8_task_id, &uint32_latency_us);
+	snprintf(arr_char_param, sizeof(arr_char_param), "work%lu", (unsigned long)uint32_work_cycles);
+	bench_emit("chain", uint8_stages, "due", arr_char_param, "latency_us_max", (f64_t_)uint32_latency_us);
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function to start BENCH_HRT_REPS one-shot timers of a delay
+ *		  one after the other and report the firing error
+ *
+ * @return
+ */
+static void bench_hrt(uint16_t_ uint16_delay_us)
+{
+	str_hrt_timer_t_ str_timer = {0};
+	str_hrt_stats_t_ str_stats = {0};
+	char arr_char_param[16];
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint16_t_ uint16_rep = 0; uint16_rep < BENCH_HRT_REPS; uint16_rep++)
+	{
+		gl_uint8_bench_hrt_fired = FALSE;
+		if(HRT_STATUS_SUCCESS != hrt_start(&str_timer, uint16_delay_us, bench_hrt_fired))
+		{
+			break;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		while(FALSE == gl_uint8_bench_hrt_fired)
+		{
+			sim_idle();
+		}
+	}
+
+	hrt_get_stats(&str_stats);
+	snprintf(arr_char_param, sizeof(arr_char_param), "%uus", uint16_delay_us);
+	bench_emit("hrt", 1, "-", arr_char_param, "fired", (f64_t_)str_stats.uint32_fired);
+	bench_emit("hrt", 1, "-", arr_char_param, "error_us_avg",
+			   (0 != str_stats.uint32_fired) ? (f64_t_)str_stats.uint32_total_error_us / str_stats.uint32_fired : 0.0);
+	bench_emit("hrt", 1, "-", arr_char_param, "error_us_max", (f64_t_)str_stats.uint16_max_error_us);
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function to time dwq_post and the drain of a batch of
+ *		  posted items, per item
+ *
+ * @return
+ */
+static void bench_dwq(uint8_t_ uint8_batch)
+{
+	str_bench_sample_t_ str_post = {0};
+	str_bench_sample_t_ str_drain = {0};
+	uint64_t_ uint64_cycles;
+	uint64_t_ uint64_ns;
+	str_critical_t_ lo_str_critical;
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint16_t_ uint16_rep = 0; uint16_rep < BENCH_DWQ_REPS; uint16_rep++)
+	{
+		/* dwq_post is ISR context only, the interrupts are masked like in an ISR */
+		enter_critical(&lo_str_critical, CRITICAL_SITE_APP);
+		for(uint8_t_ uint8_item = 0; uint8_item < uint8_batch; uint8_item++)
+		{
+			uint64_cycles	= sim_get_cycles();
+			uint64_ns		= bench_host_ns();
+			dwq_post(bench_dwq_work);
+			bench_sample_add(&str_post, sim_get_cycles() - uint64_cycles, bench_host_ns() - uint64_ns);
+		}
+		exit_critical(&lo_str_critical);
+
+		uint64_cycles	= sim_get_cycles();
+		uint64_ns		= bench_host_ns();
+		dwq_drain();
+		bench_sample_add(&str_drain, (sim_get_cycles() - uint64_cycles) / uint8_batch, (bench_host_ns() - uint64_ns) / uint8_batch);
+	}
+
+	bench_sample_emit("dwq", uint8_batch, "-", "post", &str_post);
+	bench_sample_emit("dwq", uint8_batch, "-", "drain_per_item", &str_drain);
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function to time an enter/exit_critical pair, alone and
+ *		  nested in another one
+ *
+ * @return
+ */
+static void bench_critical(void)
+{
+	str_bench_sample_t_ str_single = {0};
+	str_bench_sample_t_ str_nested = {0};
+	uint64_t_ uint64_cycles;
+	uint64_t_ uint64_ns;
+	str_critical_t_ lo_str_outer;
+	str_critical_t_ lo_str_inner;
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint16_t_ uint16_rep = 0; uint16_rep < BENCH_CRITICAL_REPS; uint16_rep++)
+	{
+		uint64_cycles	= sim_get_cycles();
+		uint64_ns		= bench_host_ns();
+		enter_critical(&lo_str_outer, CRITICAL_SITE_APP);
+		exit_critical(&lo_str_outer);
+		bench_sample_add(&str_single, sim_get_cycles() - uint64_cycles, bench_host_ns() - uint64_ns);
+
+		enter_critical(&lo_str_outer, CRITICAL_SITE_APP);
+		uint64_cycles	= sim_get_cycles();
+		uint64_ns		= bench_host_ns();
+		enter_critical(&lo_str_inner, CRITICAL_SITE_APP);
+		exit_critical(&lo_str_inner);
+		bench_sample_add(&str_nested, sim_get_cycles() - uint64_cycles, bench_host_ns() - uint64_ns);
+		exit_critical(&lo_str_outer);
+	}
+
+	bench_sample_emit("critical", 1, "-", "single", &str_single);
+	bench_sample_emit("critical", 2, "-", "nested", &str_nested);
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function to run N equal priority tasks due every tick
+ *		  with the same work and report the mean start offset of each one
+ *		  from the first job of the tick, and the spread between them
+ *
+ * @return
+ */
+static void bench_fairness(uint8_t_ uint8_n)
+{
+	f64_t_ f64_offset;
+	f64_t_ f64_min = 0.0;
+	f64_t_ f64_max = 0.0;
+	char arr_char_param[16];
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_make_tasks(uint8_n, BENCH_DIST_DUE, TRUE);
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		gl_arr_uint32_bench_work[uint8_index]	= BENCH_FAIRNESS_WORK_CYCLES;
+		gl_arr_uint64_bench_offset[uint8_index]	= 0;
+		gl_arr_uint32_bench_starts[uint8_index]	= 0;
+		sos_create_task(&gl_arr_str_bench_tasks[uint8_index]);
+	}
+	gl_uint64_bench_tick_base = 0;
+
+	bench_sos_run_ticks(BENCH_FAIRNESS_TICKS);
+
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		f64_offset = (0 != gl_arr_uint32_bench_starts[uint8_index]) ?
+					 (f64_t_)gl_arr_uint64_bench_offset[uint8_index] / gl_arr_uint32_bench_starts[uint8_index] : 0.0;
+		f64_min = ((0 == uint8_index) || (f64_offset < f64_min)) ? f64_offset : f64_min;
+		f64_max = ((0 == uint8_index) || (f64_offset > f64_max)) ? f64_offset : f64_max;
+
+		snprintf(arr_char_param, sizeof(arr_char_param), "task%u", uint8_index);
+		bench_emit("fairness", uint8_n, "due", arr_char_param, "start_offset_cycles_avg", f64_offset);
+	}
+	bench_emit("fairness", uint8_n, "due", "-", "start_offset_spread_cycles", f64_max - f64_min);
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function, bench task 0 of both modes (period 1), requests
+ *		  a switch to the other mode every BENCH_MODE_GAP_MIN -> MAX ticks
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ bench_mode_task(void)
+{
+	uint32_t_ uint32_tick = sos_get_ticks();
+	uint8_t_ uint8_mode_id = 0;
+
+	if(uint32_tick >= gl_uint32_bench_mode_next_tick)
+	{
+		gl_uint32_bench_mode_next_tick = uint32_tick + bench_random(BENCH_MODE_GAP_MIN, BENCH_MODE_GAP_MAX);
+		sos_get_mode(&uint8_mode_id);
+		if(SOS_STATUS_SUCCESS == sos_switch_mode((uint8_t_)(1 - uint8_mode_id), gl_enu_bench_mode_switch_point))
+		{
+			gl_uint32_bench_mode_switches++;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return bench_task();
+}
+
+/**
+ * @brief a private function to switch between two modes of harmonic tasks
+ *		  (hyper-period up to 16 ticks) for BENCH_MODE_TICKS ticks, mode 1 runs
+ *		  the even tasks of mode 0, the odd ones wait while it is active
+ *
+ * @return
+ */
+static void bench_mode(uint8_t_ uint8_n, enu_sos_mode_switch_t_ enu_switch_point)
+{
+	uint32_t_ uint32_latency = 0;
+	const char * ptr_str_param = (SOS_MODE_SWITCH_NEXT_TICK == enu_switch_point) ? "next_tick" : "hyper_period";
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_make_tasks(uint8_n, BENCH_DIST_HARMONIC, FALSE);
+	gl_arr_str_bench_tasks[0].ptr_func_task = bench_mode_task;
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		sos_mode_create_task(0, &gl_arr_str_bench_tasks[uint8_index]);
+		if(0 == (uint8_index % 2))
+		{
+			sos_mode_create_task(1, &gl_arr_str_bench_tasks[uint8_index]);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	gl_uint32_bench_mode_next_tick	= bench_random(1, BENCH_MODE_GAP_MIN);
+	gl_uint32_bench_mode_switches	= 0;
+	gl_enu_bench_mode_switch_point	= enu_switch_point;
+
+	bench_sos_run_ticks(BENCH_MODE_TICKS);
+
+	sos_get_mode_switch_latency(&uint32_latency);
+	bench_emit("mode", uint8_n, "harmonic", ptr_str_param, "switches", (f64_t_)gl_uint32_bench_mode_switches);
+	bench_emit("mode", uint8_n, "harmonic", ptr_str_param, "switch_latency_ticks_max", (f64_t_)uint32_latency);
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function, low priority task of bench_dispatch, charges its
+ *		  work in chunks, sim_consume_cycles serves the interrupts only at the
+ *		  end of a charge
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ bench_dispatch_lo_task(void)
+{
+	uint32_t_ uint32_left = gl_uint32_bench_lo_work;
+	uint32_t_ uint32_chunk;
+
+	while(0 != uint32_left)
+	{
+		uint32_chunk = (uint32_left > BENCH_DISPATCH_CHUNK_CYCLES) ? BENCH_DISPATCH_CHUNK_CYCLES : uint32_left;
+		sim_consume_cycles(uint32_chunk);
+		uint32_left -= uint32_chunk;
+	}
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
+
+/**
+ * @brief a private function to run the highest priority task every tick next
+ *		  to a low priority task released every BENCH_DISPATCH_LO_PERIOD ticks,
+ *		  whose job takes a share of a tick, and report the worst dispatch
+ *		  latency of the first one (sos_get_dispatch_latency). Over 100 % the
+ *		  low priority job spans a tick, the cooperative kernel makes the high
+ *		  priority job wait for it, the preemptive one does not. The kernel
+ *		  times it on TIMER_1 (1 us), the host port charges the AVR context
+ *		  switch (SOS_PORT_SWITCH_CYCLES) to the preemptive rows
+ *
+ * @return
+ */
+static void bench_dispatch(uint16_t_ uint16_lo_work_pct)
+{
+	uint32_t_ uint32_latency_us = 0;
+	char arr_char_param[16];
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_make_tasks(2, BENCH_DIST_DUE, TRUE);
+	gl_arr_str_bench_tasks[1].uint8_task_priority		= 1;
+	gl_arr_str_bench_tasks[1].uint16_task_periodicity	= BENCH_DISPATCH_LO_PERIOD;
+	gl_arr_str_bench_tasks[1].ptr_func_task				= bench_dispatch_lo_task;
+	gl_uint32_bench_lo_work								= (BENCH_CYCLES_PER_TICK * uint16_lo_work_pct) / 100;
+	sos_create_task(&gl_arr_str_bench_tasks[0]);
+	sos_create_task(&gl_arr_str_bench_tasks[1]);
+
+	bench_sos_run_ticks(BENCH_DISPATCH_TICKS);
+
+	sos_get_dispatch_latency(&uint32_latency_us);
+	snprintf(arr_char_param, sizeof(arr_char_param), "lo_work%upct", uint16_lo_work_pct);
+	bench_emit("dispatch", 2, "due", arr_char_param, "latency_us_max", (f64_t_)uint32_latency_us);
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function, toggles the INT0 pin every tick, a rising edge
+ *		  every other tick
+ *
+ * @return
+ */
+static uint16_t_ bench_isr_pin_task(void)
+{
+	static uint8_t_ lo_uint8_level = 0;
+
+	lo_uint8_level ^= 1;
+	sim_set_pin(SIM_PORT_D, 2, lo_uint8_level);
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
+
+/**
+ * @brief a private function, INT0 call back, charges its work at once
+ *
+ * @return
+ */
+static void bench_isr_work(void)
+{
+	gl_uint32_bench_jobs++;
+	sim_consume_cycles(gl_uint32_bench_isr_work);
+}
+
+/**
+ * @brief a private function to report the longest time the interrupts stay
+ *		  masked while an INT0 call back of the given work runs in its ISR or
+ *		  is deferred to the dwq. The measure covers every ISR and critical
+ *		  section of the run, the tick ISR and the kernel ones included
+ *
+ * @return
+ */
+static void bench_isr(enu_exi_cbf_mode_t_ enu_cbf_mode, uint16_t_ uint16_work_us)
+{
+	char arr_char_param[16];
+	const char * ptr_str_mode = (EXI_CBF_DEFERRED == enu_cbf_mode) ? "deferred" : "immediate";
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	gl_uint32_bench_jobs		= 0;
+	gl_uint32_bench_isr_work	= (uint32_t_)uint16_work_us * BENCH_CYCLES_PER_US;
+	exi_set_sense(EXI_ID_0, EXI_MODE_RISING_EDGE);
+	exi_set_callback(EXI_ID_0, bench_isr_work);
+	exi_set_callback_mode(EXI_ID_0, enu_cbf_mode);
+	exi_set_state(EXI_ID_0, EXI_STATE_ENABLE);
+
+	bench_make_tasks(1, BENCH_DIST_DUE, TRUE);
+	gl_arr_str_bench_tasks[0].ptr_func_task = bench_isr_pin_task;
+	sos_create_task(&gl_arr_str_bench_tasks[0]);
+
+	/* start up runs masked, only the run is measured */
+	sim_clear_masked_max();
+	bench_sos_run_ticks(BENCH_ISR_TICKS);
+
+	snprintf(arr_char_param, sizeof(arr_char_param), "work%uus", uint16_work_us);
+	bench_emit("isr", 1, ptr_str_mode, arr_char_param, "masked_us_max",
+			   (f64_t_)sim_get_masked_max_cycles() / BENCH_CYCLES_PER_US);
+	bench_emit("isr", 1, ptr_str_mode, arr_char_param, "callbacks", (f64_t_)gl_uint32_bench_jobs);
+
+	exi_set_state(EXI_ID_0, EXI_STATE_DISABLE);
+	exi_set_callback_mode(EXI_ID_0, EXI_CBF_IMMEDIATE);
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function, task of bench_delay, checks that it started the
+ *		  delay its last job returned after that job and returns the next one
+ *
+ * @return next delay of gl_arr_uint16_bench_delays
+ */
+static uint16_t_ bench_delay_task(void)
+{
+	uint32_t_ uint32_tick = sos_get_ticks();
+
+	if(0 != gl_uint32_bench_delay_jobs)
+	{
+		if((uint32_tick - gl_uint32_bench_delay_last_tick) != gl_arr_uint16_bench_delays[gl_uint8_bench_delay_index])
+		{
+			gl_uint32_bench_delay_errors++;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		gl_uint8_bench_delay_index = (uint8_t_)((gl_uint8_bench_delay_index + 1) %
+									 (sizeof(gl_arr_uint16_bench_delays) / sizeof(gl_arr_uint16_bench_delays[0])));
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	gl_uint32_bench_delay_last_tick = uint32_tick;
+	gl_uint32_bench_delay_jobs++;
+
+	return gl_arr_uint16_bench_delays[gl_uint8_bench_delay_index];
+}
+
+/**
+ * @brief a private function to run one task that returns its next activation
+ *		  delay and report its jobs and the intervals that missed the delay
+ *
+ * @return
+ */
+static void bench_delay(void)
+{
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_make_tasks(1, BENCH_DIST_DUE, TRUE);
+	gl_arr_str_bench_tasks[0].uint16_task_periodicity	= BENCH_DELAY_PERIOD;
+	gl_arr_str_bench_tasks[0].ptr_func_task				= bench_delay_task;
+	gl_uint8_bench_delay_index							= 0;
+	gl_uint32_bench_delay_jobs							= 0;
+	gl_uint32_bench_delay_errors						= 0;
+	sos_create_task(&gl_arr_str_bench_tasks[0]);
+
+	bench_sos_run_ticks(BENCH_DELAY_TICKS);
+
+	bench_emit("delay", 1, "due", "-", "jobs", (f64_t_)gl_uint32_bench_delay_jobs);
+	bench_emit("delay", 1, "due", "-", "interval_errors", (f64_t_)gl_uint32_bench_delay_errors);
+
+	bench_sos_stop();
+}
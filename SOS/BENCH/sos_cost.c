@@ -0,0 +1,554 @@
+/**
+ * @fileName	:	sos_cost.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Cost of every public API under the host simulator
+ *
+ * usage: sos_cost [results.csv]
+ *
+ * Calls the public functions of every module on the SIM register file, with
+ * the firmware configuration (sos_preconfig.h), and writes per call:
+ * 			access_cycles	sim cycles (see bench_interface.h) of the register
+ * 							accesses and critical sections of the call, same on
+ * 							every run, the code between the accesses is not
+ * 							charged, it is not the CPU cost of the call
+ * 			host_ns			host time of the call and of the simulator under it
+ * 			net_ns			host_ns without the simulated accesses and the clock
+ * 							reads (bench_net_ns), the computation of the call
+ * n is the number of calls averaged. A call that changes a state is
+ * averaged over a whole fill (sos_create_task over an empty mode, mpl_alloc
+ * over an empty pool), the sync objects are taken from inside a task.
+ * Global interrupts stay disabled but for the run of that task, no ISR lands
+ * inside a measured call. sos_report turns the rows into a table.
+ */
+
+#define _POSIX_C_SOURCE		200809L		/* unsetenv */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_interface.h"
+#include "sim_interface.h"
+#include "interrupts.h"
+#include "dio_interface.h"
+#include "exi_interface.h"
+#include "timer_interface.h"
+#include "led_interface.h"
+#include "btn_interface.h"
+#include "critical.h"
+#include "swt_interface.h"
+#include "hrt_interface.h"
+#include "dwq_interface.h"
+#include "mpl_interface.h"
+#include "mbx_interface.h"
+
+#define COST_CALLS						8
+#define COST_POOL_BLOCK_SIZE			16
+
+static void			cost_start				(void);
+static void			cost_stop				(const char * ptr_str_api, uint8_t_ uint8_calls);
+static void			cost_mcal				(void);
+static void			cost_ecual				(void);
+static void			cost_serv				(void);
+static void			cost_sos				(void);
+static uint16_t_	cost_sync_task			(void);
+static void			cost_callback			(void);
+
+static uint64_t_				gl_uint64_cost_cycles = 0;
+static uint64_t_				gl_uint64_cost_ns = 0;
+static str_sos_task_t_			gl_arr_str_cost_tasks[SOS_NUMBER_OF_TASKS];
+
+
+int main(int argc, char * argv[])
+{
+	if(FALSE == bench_open((argc > 1) ? argv[1] : NULL_PTR))
+	{
+		fprintf(stderr, "sos_cost: can not open %s\n", argv[1]);
+		return 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* the simulator must charge nothing but the calls */
+	unsetenv(SIM_TRACE_ENV);
+	unsetenv(SIM_RECORD_ENV);
+	unsetenv(SIM_REPLAY_ENV);
+	unsetenv(SIM_REALTIME_ENV);
+
+	sim_init();
+	sim_set_end(0, NULL_PTR);
+	bench_calibrate();
+
+	cost_mcal();
+	cost_ecual();
+	cost_serv();
+	cost_sos();
+
+	bench_close();
+
+	return 0;
+}
+
+/**
+ * @brief a private function to take the clocks before the measured calls
+ *
+ * @return
+ */
+static void cost_start(void)
+{
+	gl_uint64_cost_ns		= bench_host_ns();
+	gl_uint64_cost_cycles	= sim_get_cycles();
+}
+
+/**
+ * @brief a private function to write the cost per call since cost_start
+ *
+ * @param ptr_str_api  : API name
+ * @param uint8_calls  : calls made since cost_start
+ *
+ * @return
+ */
+static void cost_stop(const char * ptr_str_api, uint8_t_ uint8_calls)
+{
+	uint64_t_ uint64_cycles	= sim_get_cycles() - gl_uint64_cost_cycles;
+	uint64_t_ uint64_ns		= bench_host_ns() - gl_uint64_cost_ns;
+
+	bench_emit("cost", uint8_calls, "-", ptr_str_api, "access_cycles", (f64_t_)uint64_cycles / uint8_calls);
+	bench_emit("cost", uint8_calls, "-", ptr_str_api, "host_ns", (f64_t_)uint64_ns / uint8_calls);
+	bench_emit("cost", uint8_calls, "-", ptr_str_api, "net_ns", bench_net_ns(uint64_ns, uint64_cycles) / uint8_calls);
+}
+
+/**
+ * @brief a private function to measure the drivers (dio, exi, timer)
+ *
+ * @return
+ */
+static void cost_mcal(void)
+{
+	enu_dio_pin_val_t_ enu_pin_val;
+	uint32_t_ uint32_elapsed_us;
+	uint16_t_ uint16_count;
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)dio_init(DIO_PORT_A, (enu_dio_pin_t_)uint8_call, DIO_OUT);
+	}
+	cost_stop("dio_init", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)dio_write(DIO_PORT_A, (enu_dio_pin_t_)uint8_call, (enu_dio_pin_val_t_)(uint8_call & 1));
+	}
+	cost_stop("dio_write", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)dio_read(DIO_PORT_A, (enu_dio_pin_t_)uint8_call, &enu_pin_val);
+	}
+	cost_stop("dio_read", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)dio_toggle(DIO_PORT_A, (enu_dio_pin_t_)uint8_call);
+	}
+	cost_stop("dio_toggle", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)dio_port_init(DIO_PORT_B, DIO_PORT_OUT, 0xFF);
+	}
+	cost_stop("dio_port_init", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)dio_port_write(DIO_PORT_B, DIO_PORT_HIGH, (uint8_t_)(1 << uint8_call));
+	}
+	cost_stop("dio_port_write", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)dio_port_toggle(DIO_PORT_B, 0x0F);
+	}
+	cost_stop("dio_port_toggle", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)exi_set_sense((enu_exi_id_t_)(uint8_call % EXI_ID_TOTAL), EXI_MODE_RISING_EDGE);
+	}
+	cost_stop("exi_set_sense", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)exi_set_callback((enu_exi_id_t_)(uint8_call % EXI_ID_TOTAL), cost_callback);
+	}
+	cost_stop("exi_set_callback", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)exi_set_state((enu_exi_id_t_)(uint8_call % EXI_ID_TOTAL), (enu_exi_state_t_)(uint8_call & 1));
+	}
+	cost_stop("exi_set_state", COST_CALLS);
+
+	cost_start();
+	(void)timer_init();
+	cost_stop("timer_init", 1);
+
+	/* soft float on the target, only its register writes are access cycles, net_ns has the float math */
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)timer_set_time(TIMER_0, (f32_t_)(uint8_call + 1));
+	}
+	cost_stop("timer_set_time", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)timer_enable_interrupt(TIMER_0);
+		(void)timer_disable_interrupt(TIMER_0);
+	}
+	cost_stop("timer_enable+disable_interrupt", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)timer_resume(TIMER_0);
+		(void)timer_pause(TIMER_0);
+	}
+	cost_stop("timer_resume+pause", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)timer_get_count(TIMER_1, &uint16_count);
+	}
+	cost_stop("timer_get_count", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)timer_get_elapsed_us(TIMER_0, &uint32_elapsed_us);
+	}
+	cost_stop("timer_get_elapsed_us", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)timer_compare_set(TIMER_1, TIMER_COMPARE_A, (uint16_t_)(uint8_call * 100U));
+		(void)timer_compare_disable(TIMER_1, TIMER_COMPARE_A);
+	}
+	cost_stop("timer_compare_set+disable", COST_CALLS);
+}
+
+/**
+ * @brief a private function to measure the board drivers (led, button)
+ *
+ * @return
+ */
+static void cost_ecual(void)
+{
+	str_btn_config_t_ str_btn = {BTN_PORT_D, BTN_PIN_2, (enu_btn_read_mode_t_)0, BTN_INTERNAL_PULL_UP, (enu_btn_active_state_t_)0};
+	enu_btn_state_t_ enu_btn_state;
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)led_init(LED_PORT_A, (enu_led_pin_t_)uint8_call);
+	}
+	cost_stop("led_init", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)led_on(LED_PORT_A, (enu_led_pin_t_)uint8_call);
+		(void)led_off(LED_PORT_A, (enu_led_pin_t_)uint8_call);
+	}
+	cost_stop("led_on+off", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)led_toggle(LED_PORT_A, (enu_led_pin_t_)uint8_call);
+	}
+	cost_stop("led_toggle", COST_CALLS);
+
+	cost_start();
+	(void)btn_init(&str_btn);
+	cost_stop("btn_init", 1);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)btn_read(&str_btn, &enu_btn_state);
+	}
+	cost_stop("btn_read", COST_CALLS);
+}
+
+/**
+ * @brief a private function to measure the critical sections and the
+ *		  services outside SOS (swt, hrt, dwq, mpl, mbx)
+ *
+ * @return
+ */
+static void cost_serv(void)
+{
+	static void * arr_ptr_storage[MPL_STORAGE_WORDS(COST_POOL_BLOCK_SIZE, COST_CALLS)];
+	static void * arr_ptr_slots[COST_CALLS];
+	void * arr_ptr_blocks[COST_CALLS];
+	str_critical_t_ str_critical;
+	str_swt_timer_t_ arr_str_swt[COST_CALLS] = {0};
+	str_hrt_timer_t_ arr_str_hrt[COST_CALLS] = {0};
+	str_mpl_pool_t_ str_pool;
+	str_mbx_t_ str_mbx;
+	void * ptr_msg;
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		enter_critical(&str_critical, CRITICAL_SITE_SOS_DB);
+		exit_critical(&str_critical);
+	}
+	cost_stop("enter+exit_critical", COST_CALLS);
+
+	swt_init();
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)swt_start(&arr_str_swt[uint8_call], (uint16_t_)(10U * (uint8_call + 1U)), 0, cost_callback);
+	}
+	cost_stop("swt_start", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		swt_tick();
+	}
+	cost_stop("swt_tick", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)swt_stop(&arr_str_swt[uint8_call]);
+	}
+	cost_stop("swt_stop", COST_CALLS);
+
+	cost_start();
+	(void)hrt_init();
+	cost_stop("hrt_init", 1);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)hrt_start(&arr_str_hrt[uint8_call], (uint16_t_)(1000U * (uint8_call + 1U)), cost_callback);
+	}
+	cost_stop("hrt_start", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)hrt_cancel(&arr_str_hrt[uint8_call]);
+	}
+	cost_stop("hrt_cancel", COST_CALLS);
+
+	dwq_init();
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)dwq_post(cost_callback);
+	}
+	cost_stop("dwq_post", COST_CALLS);
+
+	/* COST_CALLS work items */
+	cost_start();
+	dwq_drain();
+	cost_stop("dwq_drain", 1);
+
+	cost_start();
+	(void)mpl_init(&str_pool, arr_ptr_storage, COST_POOL_BLOCK_SIZE, COST_CALLS);
+	cost_stop("mpl_init", 1);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)mpl_alloc(&str_pool, &arr_ptr_blocks[uint8_call]);
+	}
+	cost_stop("mpl_alloc", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)mpl_free(&str_pool, arr_ptr_blocks[uint8_call]);
+	}
+	cost_stop("mpl_free", COST_CALLS);
+
+	cost_start();
+	(void)mbx_init(&str_mbx, arr_ptr_slots, COST_CALLS);
+	cost_stop("mbx_init", 1);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)mbx_send(&str_mbx, &arr_ptr_slots[uint8_call]);
+	}
+	cost_stop("mbx_send", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)mbx_receive(&str_mbx, &ptr_msg);
+	}
+	cost_stop("mbx_receive", COST_CALLS);
+}
+
+/**
+ * @brief a private function to measure the SOS task database, the mode
+ *		  switch and, from one job, the sync objects
+ *
+ * @return
+ */
+static void cost_sos(void)
+{
+	str_sos_task_t_ * arr_ptr_str_tasks[SOS_NUMBER_OF_TASKS];
+	uint8_t_ uint8_count;
+
+	cost_start();
+	(void)sos_init();
+	cost_stop("sos_init", 1);
+
+	/* every task a priority above the last one, each insertion walks the whole task set */
+	for(uint8_t_ uint8_index = 0; uint8_index < SOS_NUMBER_OF_TASKS; uint8_index++)
+	{
+		gl_arr_str_cost_tasks[uint8_index] = (str_sos_task_t_){0};
+		gl_arr_str_cost_tasks[uint8_index].uint8_task_priority		= (uint8_t_)(SOS_NUMBER_OF_TASKS - uint8_index);
+		gl_arr_str_cost_tasks[uint8_index].uint16_task_periodicity	= 1;
+		gl_arr_str_cost_tasks[uint8_index].ptr_func_task			= cost_sync_task;
+	}
+	cost_start();
+	for(uint8_t_ uint8_index = 0; uint8_index < SOS_NUMBER_OF_TASKS; uint8_index++)
+	{
+		(void)sos_create_task(&gl_arr_str_cost_tasks[uint8_index]);
+	}
+	cost_stop("sos_create_task", SOS_NUMBER_OF_TASKS);
+
+	/* first task to the back of the task set */
+	gl_arr_str_cost_tasks[SOS_NUMBER_OF_TASKS - 1].uint8_task_priority = SOS_NUMBER_OF_TASKS + 1;
+	cost_start();
+	(void)sos_modify_task(gl_arr_str_cost_tasks[SOS_NUMBER_OF_TASKS - 1].uint8_task_id);
+	cost_stop("sos_modify_task", 1);
+
+	cost_start();
+	(void)sos_get_mode_tasks(SOS_DEFAULT_MODE_ID, arr_ptr_str_tasks, &uint8_count);
+	cost_stop("sos_get_mode_tasks", 1);
+
+	cost_start();
+	(void)sos_get_ticks();
+	cost_stop("sos_get_ticks", 1);
+
+	cost_start();
+	(void)sos_switch_mode((SOS_DEFAULT_MODE_ID + 1) % SOS_NUMBER_OF_MODES, SOS_MODE_SWITCH_NEXT_TICK);
+	(void)sos_switch_mode(SOS_DEFAULT_MODE_ID, SOS_MODE_SWITCH_NEXT_TICK);
+	cost_stop("sos_switch_mode", 2);
+
+	/* a single task left, its first job measures the sync objects and stops SOS */
+	cost_start();
+	for(uint8_t_ uint8_index = 1; uint8_index < SOS_NUMBER_OF_TASKS; uint8_index++)
+	{
+		(void)sos_delete_task(gl_arr_str_cost_tasks[uint8_index].uint8_task_id);
+	}
+	cost_stop("sos_delete_task", SOS_NUMBER_OF_TASKS - 1);
+
+	sei();
+	bench_sos_run_ticks(SOS_NUMBER_OF_TASKS);
+	cli();
+
+	cost_start();
+	(void)sos_deinit();
+	cost_stop("sos_deinit", 1);
+}
+
+/**
+ * @brief a private function, body of the task left in SOS, measures the
+ *		  sync objects in task context once and stops SOS
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ cost_sync_task(void)
+{
+	str_sos_sem_t_ str_sem;
+	str_sos_mutex_t_ str_mutex;
+	str_sos_event_t_ str_event;
+	uint8_t_ uint8_flags;
+
+	(void)sos_sem_init(&str_sem, 0, COST_CALLS);
+	(void)sos_mutex_init(&str_mutex, 0);
+	(void)sos_event_init(&str_event);
+
+	/* the tick ISR must not land in a measured call */
+	cli();
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)sos_sem_give(&str_sem);
+	}
+	cost_stop("sos_sem_give", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)sos_sem_take(&str_sem);
+	}
+	cost_stop("sos_sem_take", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)sos_mutex_lock(&str_mutex);
+		(void)sos_mutex_unlock(&str_mutex);
+	}
+	cost_stop("sos_mutex_lock+unlock", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)sos_event_set(&str_event, (uint8_t_)(1 << uint8_call));
+	}
+	cost_stop("sos_event_set", COST_CALLS);
+
+	cost_start();
+	for(uint8_t_ uint8_call = 0; uint8_call < COST_CALLS; uint8_call++)
+	{
+		(void)sos_event_wait(&str_event, (uint8_t_)(1 << uint8_call), TRUE, &uint8_flags);
+	}
+	cost_stop("sos_event_wait", COST_CALLS);
+
+	cost_start();
+	sos_disable();
+	cost_stop("sos_disable", 1);
+
+	sei();
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
+
+/**
+ * @brief a private function, callback of the timers and the work queue
+ *
+ * @return
+ */
+static void cost_callback(void)
+{
+	/* Do Nothing */
+}
@@ -0,0 +1,417 @@
+/**
+ * @fileName	:	sos_farm.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Many simulated SOS instances in parallel on a work-stealing thread pool
+ *
+ * usage: sos_farm [results.csv] [jobs] [max workers]
+ *
+ * Every job is one generated task set (bench_generate_taskset, rate monotonic)
+ * run for FARM_TICKS on its own simulated MCU. The firmware state is INSTANCE
+ * (LIB/std.h), each worker thread is an isolated SOS instance and runs jobs
+ * back to back. Jobs are dealt to the workers in blocks, a worker takes its
+ * own jobs from the back of its deque and, once empty, steals from the front
+ * of the others.
+ * The same jobs run with 1, 2, 4 ... max workers (default: online CPUs).
+ * Rows, n is the worker count:
+ * 			wall_s					wall time of the whole job set
+ * 			sim_s					virtual time simulated, all instances
+ * 			sim_s_per_wall_s		throughput
+ * 			speedup, efficiency		against 1 worker, efficiency = speedup / n
+ * 			steals					jobs run by a worker they were not dealt to
+ * 			deadline_misses, jobs	sums over the job set, the same for every n or
+ * 									the instances are not isolated (exit code 1)
+ */
+
+#define _POSIX_C_SOURCE		200809L		/* sysconf, unsetenv */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "bench_interface.h"
+#include "sim_interface.h"
+#include "sim_cfg.h"
+
+#define FARM_SEED						0xFA4Du
+#define FARM_DEFAULT_JOBS				2000
+#define FARM_TICKS						500
+#define FARM_SLICE_CYCLES				2000UL		/* tick interrupt latency of a job, as sos_taskset */
+#define FARM_MAX_TASKS					(SOS_NUMBER_OF_TASKS - 1)
+#define FARM_MAX_WORKERS				64
+
+/* Sums of the jobs run by a worker, added in any order */
+typedef struct
+{
+	uint64_t_	uint64_sim_cycles;
+	uint32_t_	uint32_misses;
+	uint32_t_	uint32_jobs;
+	uint32_t_	uint32_sets;
+	uint32_t_	uint32_steals;
+}str_farm_result_t_;
+
+/* Jobs of a worker, [head, tail) left to run */
+typedef struct
+{
+	pthread_mutex_t		str_mutex;
+	uint32_t_ *			ptr_uint32_jobs;
+	uint32_t_			uint32_head;
+	uint32_t_			uint32_tail;
+}str_farm_deque_t_;
+
+typedef struct
+{
+	pthread_t			str_thread;
+	uint8_t_			uint8_id;
+	str_farm_result_t_	str_result;
+}str_farm_worker_t_;
+
+static void			farm_run				(uint8_t_ uint8_workers, f64_t_ * ptr_f64_wall_s, str_farm_result_t_ * ptr_str_total);
+static void *		farm_worker				(void * ptr_arg);
+static uint8_t_		farm_take				(uint8_t_ uint8_worker, uint32_t_ * ptr_uint32_job, uint8_t_ * ptr_bool_stolen);
+static void			farm_run_job			(uint32_t_ uint32_job, str_farm_result_t_ * ptr_str_result);
+static uint16_t_	farm_task				(void);
+
+static uint32_t_			gl_uint32_farm_jobs = FARM_DEFAULT_JOBS;
+static uint8_t_				gl_uint8_farm_workers = 0;
+static str_farm_deque_t_	gl_arr_str_farm_deques[FARM_MAX_WORKERS];
+static str_farm_worker_t_	gl_arr_str_farm_workers[FARM_MAX_WORKERS];
+
+/* task set of the job a worker runs */
+static INSTANCE str_bench_task_spec_t_	gl_arr_str_farm_specs[FARM_MAX_TASKS];
+static INSTANCE str_sos_task_t_			gl_arr_str_farm_tasks[FARM_MAX_TASKS];
+static INSTANCE uint32_t_				gl_arr_uint32_farm_jobs_run[FARM_MAX_TASKS];
+
+
+int main(int argc, char * argv[])
+{
+	str_farm_result_t_ str_total;
+	str_farm_result_t_ str_single = {0};
+	f64_t_ f64_wall_s;
+	f64_t_ f64_single_s = 0.0;
+	f64_t_ f64_sim_s;
+	long sint_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	uint8_t_ uint8_max_workers = (sint_cpus > 0) ? (uint8_t_)((sint_cpus < FARM_MAX_WORKERS) ? sint_cpus : FARM_MAX_WORKERS) : 1;
+	uint8_t_ uint8_workers = 1;
+	int sint_retval = 0;
+
+	if(argc > 2)
+	{
+		gl_uint32_farm_jobs = (uint32_t_)strtoul(argv[2], NULL_PTR, 0);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	if(argc > 3)
+	{
+		uint8_max_workers = (uint8_t_)strtoul(argv[3], NULL_PTR, 0);
+		uint8_max_workers = (uint8_max_workers > FARM_MAX_WORKERS) ? FARM_MAX_WORKERS : uint8_max_workers;
+		uint8_max_workers = (0 == uint8_max_workers) ? 1 : uint8_max_workers;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(FALSE == bench_open((argc > 1) ? argv[1] : NULL_PTR))
+	{
+		fprintf(stderr, "sos_farm: can not open %s\n", argv[1]);
+		return 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* every instance would open the same trace or input log */
+	unsetenv(SIM_TRACE_ENV);
+	unsetenv(SIM_RECORD_ENV);
+	unsetenv(SIM_REPLAY_ENV);
+	unsetenv(SIM_REALTIME_ENV);
+
+	while(0 != uint8_workers)
+	{
+		farm_run(uint8_workers, &f64_wall_s, &str_total);
+
+		if(1 == uint8_workers)
+		{
+			str_single		= str_total;
+			f64_single_s	= f64_wall_s;
+		}
+		else if(
+				(str_total.uint64_sim_cycles != str_single.uint64_sim_cycles) ||
+				(str_total.uint32_misses != str_single.uint32_misses) ||
+				(str_total.uint32_jobs != str_single.uint32_jobs) ||
+				(str_total.uint32_sets != str_single.uint32_sets)
+				)
+		{
+			fprintf(stderr, "sos_farm: %u workers got other results than 1 worker\n", uint8_workers);
+			sint_retval = 1;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		f64_sim_s = (f64_t_)str_total.uint64_sim_cycles / SIM_CPU_FREQ_HZ;
+		bench_emit("farm", uint8_workers, "-", "-", "wall_s", f64_wall_s);
+		bench_emit("farm", uint8_workers, "-", "-", "sim_s", f64_sim_s);
+		bench_emit("farm", uint8_workers, "-", "-", "sim_s_per_wall_s", (f64_wall_s > 0.0) ? f64_sim_s / f64_wall_s : 0.0);
+		bench_emit("farm", uint8_workers, "-", "-", "speedup", (f64_wall_s > 0.0) ? f64_single_s / f64_wall_s : 0.0);
+		bench_emit("farm", uint8_workers, "-", "-", "efficiency",
+				   (f64_wall_s > 0.0) ? f64_single_s / f64_wall_s / uint8_workers : 0.0);
+		bench_emit("farm", uint8_workers, "-", "-", "steals", str_total.uint32_steals);
+		bench_emit("farm", uint8_workers, "-", "-", "deadline_misses", str_total.uint32_misses);
+		bench_emit("farm", uint8_workers, "-", "-", "jobs", str_total.uint32_jobs);
+
+		if(uint8_workers == uint8_max_workers)
+		{
+			uint8_workers = 0;
+		}
+		else
+		{
+			uint8_workers = ((2 * uint8_workers) < uint8_max_workers) ? (2 * uint8_workers) : uint8_max_workers;
+		}
+	}
+
+	bench_close();
+
+	return sint_retval;
+}
+
+/**
+ * @brief a private function to run the whole job set on a number of workers
+ *
+ * @param uint8_workers  : threads
+ * @param ptr_f64_wall_s : wall time of the run
+ * @param ptr_str_total  : sums of all the workers
+ *
+ * @return
+ */
+static void farm_run(uint8_t_ uint8_workers, f64_t_ * ptr_f64_wall_s, str_farm_result_t_ * ptr_str_total)
+{
+	uint32_t_ uint32_first;
+	uint32_t_ uint32_count;
+	uint64_t_ uint64_ns;
+
+	gl_uint8_farm_workers = uint8_workers;
+	*ptr_str_total = (str_farm_result_t_){0};
+
+	/* deal the jobs in blocks, neighbour jobs have the same size so the blocks are uneven */
+	for(uint8_t_ uint8_worker = 0; uint8_worker < uint8_workers; uint8_worker++)
+	{
+		uint32_first = (uint32_t_)(((uint64_t_)gl_uint32_farm_jobs * uint8_worker) / uint8_workers);
+		uint32_count = (uint32_t_)(((uint64_t_)gl_uint32_farm_jobs * (uint8_worker + 1)) / uint8_workers) - uint32_first;
+
+		pthread_mutex_init(&gl_arr_str_farm_deques[uint8_worker].str_mutex, NULL_PTR);
+		gl_arr_str_farm_deques[uint8_worker].ptr_uint32_jobs	= malloc((uint32_count + 1) * sizeof(uint32_t_));
+		gl_arr_str_farm_deques[uint8_worker].uint32_head		= 0;
+		gl_arr_str_farm_deques[uint8_worker].uint32_tail		= uint32_count;
+		for(uint32_t_ uint32_index = 0; uint32_index < uint32_count; uint32_index++)
+		{
+			gl_arr_str_farm_deques[uint8_worker].ptr_uint32_jobs[uint32_index] = uint32_first + uint32_index;
+		}
+
+		gl_arr_str_farm_workers[uint8_worker].uint8_id		= uint8_worker;
+		gl_arr_str_farm_workers[uint8_worker].str_result	= (str_farm_result_t_){0};
+	}
+
+	uint64_ns = bench_host_ns();
+
+	for(uint8_t_ uint8_worker = 0; uint8_worker < uint8_workers; uint8_worker++)
+	{
+		pthread_create(&gl_arr_str_farm_workers[uint8_worker].str_thread, NULL_PTR, farm_worker,
+					   &gl_arr_str_farm_workers[uint8_worker]);
+	}
+	for(uint8_t_ uint8_worker = 0; uint8_worker < uint8_workers; uint8_worker++)
+	{
+		pthread_join(gl_arr_str_farm_workers[uint8_worker].str_thread, NULL_PTR);
+	}
+
+	*ptr_f64_wall_s = (f64_t_)(bench_host_ns() - uint64_ns) / 1e9;
+
+	for(uint8_t_ uint8_worker = 0; uint8_worker < uint8_workers; uint8_worker++)
+	{
+		ptr_str_total->uint64_sim_cycles	+= gl_arr_str_farm_workers[uint8_worker].str_result.uint64_sim_cycles;
+		ptr_str_total->uint32_misses		+= gl_arr_str_farm_workers[uint8_worker].str_result.uint32_misses;
+		ptr_str_total->uint32_jobs			+= gl_arr_str_farm_workers[uint8_worker].str_result.uint32_jobs;
+		ptr_str_total->uint32_sets			+= gl_arr_str_farm_workers[uint8_worker].str_result.uint32_sets;
+		ptr_str_total->uint32_steals		+= gl_arr_str_farm_workers[uint8_worker].str_result.uint32_steals;
+
+		pthread_mutex_destroy(&gl_arr_str_farm_deques[uint8_worker].str_mutex);
+		free(gl_arr_str_farm_deques[uint8_worker].ptr_uint32_jobs);
+	}
+}
+
+/**
+ * @brief a private function, body of a worker thread, runs jobs until no
+ *		  deque has one left
+ *
+ * @param ptr_arg : its str_farm_worker_t_
+ *
+ * @return NULL_PTR
+ */
+static void * farm_worker(void * ptr_arg)
+{
+	str_farm_worker_t_ * ptr_str_worker = ptr_arg;
+	uint32_t_ uint32_job;
+	uint8_t_ bool_stolen;
+
+	while(TRUE == farm_take(ptr_str_worker->uint8_id, &uint32_job, &bool_stolen))
+	{
+		ptr_str_worker->str_result.uint32_steals += bool_stolen;
+		farm_run_job(uint32_job, &ptr_str_worker->str_result);
+	}
+
+	return NULL_PTR;
+}
+
+/**
+ * @brief a private function to get the next job of a worker, from the back
+ *		  of its own deque or else from the front of another one. No job is
+ *		  added during a run, nothing found in one pass means all are taken
+ *
+ * @param uint8_worker     : worker asking
+ * @param ptr_uint32_job   : job to run
+ * @param ptr_bool_stolen  : TRUE if it comes from another deque
+ *
+ * @return TRUE if a job was taken
+ */
+static uint8_t_ farm_take(uint8_t_ uint8_worker, uint32_t_ * ptr_uint32_job, uint8_t_ * ptr_bool_stolen)
+{
+	str_farm_deque_t_ * ptr_str_deque = &gl_arr_str_farm_deques[uint8_worker];
+	uint8_t_ bool_retval = FALSE;
+	uint8_t_ uint8_victim;
+
+	pthread_mutex_lock(&ptr_str_deque->str_mutex);
+	if(ptr_str_deque->uint32_head != ptr_str_deque->uint32_tail)
+	{
+		ptr_str_deque->uint32_tail--;
+		*ptr_uint32_job		= ptr_str_deque->ptr_uint32_jobs[ptr_str_deque->uint32_tail];
+		*ptr_bool_stolen	= FALSE;
+		bool_retval			= TRUE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	pthread_mutex_unlock(&ptr_str_deque->str_mutex);
+
+	for(uint8_t_ uint8_offset = 1; (FALSE == bool_retval) && (uint8_offset < gl_uint8_farm_workers); uint8_offset++)
+	{
+		uint8_victim	= (uint8_t_)((uint8_worker + uint8_offset) % gl_uint8_farm_workers);
+		ptr_str_deque	= &gl_arr_str_farm_deques[uint8_victim];
+
+		pthread_mutex_lock(&ptr_str_deque->str_mutex);
+		if(ptr_str_deque->uint32_head != ptr_str_deque->uint32_tail)
+		{
+			*ptr_uint32_job		= ptr_str_deque->ptr_uint32_jobs[ptr_str_deque->uint32_head];
+			ptr_str_deque->uint32_head++;
+			*ptr_bool_stolen	= TRUE;
+			bool_retval			= TRUE;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		pthread_mutex_unlock(&ptr_str_deque->str_mutex);
+	}
+
+	return bool_retval;
+}
+
+/**
+ * @brief a private function to run one job on the instance of the calling
+ *		  thread, the job number alone decides the task set
+ *
+ * @param uint32_job     : job number
+ * @param ptr_str_result : sums to add the job to
+ *
+ * @return
+ */
+static void farm_run_job(uint32_t_ uint32_job, str_farm_result_t_ * ptr_str_result)
+{
+	static const uint8_t_ arr_uint8_counts[] = {2, 4, 8, FARM_MAX_TASKS};
+	str_sos_deadline_stats_t_ str_stats;
+	uint8_t_ uint8_n = arr_uint8_counts[uint32_job % sizeof(arr_uint8_counts)];
+	f64_t_ f64_utilization = 0.3 + (0.1 * ((uint32_job / sizeof(arr_uint8_counts)) % 8));
+	enu_bench_dist_t_ enu_dist = (0 == ((uint32_job / 32) % 2)) ? BENCH_DIST_HARMONIC : BENCH_DIST_RANDOM;
+	uint64_t_ uint64_cycles;
+
+	bench_seed(FARM_SEED + uint32_job);
+	bench_generate_taskset(gl_arr_str_farm_specs, uint8_n, f64_utilization, enu_dist, BENCH_PRIO_RM, 0);
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		gl_arr_str_farm_tasks[uint8_index] = (str_sos_task_t_){0};
+		gl_arr_str_farm_tasks[uint8_index].uint8_task_id			= uint8_index;
+		gl_arr_str_farm_tasks[uint8_index].uint8_task_priority		= gl_arr_str_farm_specs[uint8_index].uint8_priority;
+		gl_arr_str_farm_tasks[uint8_index].uint16_task_periodicity	= gl_arr_str_farm_specs[uint8_index].uint16_period;
+		gl_arr_str_farm_tasks[uint8_index].ptr_func_task			= farm_task;
+		gl_arr_uint32_farm_jobs_run[uint8_index] = 0;
+		sos_create_task(&gl_arr_str_farm_tasks[uint8_index]);
+	}
+
+	uint64_cycles = sim_get_cycles();
+	bench_sos_run_ticks(FARM_TICKS);
+	ptr_str_result->uint64_sim_cycles += sim_get_cycles() - uint64_cycles;
+
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		if(SOS_STATUS_SUCCESS == sos_get_deadline_stats(uint8_index, &str_stats))
+		{
+			ptr_str_result->uint32_misses += str_stats.uint16_misses;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		ptr_str_result->uint32_jobs += gl_arr_uint32_farm_jobs_run[uint8_index];
+	}
+	ptr_str_result->uint32_sets++;
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function, body of every generated task, charges its
+ *		  wcet in FARM_SLICE_CYCLES slices
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ farm_task(void)
+{
+	uint8_t_ uint8_index = (uint8_t_)(sos_get_running_task() - gl_arr_str_farm_tasks);
+	uint32_t_ uint32_work;
+	uint32_t_ uint32_slice;
+
+	if(FARM_MAX_TASKS > uint8_index)
+	{
+		uint32_work = gl_arr_str_farm_specs[uint8_index].uint32_wcet_cycles;
+		gl_arr_uint32_farm_jobs_run[uint8_index]++;
+
+		while(0 != uint32_work)
+		{
+			uint32_slice = (uint32_work > FARM_SLICE_CYCLES) ? FARM_SLICE_CYCLES : uint32_work;
+			sim_consume_cycles(uint32_slice);
+			uint32_work -= uint32_slice;
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
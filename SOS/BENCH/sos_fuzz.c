@@ -0,0 +1,828 @@
+/**
+ * @fileName	:	sos_fuzz.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Property based fuzzing of the SOS task database
+ *
+ * usage: sos_fuzz [results.csv] [operations] [seed]
+ *
+ * Random create, delete, modify, mode switch, run and disable operations,
+ * valid or not, on a pool of tasks bigger than the ID range, against a
+ * reference model of the mode task sets. Every status is compared with the
+ * one the model expects and after every operation the task sets of all
+ * modes (sos_get_mode_tasks) are checked:
+ * 			the tasks and the count of every mode are the ones of the model
+ * 			the task set is in priority order, the slots past the count are empty
+ * 			a task keeps its ID while registered, IDs are in range and unique
+ * Priorities are drawn from a small range so equal priority groups are
+ * common, and the whole database is torn down (sos_deinit) every
+ * FUZZ_RESTART_OPS operations. A run checks that only tasks of the active
+ * mode ran and that the jobs of a tick ran in priority order, a disable
+ * stops a run from inside its first job and checks no later tick ran.
+ * Rows, param is the operation (all: the whole loop, checks included):
+ * 			ops					operations done
+ * 			ops_per_s			host throughput of the SOS calls
+ * 			violations			0, the first one stops the run (exit code 1)
+ */
+
+#define _POSIX_C_SOURCE		200809L		/* unsetenv */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_interface.h"
+#include "sim_interface.h"
+
+#define FUZZ_DEFAULT_SEED				0x5EEDu
+#define FUZZ_DEFAULT_OPS				200000UL
+#define FUZZ_RESTART_OPS				5000UL
+#define FUZZ_POOL_SIZE					(SOS_NUMBER_OF_TASK_IDS + 4)	/* IDs run out before the pool		*/
+#define FUZZ_MAX_PRIORITY				4								/* ties in most task sets			*/
+#define FUZZ_MAX_PERIOD					6
+#define FUZZ_MAX_RUN_TICKS				3
+#define FUZZ_MAX_JOBS					((FUZZ_MAX_RUN_TICKS + 1) * SOS_NUMBER_OF_TASKS)
+#define FUZZ_INVALID_ONE_IN				16								/* odds of an invalid argument		*/
+#define FUZZ_NO_ID						0xFF
+
+typedef enum
+{
+	FUZZ_OP_CREATE					= 0	,
+	FUZZ_OP_DELETE						,
+	FUZZ_OP_MODIFY						,
+	FUZZ_OP_SWITCH						,
+	FUZZ_OP_RUN							,
+	FUZZ_OP_DISABLE						,
+	FUZZ_OP_TOTAL
+}enu_fuzz_op_t_;
+
+/* One job seen by the task body */
+typedef struct
+{
+	str_sos_task_t_ *	ptr_str_task;
+	uint8_t_			uint8_priority;
+	uint32_t_			uint32_tick;
+}str_fuzz_job_t_;
+
+static void			fuzz_restart			(void);
+static void			fuzz_op_create			(void);
+static void			fuzz_op_delete			(void);
+static void			fuzz_op_modify			(void);
+static void			fuzz_op_switch			(void);
+static void			fuzz_op_run				(uint8_t_ bool_disable);
+static void			fuzz_check				(void);
+static void			fuzz_expect				(enu_sos_status_t_ enu_got, enu_sos_status_t_ enu_expected);
+static void			fuzz_fail				(const char * ptr_str_what);
+static uint8_t_		fuzz_random_mode		(void);
+static uint8_t_		fuzz_pool_index			(const str_sos_task_t_ * ptr_str_task);
+static uint8_t_		fuzz_registered			(uint8_t_ uint8_index);
+static uint8_t_		fuzz_find_id			(uint8_t_ uint8_task_id);
+static uint16_t_	fuzz_task				(void);
+
+static const char * const gl_arr_ptr_fuzz_op_names[FUZZ_OP_TOTAL] =
+{
+		"create", "delete", "modify", "switch", "run", "disable"
+};
+
+/* operation odds out of 100 */
+static const uint8_t_ gl_arr_uint8_fuzz_op_weights[FUZZ_OP_TOTAL] =
+{
+		30, 25, 25, 5, 10, 5
+};
+
+static str_sos_task_t_		gl_arr_str_fuzz_pool[FUZZ_POOL_SIZE];
+
+/* reference model */
+static uint8_t_				gl_arr_arr_bool_fuzz_in_mode[SOS_NUMBER_OF_MODES][FUZZ_POOL_SIZE];
+static uint8_t_				gl_arr_uint8_fuzz_count[SOS_NUMBER_OF_MODES];
+static uint8_t_				gl_arr_uint8_fuzz_id[FUZZ_POOL_SIZE];			/* FUZZ_NO_ID while in no mode		*/
+static uint8_t_				gl_uint8_fuzz_ids_used = 0;
+static uint8_t_				gl_uint8_fuzz_active_mode = SOS_DEFAULT_MODE_ID;
+
+static str_fuzz_job_t_		gl_arr_str_fuzz_jobs[FUZZ_MAX_JOBS];
+static uint32_t_			gl_uint32_fuzz_jobs = 0;
+static uint8_t_				gl_bool_fuzz_disable = FALSE;					/* next job disables SOS			*/
+
+static uint32_t_			gl_uint32_fuzz_seed = FUZZ_DEFAULT_SEED;
+static uint32_t_			gl_uint32_fuzz_op_index = 0;
+static enu_fuzz_op_t_		gl_enu_fuzz_op = FUZZ_OP_CREATE;
+static uint32_t_			gl_uint32_fuzz_violations = 0;
+static uint32_t_			gl_arr_uint32_fuzz_ops[FUZZ_OP_TOTAL];
+static uint64_t_			gl_arr_uint64_fuzz_ns[FUZZ_OP_TOTAL];
+
+
+int main(int argc, char * argv[])
+{
+	uint32_t_ uint32_ops = (argc > 2) ? (uint32_t_)strtoul(argv[2], NULL_PTR, 0) : FUZZ_DEFAULT_OPS;
+	uint32_t_ uint32_draw;
+	uint64_t_ uint64_start_ns;
+	uint64_t_ uint64_total_ns;
+	uint8_t_ uint8_op;
+
+	gl_uint32_fuzz_seed = (argc > 3) ? (uint32_t_)strtoul(argv[3], NULL_PTR, 0) : FUZZ_DEFAULT_SEED;
+
+	if(FALSE == bench_open((argc > 1) ? argv[1] : NULL_PTR))
+	{
+		fprintf(stderr, "sos_fuzz: can not open %s\n", argv[1]);
+		return 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* the replayed inputs of another run would not match */
+	unsetenv(SIM_TRACE_ENV);
+	unsetenv(SIM_RECORD_ENV);
+	unsetenv(SIM_REPLAY_ENV);
+	unsetenv(SIM_REALTIME_ENV);
+
+	bench_seed(gl_uint32_fuzz_seed);
+	uint64_start_ns = bench_host_ns();
+	fuzz_restart();
+
+	for(gl_uint32_fuzz_op_index = 0;
+		(gl_uint32_fuzz_op_index < uint32_ops) && (0 == gl_uint32_fuzz_violations);
+		gl_uint32_fuzz_op_index++)
+	{
+		if(
+				(0 != gl_uint32_fuzz_op_index) &&
+				(0 == (gl_uint32_fuzz_op_index % FUZZ_RESTART_OPS))
+				)
+		{
+			fuzz_restart();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		uint32_draw = bench_random(0, 99);
+		for(uint8_op = 0; uint32_draw >= gl_arr_uint8_fuzz_op_weights[uint8_op]; uint8_op++)
+		{
+			uint32_draw -= gl_arr_uint8_fuzz_op_weights[uint8_op];
+		}
+		gl_enu_fuzz_op = (enu_fuzz_op_t_)uint8_op;
+
+		switch(gl_enu_fuzz_op)
+		{
+			case FUZZ_OP_CREATE:	fuzz_op_create();		break;
+			case FUZZ_OP_DELETE:	fuzz_op_delete();		break;
+			case FUZZ_OP_MODIFY:	fuzz_op_modify();		break;
+			case FUZZ_OP_SWITCH:	fuzz_op_switch();		break;
+			case FUZZ_OP_RUN:		fuzz_op_run(FALSE);		break;
+			default:				fuzz_op_run(TRUE);		break;
+		}
+		gl_arr_uint32_fuzz_ops[gl_enu_fuzz_op]++;
+
+		fuzz_check();
+	}
+
+	uint64_total_ns = bench_host_ns() - uint64_start_ns;
+	bench_sos_stop();
+
+	for(uint8_op = 0; uint8_op < FUZZ_OP_TOTAL; uint8_op++)
+	{
+		bench_emit("fuzz", SOS_NUMBER_OF_TASKS, "-", gl_arr_ptr_fuzz_op_names[uint8_op], "ops", gl_arr_uint32_fuzz_ops[uint8_op]);
+		bench_emit("fuzz", SOS_NUMBER_OF_TASKS, "-", gl_arr_ptr_fuzz_op_names[uint8_op], "ops_per_s",
+				   (0 != gl_arr_uint64_fuzz_ns[uint8_op]) ?
+				   (f64_t_)gl_arr_uint32_fuzz_ops[uint8_op] * 1e9 / (f64_t_)gl_arr_uint64_fuzz_ns[uint8_op] : 0.0);
+	}
+	bench_emit("fuzz", SOS_NUMBER_OF_TASKS, "-", "all", "ops", gl_uint32_fuzz_op_index);
+	bench_emit("fuzz", SOS_NUMBER_OF_TASKS, "-", "all", "ops_per_s",
+			   (0 != uint64_total_ns) ? (f64_t_)gl_uint32_fuzz_op_index * 1e9 / (f64_t_)uint64_total_ns : 0.0);
+	bench_emit("fuzz", SOS_NUMBER_OF_TASKS, "-", "all", "violations", gl_uint32_fuzz_violations);
+	bench_close();
+
+	return (0 == gl_uint32_fuzz_violations) ? 0 : 1;
+}
+
+/**
+ * @brief a private function to tear SOS down and start it again with empty
+ *		  task sets, the calls of the stopped SOS must be refused
+ *
+ * @return
+ */
+static void fuzz_restart(void)
+{
+	str_sos_task_t_ * arr_ptr_str_tasks[SOS_NUMBER_OF_TASKS];
+	uint8_t_ uint8_count = 0;
+
+	bench_sos_stop();
+	fuzz_expect(sos_mode_create_task(0, &gl_arr_str_fuzz_pool[0]), SOS_STATUS_INVALID_STATE);
+	fuzz_expect(sos_mode_delete_task(0, 0), SOS_STATUS_INVALID_STATE);
+	fuzz_expect(sos_modify_task(0), SOS_STATUS_INVALID_STATE);
+	fuzz_expect(sos_get_mode_tasks(0, arr_ptr_str_tasks, &uint8_count), SOS_STATUS_INVALID_STATE);
+
+	if(FALSE == bench_sos_start())
+	{
+		fprintf(stderr, "sos_fuzz: SOS start failed\n");
+		exit(1);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint8_t_ uint8_mode = 0; uint8_mode < SOS_NUMBER_OF_MODES; uint8_mode++)
+	{
+		gl_arr_uint8_fuzz_count[uint8_mode] = 0;
+		for(uint8_t_ uint8_index = 0; uint8_index < FUZZ_POOL_SIZE; uint8_index++)
+		{
+			gl_arr_arr_bool_fuzz_in_mode[uint8_mode][uint8_index] = FALSE;
+		}
+	}
+	for(uint8_t_ uint8_index = 0; uint8_index < FUZZ_POOL_SIZE; uint8_index++)
+	{
+		gl_arr_uint8_fuzz_id[uint8_index] = FUZZ_NO_ID;
+	}
+	gl_uint8_fuzz_ids_used		= 0;
+	gl_uint8_fuzz_active_mode	= SOS_DEFAULT_MODE_ID;
+
+	fuzz_check();
+}
+
+/**
+ * @brief a private function to add a pool task to a mode, now and then with
+ *		  an invalid mode or task, a task in no mode gets new parameters
+ *
+ * @return
+ */
+static void fuzz_op_create(void)
+{
+	uint8_t_ uint8_mode = fuzz_random_mode();
+	uint8_t_ uint8_index = (uint8_t_)bench_random(0, FUZZ_POOL_SIZE - 1);
+	str_sos_task_t_ * ptr_str_task = &gl_arr_str_fuzz_pool[uint8_index];
+	str_sos_task_t_ str_saved;
+	uint8_t_ bool_invalid = (0 == bench_random(0, FUZZ_INVALID_ONE_IN - 1)) ? TRUE : FALSE;
+	enu_sos_status_t_ enu_expected;
+	enu_sos_status_t_ enu_got;
+	uint64_t_ uint64_ns;
+
+	if(FALSE == fuzz_registered(uint8_index))
+	{
+		/* the stale ID is left, SOS must not trust it */
+		ptr_str_task->uint8_task_priority		= (uint8_t_)bench_random(0, FUZZ_MAX_PRIORITY);
+		ptr_str_task->uint16_task_periodicity	= (uint16_t_)bench_random(1, FUZZ_MAX_PERIOD);
+		ptr_str_task->ptr_func_task				= fuzz_task;
+		ptr_str_task->uint16_task_deadline		= 0;
+		ptr_str_task->enu_overload_action		= SOS_OVERLOAD_NONE;
+		ptr_str_task->ptr_func_overload			= NULL_PTR;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	str_saved = *ptr_str_task;
+	if(TRUE == bool_invalid)
+	{
+		switch(bench_random(0, 4))
+		{
+			case 0:		ptr_str_task->uint16_task_periodicity	= 0;						break;
+			case 1:		ptr_str_task->ptr_func_task				= NULL_PTR;					break;
+			case 2:		ptr_str_task->enu_overload_action		= SOS_OVERLOAD_TOTAL;		break;
+			case 3:		ptr_str_task->enu_overload_action		= SOS_OVERLOAD_HANDLER;		break;
+			default:	ptr_str_task							= NULL_PTR;					break;
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(SOS_NUMBER_OF_MODES <= uint8_mode)
+	{
+		enu_expected = SOS_STATUS_INVALID_MODE_ID;
+	}
+	else if(TRUE == bool_invalid)
+	{
+		enu_expected = SOS_STATUS_INVALID_ARGS;
+	}
+	else if(SOS_NUMBER_OF_TASKS == gl_arr_uint8_fuzz_count[uint8_mode])
+	{
+		enu_expected = SOS_STATUS_DATABASE_FULL;
+	}
+	else if(TRUE == gl_arr_arr_bool_fuzz_in_mode[uint8_mode][uint8_index])
+	{
+		enu_expected = SOS_STATUS_INVALID_ARGS;
+	}
+	else if(
+			(FALSE == fuzz_registered(uint8_index)) &&
+			(SOS_NUMBER_OF_TASK_IDS == gl_uint8_fuzz_ids_used)
+			)
+	{
+		enu_expected = SOS_STATUS_DATABASE_FULL;
+	}
+	else
+	{
+		enu_expected = SOS_STATUS_SUCCESS;
+	}
+
+	uint64_ns	= bench_host_ns();
+	enu_got		= sos_mode_create_task(uint8_mode, ptr_str_task);
+	gl_arr_uint64_fuzz_ns[FUZZ_OP_CREATE] += bench_host_ns() - uint64_ns;
+
+	if(TRUE == bool_invalid)
+	{
+		gl_arr_str_fuzz_pool[uint8_index] = str_saved;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	fuzz_expect(enu_got, enu_expected);
+
+	if(SOS_STATUS_SUCCESS == enu_got)
+	{
+		if(FALSE == fuzz_registered(uint8_index))
+		{
+			gl_arr_uint8_fuzz_id[uint8_index] = gl_arr_str_fuzz_pool[uint8_index].uint8_task_id;
+			gl_uint8_fuzz_ids_used++;
+		}
+		else
+		{
+			/* shared with another mode, fuzz_check verifies the ID was kept */
+		}
+		gl_arr_arr_bool_fuzz_in_mode[uint8_mode][uint8_index] = TRUE;
+		gl_arr_uint8_fuzz_count[uint8_mode]++;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to remove a task ID from a mode, the ID may be
+ *		  free, out of range or in another mode only
+ *
+ * @return
+ */
+static void fuzz_op_delete(void)
+{
+	uint8_t_ uint8_mode = fuzz_random_mode();
+	uint8_t_ uint8_task_id = (uint8_t_)bench_random(0, SOS_NUMBER_OF_TASK_IDS);
+	uint8_t_ uint8_index = fuzz_find_id(uint8_task_id);
+	enu_sos_status_t_ enu_expected;
+	enu_sos_status_t_ enu_got;
+	uint64_t_ uint64_ns;
+
+	if(SOS_NUMBER_OF_MODES <= uint8_mode)
+	{
+		enu_expected = SOS_STATUS_INVALID_MODE_ID;
+	}
+	else if(
+			(FUZZ_POOL_SIZE > uint8_index) &&
+			(TRUE == gl_arr_arr_bool_fuzz_in_mode[uint8_mode][uint8_index])
+			)
+	{
+		enu_expected = SOS_STATUS_SUCCESS;
+	}
+	else
+	{
+		enu_expected = SOS_STATUS_INVALID_TASK_ID;
+	}
+
+	uint64_ns	= bench_host_ns();
+	enu_got		= sos_mode_delete_task(uint8_mode, uint8_task_id);
+	gl_arr_uint64_fuzz_ns[FUZZ_OP_DELETE] += bench_host_ns() - uint64_ns;
+
+	fuzz_expect(enu_got, enu_expected);
+
+	if(
+			(SOS_STATUS_SUCCESS == enu_got) &&
+			(SOS_STATUS_SUCCESS == enu_expected)
+			)
+	{
+		gl_arr_arr_bool_fuzz_in_mode[uint8_mode][uint8_index] = FALSE;
+		gl_arr_uint8_fuzz_count[uint8_mode]--;
+		if(FALSE == fuzz_registered(uint8_index))
+		{
+			/* the ID is free again */
+			gl_arr_uint8_fuzz_id[uint8_index] = FUZZ_NO_ID;
+			gl_uint8_fuzz_ids_used--;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to give a task ID a new priority and period, the
+ *		  ID may be free or out of range
+ *
+ * @return
+ */
+static void fuzz_op_modify(void)
+{
+	uint8_t_ uint8_task_id = (uint8_t_)bench_random(0, SOS_NUMBER_OF_TASK_IDS);
+	uint8_t_ uint8_index = fuzz_find_id(uint8_task_id);
+	enu_sos_status_t_ enu_expected = SOS_STATUS_INVALID_TASK_ID;
+	enu_sos_status_t_ enu_got;
+	uint64_t_ uint64_ns;
+
+	if(FUZZ_POOL_SIZE > uint8_index)
+	{
+		gl_arr_str_fuzz_pool[uint8_index].uint8_task_priority		= (uint8_t_)bench_random(0, FUZZ_MAX_PRIORITY);
+		gl_arr_str_fuzz_pool[uint8_index].uint16_task_periodicity	= (uint16_t_)bench_random(1, FUZZ_MAX_PERIOD);
+		enu_expected = SOS_STATUS_SUCCESS;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	uint64_ns	= bench_host_ns();
+	enu_got		= sos_modify_task(uint8_task_id);
+	gl_arr_uint64_fuzz_ns[FUZZ_OP_MODIFY] += bench_host_ns() - uint64_ns;
+
+	fuzz_expect(enu_got, enu_expected);
+}
+
+/**
+ * @brief a private function to switch the active mode while SOS is stopped,
+ *		  the switch is applied at once
+ *
+ * @return
+ */
+static void fuzz_op_switch(void)
+{
+	uint8_t_ uint8_mode = fuzz_random_mode();
+	uint8_t_ uint8_point = (uint8_t_)bench_random(0, SOS_MODE_SWITCH_TOTAL);
+	enu_sos_status_t_ enu_expected;
+	enu_sos_status_t_ enu_got;
+	uint64_t_ uint64_ns;
+
+	if(SOS_NUMBER_OF_MODES <= uint8_mode)
+	{
+		enu_expected = SOS_STATUS_INVALID_MODE_ID;
+	}
+	else if(SOS_MODE_SWITCH_TOTAL <= uint8_point)
+	{
+		enu_expected = SOS_STATUS_INVALID_ARGS;
+	}
+	else
+	{
+		enu_expected = SOS_STATUS_SUCCESS;
+	}
+
+	uint64_ns	= bench_host_ns();
+	enu_got		= sos_switch_mode(uint8_mode, (enu_sos_mode_switch_t_)uint8_point);
+	gl_arr_uint64_fuzz_ns[FUZZ_OP_SWITCH] += bench_host_ns() - uint64_ns;
+
+	fuzz_expect(enu_got, enu_expected);
+
+	if(
+			(SOS_STATUS_SUCCESS == enu_got) &&
+			(SOS_STATUS_SUCCESS == enu_expected)
+			)
+	{
+		gl_uint8_fuzz_active_mode = uint8_mode;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to run SOS for a few ticks and check the jobs
+ *		  against the active mode of the model
+ *
+ * @param bool_disable : TRUE, the first job calls sos_disable
+ *
+ * @return
+ */
+static void fuzz_op_run(uint8_t_ bool_disable)
+{
+	enu_fuzz_op_t_ enu_op = (TRUE == bool_disable) ? FUZZ_OP_DISABLE : FUZZ_OP_RUN;
+	str_fuzz_job_t_ * ptr_str_job;
+	uint8_t_ uint8_index;
+	uint64_t_ uint64_ns;
+
+	gl_uint32_fuzz_jobs		= 0;
+	gl_bool_fuzz_disable	= bool_disable;
+
+	uint64_ns = bench_host_ns();
+	bench_sos_run_ticks(bench_random(1, FUZZ_MAX_RUN_TICKS));
+	gl_arr_uint64_fuzz_ns[enu_op] += bench_host_ns() - uint64_ns;
+
+	gl_bool_fuzz_disable = FALSE;
+
+	for(uint32_t_ uint32_job = 0; uint32_job < gl_uint32_fuzz_jobs; uint32_job++)
+	{
+		ptr_str_job = &gl_arr_str_fuzz_jobs[uint32_job];
+		uint8_index = fuzz_pool_index(ptr_str_job->ptr_str_task);
+
+		if(
+				(FUZZ_POOL_SIZE <= uint8_index) ||
+				(FALSE == gl_arr_arr_bool_fuzz_in_mode[gl_uint8_fuzz_active_mode][uint8_index])
+				)
+		{
+			fuzz_fail("a task out of the active mode ran");
+		}
+		else if(
+				(0 != uint32_job) &&
+				(ptr_str_job->uint32_tick == ptr_str_job[-1].uint32_tick) &&
+				(ptr_str_job->uint8_priority < ptr_str_job[-1].uint8_priority)
+				)
+		{
+			fuzz_fail("jobs of a tick ran out of priority order");
+		}
+		else if(
+				(TRUE == bool_disable) &&
+				(ptr_str_job->uint32_tick != gl_arr_str_fuzz_jobs[0].uint32_tick)
+				)
+		{
+			fuzz_fail("a job ran after sos_disable");
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+}
+
+/**
+ * @brief a private function to compare the task sets of every mode with the
+ *		  model and check their order and IDs
+ *
+ * @return
+ */
+static void fuzz_check(void)
+{
+	str_sos_task_t_ * arr_ptr_str_tasks[SOS_NUMBER_OF_TASKS];
+	uint8_t_ arr_bool_seen[FUZZ_POOL_SIZE];
+	uint8_t_ arr_bool_id_used[SOS_NUMBER_OF_TASK_IDS] = {FALSE};
+	uint8_t_ uint8_count = 0;
+	uint8_t_ uint8_mode;
+	uint8_t_ uint8_index;
+	uint8_t_ uint8_task_id;
+
+	if(
+			(SOS_STATUS_SUCCESS != sos_get_mode(&uint8_mode)) ||
+			(gl_uint8_fuzz_active_mode != uint8_mode)
+			)
+	{
+		fuzz_fail("active mode differs from the model");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint8_mode = 0; uint8_mode < SOS_NUMBER_OF_MODES; uint8_mode++)
+	{
+		for(uint8_index = 0; uint8_index < FUZZ_POOL_SIZE; uint8_index++)
+		{
+			arr_bool_seen[uint8_index] = FALSE;
+		}
+
+		if(SOS_STATUS_SUCCESS != sos_get_mode_tasks(uint8_mode, arr_ptr_str_tasks, &uint8_count))
+		{
+			fuzz_fail("mode task set not readable");
+			break;
+		}
+		else if(gl_arr_uint8_fuzz_count[uint8_mode] != uint8_count)
+		{
+			fuzz_fail("task count differs from the model");
+			break;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		for(uint8_t_ uint8_slot = 0; uint8_slot < SOS_NUMBER_OF_TASKS; uint8_slot++)
+		{
+			uint8_index = fuzz_pool_index(arr_ptr_str_tasks[uint8_slot]);
+
+			if(uint8_slot >= uint8_count)
+			{
+				if(NULL_PTR != arr_ptr_str_tasks[uint8_slot])
+				{
+					fuzz_fail("slot past the task count not empty");
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+			}
+			else if(
+					(FUZZ_POOL_SIZE <= uint8_index) ||
+					(FALSE == gl_arr_arr_bool_fuzz_in_mode[uint8_mode][uint8_index]) ||
+					(TRUE == arr_bool_seen[uint8_index])
+					)
+			{
+				fuzz_fail("task set differs from the model");
+			}
+			else if(
+					(0 != uint8_slot) &&
+					(arr_ptr_str_tasks[uint8_slot]->uint8_task_priority < arr_ptr_str_tasks[uint8_slot - 1]->uint8_task_priority)
+					)
+			{
+				fuzz_fail("task set out of priority order");
+			}
+			else
+			{
+				arr_bool_seen[uint8_index] = TRUE;
+			}
+		}
+	}
+
+	for(uint8_index = 0; uint8_index < FUZZ_POOL_SIZE; uint8_index++)
+	{
+		uint8_task_id = gl_arr_str_fuzz_pool[uint8_index].uint8_task_id;
+
+		if(FALSE == fuzz_registered(uint8_index))
+		{
+			/* Do Nothing */
+		}
+		else if(
+				(SOS_NUMBER_OF_TASK_IDS <= uint8_task_id) ||
+				(gl_arr_uint8_fuzz_id[uint8_index] != uint8_task_id)
+				)
+		{
+			fuzz_fail("task ID out of range or changed while registered");
+		}
+		else if(TRUE == arr_bool_id_used[uint8_task_id])
+		{
+			fuzz_fail("task ID given to two tasks");
+		}
+		else
+		{
+			arr_bool_id_used[uint8_task_id] = TRUE;
+		}
+	}
+}
+
+/**
+ * @brief a private function to compare a returned status with the model
+ *
+ * @param enu_got      : status returned by SOS
+ * @param enu_expected : status of the model
+ *
+ * @return
+ */
+static void fuzz_expect(enu_sos_status_t_ enu_got, enu_sos_status_t_ enu_expected)
+{
+	if(enu_got != enu_expected)
+	{
+		fprintf(stderr, "sos_fuzz: status %d, model %d\n", (int)enu_got, (int)enu_expected);
+		fuzz_fail("status differs from the model");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to report a violation with what reproduces it
+ *
+ * @param ptr_str_what : broken property
+ *
+ * @return
+ */
+static void fuzz_fail(const char * ptr_str_what)
+{
+	if(0 == gl_uint32_fuzz_violations)
+	{
+		fprintf(stderr, "sos_fuzz: seed 0x%lX op %lu (%s): %s\n", (unsigned long)gl_uint32_fuzz_seed,
+				(unsigned long)gl_uint32_fuzz_op_index, gl_arr_ptr_fuzz_op_names[gl_enu_fuzz_op], ptr_str_what);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	gl_uint32_fuzz_violations++;
+}
+
+/**
+ * @brief a private function to draw a mode ID, out of range now and then
+ *
+ * @return mode ID, SOS_NUMBER_OF_MODES when invalid
+ */
+static uint8_t_ fuzz_random_mode(void)
+{
+	return (0 == bench_random(0, FUZZ_INVALID_ONE_IN - 1)) ?
+		   SOS_NUMBER_OF_MODES :
+		   (uint8_t_)bench_random(0, SOS_NUMBER_OF_MODES - 1);
+}
+
+/**
+ * @brief a private function to get the pool index of a task
+ *
+ * @param ptr_str_task : task, may be NULL_PTR or out of the pool
+ *
+ * @return pool index, FUZZ_POOL_SIZE when not a pool task
+ */
+static uint8_t_ fuzz_pool_index(const str_sos_task_t_ * ptr_str_task)
+{
+	uint8_t_ uint8_retval = FUZZ_POOL_SIZE;
+
+	for(uint8_t_ uint8_index = 0; uint8_index < FUZZ_POOL_SIZE; uint8_index++)
+	{
+		if(&gl_arr_str_fuzz_pool[uint8_index] == ptr_str_task)
+		{
+			uint8_retval = uint8_index;
+			break;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	return uint8_retval;
+}
+
+/**
+ * @brief a private function to check whether a pool task is in any mode of
+ *		  the model
+ *
+ * @param uint8_index : pool index
+ *
+ * @return TRUE, FALSE
+ */
+static uint8_t_ fuzz_registered(uint8_t_ uint8_index)
+{
+	uint8_t_ bool_retval = FALSE;
+
+	for(uint8_t_ uint8_mode = 0; uint8_mode < SOS_NUMBER_OF_MODES; uint8_mode++)
+	{
+		bool_retval |= gl_arr_arr_bool_fuzz_in_mode[uint8_mode][uint8_index];
+	}
+
+	return bool_retval;
+}
+
+/**
+ * @brief a private function to find the pool task holding a task ID in the
+ *		  model
+ *
+ * @param uint8_task_id : task ID
+ *
+ * @return pool index, FUZZ_POOL_SIZE when the ID is free
+ */
+static uint8_t_ fuzz_find_id(uint8_t_ uint8_task_id)
+{
+	uint8_t_ uint8_retval = FUZZ_POOL_SIZE;
+
+	for(uint8_t_ uint8_index = 0; uint8_index < FUZZ_POOL_SIZE; uint8_index++)
+	{
+		if(uint8_task_id == gl_arr_uint8_fuzz_id[uint8_index])
+		{
+			uint8_retval = uint8_index;
+			break;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	return uint8_retval;
+}
+
+/**
+ * @brief a private function, body of every pool task, logs the job and
+ *		  stops SOS when a disable is armed
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ fuzz_task(void)
+{
+	str_sos_task_t_ * ptr_str_task = sos_get_running_task();
+
+	if(FUZZ_MAX_JOBS > gl_uint32_fuzz_jobs)
+	{
+		gl_arr_str_fuzz_jobs[gl_uint32_fuzz_jobs].ptr_str_task		= ptr_str_task;
+		gl_arr_str_fuzz_jobs[gl_uint32_fuzz_jobs].uint8_priority	= (NULL_PTR != ptr_str_task) ? ptr_str_task->uint8_task_priority : 0;
+		gl_arr_str_fuzz_jobs[gl_uint32_fuzz_jobs].uint32_tick		= sos_get_ticks();
+		gl_uint32_fuzz_jobs++;
+	}
+	else
+	{
+		fuzz_fail("more jobs than the run can release");
+	}
+
+	if(TRUE == gl_bool_fuzz_disable)
+	{
+		gl_bool_fuzz_disable = FALSE;
+		sos_disable();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
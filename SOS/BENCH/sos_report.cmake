@@ -0,0 +1,320 @@
+# @fileName	:	sos_report.cmake
+# @Created	: 	8:15 PM Sunday, October 18, 2026
+# @Author	: 	Hamsters
+# @brief	: 	Per module footprint and per API cost table (sos_report target)
+#
+# cmake -P script run by the sos_report target:
+#	SOS_REPORT_OBJECTS			objects of SOS_SOURCES, compiled with -fstack-usage
+#								and, when the compiler has it, -fcallgraph-info=su
+#	SOS_REPORT_OBJECT_ROOT		object directory, the module is the object path below it
+#	SOS_REPORT_SIZE				size tool of the objects (GNU size -A)
+#	SOS_REPORT_TARGET			label of the objects (MCU/compiler/options)
+#	SOS_REPORT_HOST				TRUE when the objects are host objects, not AVR ones
+#	SOS_REPORT_RODATA_IN_RAM	TRUE on AVR, constants are copied to RAM like .data
+#	SOS_REPORT_COST				sos_cost executable, empty for no API table
+#	SOS_REPORT_OUTPUT			table file
+#
+# A module is a source directory (MCAL/timer: timer_program.c + timer_cfg.c):
+#	flash	.text, .rodata and the .data initializers
+#	ram		.data and .bss (thread local on the host), .rodata on AVR
+#	stack	deepest call chain from a function of the module, the frames of
+#			the chain summed over the call graph of all the objects (x.c.ci)
+# Stack marks: "+" a frame of the chain is dynamic (alloca, VLA), "*" the
+# chain goes through a function pointer (task bodies, callbacks) or a
+# recursion, the frames behind it are not in the sum. Functions outside the
+# objects (libc, libgcc, the SIM register file of the host) count 0.
+# Without call graph files the column falls back to the largest frame.
+# Sizes are the ones of the objects, before the linker drops unused sections.
+# Sizes and stacks are the same on every run, the host ns of the API table
+# are not, compare them between runs of the same machine only.
+
+cmake_minimum_required(VERSION 3.25)
+
+set(SOS_REPORT_MODULES "")
+set(SOS_REPORT_TOTAL_FLASH 0)
+set(SOS_REPORT_TOTAL_RAM 0)
+set(SOS_REPORT_TOTAL_STACK 0)
+
+# left aligned cell, or right aligned when ALIGN is RIGHT
+function(sos_report_cell VAR TEXT WIDTH ALIGN)
+    string(LENGTH "${TEXT}" SOS_LENGTH)
+    set(SOS_CELL "${TEXT}")
+    while (SOS_LENGTH LESS WIDTH)
+        if (ALIGN STREQUAL "RIGHT")
+            string(PREPEND SOS_CELL " ")
+        else ()
+            string(APPEND SOS_CELL " ")
+        endif ()
+        math(EXPR SOS_LENGTH "${SOS_LENGTH} + 1")
+    endwhile ()
+    set(${VAR} "${SOS_CELL}" PARENT_SCOPE)
+endfunction()
+
+foreach (SOS_OBJECT IN LISTS SOS_REPORT_OBJECTS)
+    file(RELATIVE_PATH SOS_RELATIVE "${SOS_REPORT_OBJECT_ROOT}" "${SOS_OBJECT}")
+    get_filename_component(SOS_MODULE "${SOS_RELATIVE}" DIRECTORY)
+    string(MAKE_C_IDENTIFIER "${SOS_MODULE}" SOS_KEY)
+
+    if (NOT SOS_MODULE IN_LIST SOS_REPORT_MODULES)
+        list(APPEND SOS_REPORT_MODULES "${SOS_MODULE}")
+        set(SOS_FLASH_${SOS_KEY} 0)
+        set(SOS_RAM_${SOS_KEY} 0)
+        set(SOS_STACK_${SOS_KEY} 0)
+        set(SOS_DYNAMIC_${SOS_KEY} "")
+    endif ()
+
+    execute_process(COMMAND "${SOS_REPORT_SIZE}" -A "${SOS_OBJECT}"
+            OUTPUT_VARIABLE SOS_SIZE_OUTPUT
+            RESULT_VARIABLE SOS_RESULT)
+    if (NOT SOS_RESULT EQUAL 0)
+        message(FATAL_ERROR "sos_report: ${SOS_REPORT_SIZE} failed on ${SOS_OBJECT}")
+    endif ()
+
+    string(REPLACE "\n" ";" SOS_LINES "${SOS_SIZE_OUTPUT}")
+    foreach (SOS_LINE IN LISTS SOS_LINES)
+        if (SOS_LINE MATCHES "^(\\.[A-Za-z0-9_.$]+)[ \t]+([0-9]+)[ \t]+[0-9]+")
+            set(SOS_SECTION "${CMAKE_MATCH_1}")
+            set(SOS_BYTES "${CMAKE_MATCH_2}")
+            if (SOS_SECTION MATCHES "^\\.(text|progmem)")
+                math(EXPR SOS_FLASH_${SOS_KEY} "${SOS_FLASH_${SOS_KEY}} + ${SOS_BYTES}")
+            elseif (SOS_SECTION MATCHES "^\\.rodata")
+                math(EXPR SOS_FLASH_${SOS_KEY} "${SOS_FLASH_${SOS_KEY}} + ${SOS_BYTES}")
+                if (SOS_REPORT_RODATA_IN_RAM)
+                    math(EXPR SOS_RAM_${SOS_KEY} "${SOS_RAM_${SOS_KEY}} + ${SOS_BYTES}")
+                endif ()
+            elseif (SOS_SECTION MATCHES "^\\.t?data")
+                math(EXPR SOS_FLASH_${SOS_KEY} "${SOS_FLASH_${SOS_KEY}} + ${SOS_BYTES}")
+                math(EXPR SOS_RAM_${SOS_KEY} "${SOS_RAM_${SOS_KEY}} + ${SOS_BYTES}")
+            elseif (SOS_SECTION MATCHES "^\\.(t?bss|noinit)")
+                math(EXPR SOS_RAM_${SOS_KEY} "${SOS_RAM_${SOS_KEY}} + ${SOS_BYTES}")
+            else ()
+                # debug, unwind and note sections stay on the host
+            endif ()
+        endif ()
+    endforeach ()
+
+    # x.c.o -> x.c.su, next to the object
+    string(REGEX REPLACE "\\.(o|obj)$" ".su" SOS_STACK_FILE "${SOS_OBJECT}")
+    if (EXISTS "${SOS_STACK_FILE}")
+        file(STRINGS "${SOS_STACK_FILE}" SOS_FRAMES)
+        foreach (SOS_FRAME IN LISTS SOS_FRAMES)
+            if (SOS_FRAME MATCHES "\t([0-9]+)\t([a-z,]+)$")
+                if (CMAKE_MATCH_1 GREATER SOS_STACK_${SOS_KEY})
+                    set(SOS_STACK_${SOS_KEY} ${CMAKE_MATCH_1})
+                endif ()
+                if (CMAKE_MATCH_2 MATCHES "dynamic")
+                    set(SOS_DYNAMIC_${SOS_KEY} "+")
+                endif ()
+            endif ()
+        endforeach ()
+    else ()
+        message(WARNING "sos_report: no stack usage file for ${SOS_OBJECT}")
+    endif ()
+
+    # x.c.o -> x.c.ci, functions (title "name", "file:name" when static),
+    # their frame and their direct calls
+    string(REGEX REPLACE "\\.(o|obj)$" ".ci" SOS_GRAPH_FILE "${SOS_OBJECT}")
+    if (EXISTS "${SOS_GRAPH_FILE}")
+        set(SOS_REPORT_CALL_GRAPH TRUE)
+        file(STRINGS "${SOS_GRAPH_FILE}" SOS_GRAPH_LINES)
+        foreach (SOS_LINE IN LISTS SOS_GRAPH_LINES)
+            if (SOS_LINE MATCHES "^node: { title: \"([^\"]+)\" label: \"([^\"\\\\]+)\\\\n[^\"]*\\\\n([0-9]+) bytes \\(([a-z,]+)\\)\" }")
+                list(APPEND SOS_REPORT_FUNCTIONS "${CMAKE_MATCH_1}")
+                set_property(GLOBAL PROPERTY "SOS_CG_NAME_${CMAKE_MATCH_1}" "${CMAKE_MATCH_2}")
+                set_property(GLOBAL PROPERTY "SOS_CG_FRAME_${CMAKE_MATCH_1}" "${CMAKE_MATCH_3}")
+                set_property(GLOBAL PROPERTY "SOS_CG_MODULE_${CMAKE_MATCH_1}" "${SOS_MODULE}")
+                if (CMAKE_MATCH_4 MATCHES "dynamic")
+                    set_property(GLOBAL PROPERTY "SOS_CG_MARK_${CMAKE_MATCH_1}" "+")
+                endif ()
+            elseif (SOS_LINE MATCHES "^edge: { sourcename: \"([^\"]+)\" targetname: \"([^\"]+)\"")
+                set_property(GLOBAL APPEND PROPERTY "SOS_CG_CALLS_${CMAKE_MATCH_1}" "${CMAKE_MATCH_2}")
+            endif ()
+        endforeach ()
+    endif ()
+endforeach ()
+
+# deepest chain from a function: its frame plus the deepest of its callees
+function(sos_report_depth TITLE)
+    get_property(SOS_DONE GLOBAL PROPERTY "SOS_CG_DEPTH_${TITLE}" SET)
+    get_property(SOS_FRAME GLOBAL PROPERTY "SOS_CG_FRAME_${TITLE}")
+    get_property(SOS_VISITING GLOBAL PROPERTY "SOS_CG_VISIT_${TITLE}")
+    if (SOS_DONE)
+        get_property(SOS_DEPTH GLOBAL PROPERTY "SOS_CG_DEPTH_${TITLE}")
+        get_property(SOS_MARK GLOBAL PROPERTY "SOS_CG_CHAIN_MARK_${TITLE}")
+    elseif (TITLE STREQUAL "__indirect_call" OR SOS_VISITING)
+        set(SOS_DEPTH 0)
+        set(SOS_MARK "*")
+    elseif (SOS_FRAME STREQUAL "")
+        # outside the objects
+        set(SOS_DEPTH 0)
+        set(SOS_MARK "")
+    else ()
+        set_property(GLOBAL PROPERTY "SOS_CG_VISIT_${TITLE}" TRUE)
+        get_property(SOS_CALLS GLOBAL PROPERTY "SOS_CG_CALLS_${TITLE}")
+        get_property(SOS_OWN_MARK GLOBAL PROPERTY "SOS_CG_MARK_${TITLE}")
+        set(SOS_CALLEE_DEPTH 0)
+        set(SOS_CALLEE_MARK "")
+        set(SOS_INDIRECT "")
+        foreach (SOS_CALL IN LISTS SOS_CALLS)
+            sos_report_depth("${SOS_CALL}")
+            if (SOS_DEPTH GREATER SOS_CALLEE_DEPTH)
+                set(SOS_CALLEE_DEPTH ${SOS_DEPTH})
+                set(SOS_CALLEE_MARK "${SOS_MARK}")
+            endif ()
+            if (SOS_MARK MATCHES "\\*")
+                set(SOS_INDIRECT "*")
+            endif ()
+        endforeach ()
+        set_property(GLOBAL PROPERTY "SOS_CG_VISIT_${TITLE}" FALSE)
+
+        math(EXPR SOS_DEPTH "${SOS_FRAME} + ${SOS_CALLEE_DEPTH}")
+        set(SOS_MARK "")
+        if (SOS_OWN_MARK OR SOS_CALLEE_MARK MATCHES "\\+")
+            string(APPEND SOS_MARK "+")
+        endif ()
+        string(APPEND SOS_MARK "${SOS_INDIRECT}")
+        set_property(GLOBAL PROPERTY "SOS_CG_DEPTH_${TITLE}" ${SOS_DEPTH})
+        set_property(GLOBAL PROPERTY "SOS_CG_CHAIN_MARK_${TITLE}" "${SOS_MARK}")
+    endif ()
+    set(SOS_DEPTH ${SOS_DEPTH} PARENT_SCOPE)
+    set(SOS_MARK "${SOS_MARK}" PARENT_SCOPE)
+endfunction()
+
+# the module column takes the deepest chain of its functions
+if (SOS_REPORT_CALL_GRAPH)
+    foreach (SOS_MODULE IN LISTS SOS_REPORT_MODULES)
+        string(MAKE_C_IDENTIFIER "${SOS_MODULE}" SOS_KEY)
+        set(SOS_STACK_${SOS_KEY} 0)
+        set(SOS_DYNAMIC_${SOS_KEY} "")
+    endforeach ()
+    foreach (SOS_FUNCTION IN LISTS SOS_REPORT_FUNCTIONS)
+        sos_report_depth("${SOS_FUNCTION}")
+        get_property(SOS_MODULE GLOBAL PROPERTY "SOS_CG_MODULE_${SOS_FUNCTION}")
+        string(MAKE_C_IDENTIFIER "${SOS_MODULE}" SOS_KEY)
+        if (SOS_DEPTH GREATER SOS_STACK_${SOS_KEY})
+            set(SOS_STACK_${SOS_KEY} ${SOS_DEPTH})
+            set(SOS_DYNAMIC_${SOS_KEY} "${SOS_MARK}")
+        endif ()
+    endforeach ()
+endif ()
+
+list(SORT SOS_REPORT_MODULES)
+
+set(SOS_TABLE "SOS module report, ${SOS_REPORT_TARGET}\n")
+if (SOS_REPORT_HOST)
+    string(APPEND SOS_TABLE "HOST OBJECTS, NOT the ATmega32A: host code sizes and frames, install avr-gcc for the target\n")
+endif ()
+if (SOS_REPORT_CALL_GRAPH)
+    set(SOS_STACK_COLUMN "stack")
+    string(APPEND SOS_TABLE "flash/ram: object sections in bytes, stack: deepest call chain in bytes, frames summed\n")
+    string(APPEND SOS_TABLE "+ a dynamic frame on the chain, * calls through a pointer or recursion not counted\n\n")
+else ()
+    set(SOS_STACK_COLUMN "max frame")
+    string(APPEND SOS_TABLE "flash/ram: object sections in bytes, max frame: largest function frame, call chains not summed\n")
+    string(APPEND SOS_TABLE "(the compiler has no -fcallgraph-info), + a dynamic frame\n\n")
+endif ()
+
+sos_report_cell(SOS_C1 "module" 24 LEFT)
+sos_report_cell(SOS_C2 "flash" 8 RIGHT)
+sos_report_cell(SOS_C3 "ram" 8 RIGHT)
+sos_report_cell(SOS_C4 "${SOS_STACK_COLUMN}" 12 RIGHT)
+string(APPEND SOS_TABLE "${SOS_C1}${SOS_C2}${SOS_C3}${SOS_C4}\n")
+
+set(SOS_REPORT_TOTAL_MARK "")
+foreach (SOS_MODULE IN LISTS SOS_REPORT_MODULES)
+    string(MAKE_C_IDENTIFIER "${SOS_MODULE}" SOS_KEY)
+    math(EXPR SOS_REPORT_TOTAL_FLASH "${SOS_REPORT_TOTAL_FLASH} + ${SOS_FLASH_${SOS_KEY}}")
+    math(EXPR SOS_REPORT_TOTAL_RAM "${SOS_REPORT_TOTAL_RAM} + ${SOS_RAM_${SOS_KEY}}")
+    if (SOS_STACK_${SOS_KEY} GREATER SOS_REPORT_TOTAL_STACK)
+        set(SOS_REPORT_TOTAL_STACK ${SOS_STACK_${SOS_KEY}})
+        set(SOS_REPORT_TOTAL_MARK "${SOS_DYNAMIC_${SOS_KEY}}")
+    endif ()
+
+    sos_report_cell(SOS_C1 "${SOS_MODULE}" 24 LEFT)
+    sos_report_cell(SOS_C2 "${SOS_FLASH_${SOS_KEY}}" 8 RIGHT)
+    sos_report_cell(SOS_C3 "${SOS_RAM_${SOS_KEY}}" 8 RIGHT)
+    sos_report_cell(SOS_C4 "${SOS_STACK_${SOS_KEY}}${SOS_DYNAMIC_${SOS_KEY}}" 12 RIGHT)
+    string(APPEND SOS_TABLE "${SOS_C1}${SOS_C2}${SOS_C3}${SOS_C4}\n")
+endforeach ()
+
+sos_report_cell(SOS_C1 "total" 24 LEFT)
+sos_report_cell(SOS_C2 "${SOS_REPORT_TOTAL_FLASH}" 8 RIGHT)
+sos_report_cell(SOS_C3 "${SOS_REPORT_TOTAL_RAM}" 8 RIGHT)
+sos_report_cell(SOS_C4 "${SOS_REPORT_TOTAL_STACK}${SOS_REPORT_TOTAL_MARK}" 12 RIGHT)
+string(APPEND SOS_TABLE "${SOS_C1}${SOS_C2}${SOS_C3}${SOS_C4}\n")
+
+# worst case stack of every public function (title without a "file:" prefix)
+if (SOS_REPORT_CALL_GRAPH)
+    string(APPEND SOS_TABLE "\nstack per public function, deepest call chain in bytes, same marks\n\n")
+    sos_report_cell(SOS_C1 "function" 32 LEFT)
+    sos_report_cell(SOS_C2 "module" 24 LEFT)
+    sos_report_cell(SOS_C3 "stack" 8 RIGHT)
+    string(APPEND SOS_TABLE "${SOS_C1}${SOS_C2}${SOS_C3}\n")
+
+    set(SOS_REPORT_PUBLIC "")
+    foreach (SOS_FUNCTION IN LISTS SOS_REPORT_FUNCTIONS)
+        if (NOT SOS_FUNCTION MATCHES ":")
+            list(APPEND SOS_REPORT_PUBLIC "${SOS_FUNCTION}")
+        endif ()
+    endforeach ()
+    list(SORT SOS_REPORT_PUBLIC)
+
+    foreach (SOS_FUNCTION IN LISTS SOS_REPORT_PUBLIC)
+        sos_report_depth("${SOS_FUNCTION}")
+        get_property(SOS_MODULE GLOBAL PROPERTY "SOS_CG_MODULE_${SOS_FUNCTION}")
+        sos_report_cell(SOS_C1 "${SOS_FUNCTION}" 32 LEFT)
+        sos_report_cell(SOS_C2 "${SOS_MODULE}" 24 LEFT)
+        sos_report_cell(SOS_C3 "${SOS_DEPTH}${SOS_MARK}" 8 RIGHT)
+        string(APPEND SOS_TABLE "${SOS_C1}${SOS_C2}${SOS_C3}\n")
+    endforeach ()
+endif ()
+
+# sos_cost rows: cost,kernel,n,-,api,access_cycles|host_ns|net_ns,value
+if (SOS_REPORT_COST)
+    execute_process(COMMAND "${SOS_REPORT_COST}"
+            OUTPUT_VARIABLE SOS_COST_OUTPUT
+            RESULT_VARIABLE SOS_RESULT)
+    if (NOT SOS_RESULT EQUAL 0)
+        message(FATAL_ERROR "sos_report: ${SOS_REPORT_COST} failed")
+    endif ()
+
+    string(REPLACE "\n" ";" SOS_LINES "${SOS_COST_OUTPUT}")
+    set(SOS_COST_APIS "")
+    foreach (SOS_LINE IN LISTS SOS_LINES)
+        if (SOS_LINE MATCHES "^cost,([a-z]+),([0-9]+),[^,]*,([^,]+),(access_cycles|host_ns|net_ns),([0-9.]+)$")
+            set(SOS_COST_KERNEL "${CMAKE_MATCH_1}")
+            string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_3}" SOS_KEY)
+            if (NOT CMAKE_MATCH_3 IN_LIST SOS_COST_APIS)
+                list(APPEND SOS_COST_APIS "${CMAKE_MATCH_3}")
+                set(SOS_COST_CALLS_${SOS_KEY} "${CMAKE_MATCH_2}")
+            endif ()
+            set(SOS_COST_${CMAKE_MATCH_4}_${SOS_KEY} "${CMAKE_MATCH_5}")
+        endif ()
+    endforeach ()
+
+    if (SOS_COST_APIS)
+        string(APPEND SOS_TABLE "\ncost per call, host simulator, ${SOS_COST_KERNEL} kernel\n")
+        string(APPEND SOS_TABLE "register-access cycles: SIM cycles of the register accesses and critical sections\n")
+        string(APPEND SOS_TABLE "only, the code between them is not charged, it is NOT the CPU cost of the call\n")
+        string(APPEND SOS_TABLE "host ns: host time of the call with the simulator under it, net ns: the same\n")
+        string(APPEND SOS_TABLE "without the simulated accesses and the clock reads, the computation of the call\n")
+        string(APPEND SOS_TABLE "(host CPU, not AVR), both change from run to run\n\n")
+        sos_report_cell(SOS_C1 "api" 32 LEFT)
+        sos_report_cell(SOS_C2 "calls" 8 RIGHT)
+        sos_report_cell(SOS_C3 "register-access cycles" 24 RIGHT)
+        sos_report_cell(SOS_C4 "host ns" 12 RIGHT)
+        sos_report_cell(SOS_C5 "net ns" 12 RIGHT)
+        string(APPEND SOS_TABLE "${SOS_C1}${SOS_C2}${SOS_C3}${SOS_C4}${SOS_C5}\n")
+    endif ()
+    foreach (SOS_API IN LISTS SOS_COST_APIS)
+        string(MAKE_C_IDENTIFIER "${SOS_API}" SOS_KEY)
+        sos_report_cell(SOS_C1 "${SOS_API}" 32 LEFT)
+        sos_report_cell(SOS_C2 "${SOS_COST_CALLS_${SOS_KEY}}" 8 RIGHT)
+        sos_report_cell(SOS_C3 "${SOS_COST_access_cycles_${SOS_KEY}}" 24 RIGHT)
+        sos_report_cell(SOS_C4 "${SOS_COST_host_ns_${SOS_KEY}}" 12 RIGHT)
+        sos_report_cell(SOS_C5 "${SOS_COST_net_ns_${SOS_KEY}}" 12 RIGHT)
+        string(APPEND SOS_TABLE "${SOS_C1}${SOS_C2}${SOS_C3}${SOS_C4}${SOS_C5}\n")
+    endforeach ()
+endif ()
+
+file(WRITE "${SOS_REPORT_OUTPUT}" "${SOS_TABLE}")
@@ -0,0 +1,313 @@
+/**
+ * @fileName	:	sos_rt.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Tick jitter of the SOS run as a real time Linux process
+ *
+ * usage: sos_rt [results.csv] [seconds per run] [SCHED_FIFO priority]
+ *
+ * The simulator runs in real time (sim_set_realtime): TIMER_0 raises the SOS
+ * tick every SOS_SYS_TICK_TIME_MS of host time and sos_run sleeps on a
+ * timerfd while nothing is due. A generated task set due every tick loads the
+ * CPU to RT_LOAD_PERCENT (busy waits) and a monitor task (priority 0, every
+ * tick) takes the host time of every tick it runs in, so the jitter is the
+ * one of the tick and the scheduler pass, not of the load. One run under the
+ * default policy, one under SCHED_FIFO with the memory locked, skipped if the
+ * process may not use it (root or CAP_SYS_NICE).
+ * Rows, param is the policy, n the generated tasks:
+ * 			ticks					ticks the monitor ran in
+ * 			lost_ticks				ticks it did not run in
+ * 			interval_min/max_us		between the jobs of two ticks in a row
+ * 			jitter_avg/p99/max_us	|time between two monitor jobs - their ticks
+ * 									* SOS_SYS_TICK_TIME_MS|
+ * 			wake_late_min/avg/max_us	timerfd wake-ups of the idle MCU after the
+ * 									event, the latency of the host
+ */
+
+#define _POSIX_C_SOURCE		200809L		/* sched_setscheduler, mlockall */
+
+#include <errno.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "bench_interface.h"
+#include "sim_interface.h"
+#include "sim_cfg.h"
+
+#define RT_SEED							0x7171u
+#define RT_DEFAULT_SECONDS				10
+#define RT_DEFAULT_FIFO_PRIORITY		80
+#define RT_LOAD_TASKS					4
+#define RT_LOAD_PERCENT					50
+#define RT_LOAD_DIST					BENCH_DIST_DUE		/* jobs shorter than a tick, the monitor runs first every tick */
+#define RT_MONITOR_ID					(SOS_NUMBER_OF_TASK_IDS - 1)
+#define RT_TICK_NS						((uint64_t_)SOS_SYS_TICK_TIME_MS * 1000000ULL)
+
+/* One tick seen by the monitor */
+typedef struct
+{
+	uint32_t_	uint32_tick;
+	uint64_t_	uint64_ns;
+}str_rt_sample_t_;
+
+static void			rt_run					(const char * ptr_str_policy, uint32_t_ uint32_ticks);
+static uint16_t_	rt_load_task			(void);
+static uint16_t_	rt_monitor				(void);
+static int			rt_compare				(const void * ptr_a, const void * ptr_b);
+
+static str_bench_task_spec_t_	gl_arr_str_rt_specs[RT_LOAD_TASKS];
+static str_sos_task_t_			gl_arr_str_rt_tasks[RT_LOAD_TASKS];
+static str_sos_task_t_			gl_str_rt_monitor;
+static str_rt_sample_t_ *		gl_ptr_str_rt_samples = NULL_PTR;
+static uint32_t_				gl_uint32_rt_max_samples = 0;
+static uint32_t_				gl_uint32_rt_samples = 0;
+
+
+int main(int argc, char * argv[])
+{
+	struct sched_param str_param = {0};
+	uint32_t_ uint32_seconds = (argc > 2) ? (uint32_t_)strtoul(argv[2], NULL_PTR, 0) : RT_DEFAULT_SECONDS;
+	uint32_t_ uint32_ticks;
+	char arr_char_policy[16];
+	int sint_retval = 0;
+
+	uint32_seconds	= (0 != uint32_seconds) ? uint32_seconds : 1;
+	uint32_ticks	= (uint32_seconds * 1000UL) / SOS_SYS_TICK_TIME_MS;
+	str_param.sched_priority = (argc > 3) ? (int)strtol(argv[3], NULL_PTR, 0) : RT_DEFAULT_FIFO_PRIORITY;
+
+	/* a job late by more than a tick still lands in the next sample */
+	gl_uint32_rt_max_samples	= uint32_ticks + 2;
+	gl_ptr_str_rt_samples		= malloc(gl_uint32_rt_max_samples * sizeof(str_rt_sample_t_));
+
+	if(NULL_PTR == gl_ptr_str_rt_samples)
+	{
+		fprintf(stderr, "sos_rt: out of memory\n");
+		return 1;
+	}
+	else if(FALSE == bench_open((argc > 1) ? argv[1] : NULL_PTR))
+	{
+		fprintf(stderr, "sos_rt: can not open %s\n", argv[1]);
+		return 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* a trace or an input log would be written from the timed path */
+	unsetenv(SIM_TRACE_ENV);
+	unsetenv(SIM_RECORD_ENV);
+	unsetenv(SIM_REPLAY_ENV);
+
+	rt_run("other", uint32_ticks);
+
+	if(
+			(0 == mlockall(MCL_CURRENT | MCL_FUTURE)) &&
+			(0 == sched_setscheduler(0, SCHED_FIFO, &str_param))
+			)
+	{
+		snprintf(arr_char_policy, sizeof(arr_char_policy), "fifo%d", str_param.sched_priority);
+		rt_run(arr_char_policy, uint32_ticks);
+
+		str_param.sched_priority = 0;
+		(void)sched_setscheduler(0, SCHED_OTHER, &str_param);
+		(void)munlockall();
+	}
+	else
+	{
+		fprintf(stderr, "sos_rt: SCHED_FIFO run skipped, %s\n", strerror(errno));
+		sint_retval = 2;
+	}
+
+	bench_close();
+	free(gl_ptr_str_rt_samples);
+
+	return sint_retval;
+}
+
+/**
+ * @brief a private function to run the loaded SOS in real time under the
+ *		  current policy and write its rows
+ *
+ * @param ptr_str_policy : policy name for the rows
+ * @param uint32_ticks   : ticks to run
+ *
+ * @return
+ */
+static void rt_run(const char * ptr_str_policy, uint32_t_ uint32_ticks)
+{
+	str_sim_realtime_stats_t_ str_wake;
+	f64_t_ * ptr_f64_jitter;
+	f64_t_ f64_interval;
+	f64_t_ f64_jitter;
+	f64_t_ f64_jitter_total = 0.0;
+	f64_t_ f64_interval_min = 0.0;
+	f64_t_ f64_interval_max = 0.0;
+	uint32_t_ uint32_gap;
+	uint32_t_ uint32_lost = 0;
+	uint32_t_ uint32_count = 0;
+
+	bench_seed(RT_SEED);
+	if(FALSE == bench_sos_start())
+	{
+		fprintf(stderr, "sos_rt: SOS start failed\n");
+		exit(1);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_generate_taskset(gl_arr_str_rt_specs, RT_LOAD_TASKS, RT_LOAD_PERCENT / 100.0,
+						   RT_LOAD_DIST, BENCH_PRIO_RM, 1);
+	for(uint8_t_ uint8_index = 0; uint8_index < RT_LOAD_TASKS; uint8_index++)
+	{
+		gl_arr_str_rt_tasks[uint8_index] = (str_sos_task_t_){0};
+		gl_arr_str_rt_tasks[uint8_index].uint8_task_id				= uint8_index;
+		gl_arr_str_rt_tasks[uint8_index].uint8_task_priority		= gl_arr_str_rt_specs[uint8_index].uint8_priority;
+		gl_arr_str_rt_tasks[uint8_index].uint16_task_periodicity	= gl_arr_str_rt_specs[uint8_index].uint16_period;
+		gl_arr_str_rt_tasks[uint8_index].ptr_func_task				= rt_load_task;
+		sos_create_task(&gl_arr_str_rt_tasks[uint8_index]);
+	}
+
+	gl_str_rt_monitor = (str_sos_task_t_){0};
+	gl_str_rt_monitor.uint8_task_id				= RT_MONITOR_ID;
+	gl_str_rt_monitor.uint8_task_priority		= 0;
+	gl_str_rt_monitor.uint16_task_periodicity	= 1;
+	gl_str_rt_monitor.ptr_func_task				= rt_monitor;
+	sos_create_task(&gl_str_rt_monitor);
+
+	gl_uint32_rt_samples = 0;
+	if(FALSE == sim_set_realtime(TRUE))
+	{
+		fprintf(stderr, "sos_rt: no real time clock\n");
+		exit(1);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	bench_sos_run_ticks(uint32_ticks);
+	sim_get_realtime_stats(&str_wake);
+	(void)sim_set_realtime(FALSE);
+	bench_sos_stop();
+
+	ptr_f64_jitter = malloc(gl_uint32_rt_max_samples * sizeof(f64_t_));
+	for(uint32_t_ uint32_index = 1; (NULL_PTR != ptr_f64_jitter) && (uint32_index < gl_uint32_rt_samples); uint32_index++)
+	{
+		uint32_gap		= gl_ptr_str_rt_samples[uint32_index].uint32_tick - gl_ptr_str_rt_samples[uint32_index - 1].uint32_tick;
+		f64_interval	= (f64_t_)(gl_ptr_str_rt_samples[uint32_index].uint64_ns - gl_ptr_str_rt_samples[uint32_index - 1].uint64_ns);
+		f64_jitter		= f64_interval - ((f64_t_)uint32_gap * RT_TICK_NS);
+		f64_jitter		= (f64_jitter < 0.0) ? -f64_jitter : f64_jitter;
+
+		ptr_f64_jitter[uint32_count++]	= f64_jitter;
+		f64_jitter_total				+= f64_jitter;
+		uint32_lost						+= uint32_gap - 1;
+
+		if(1 == uint32_gap)
+		{
+			f64_interval_min = ((0.0 == f64_interval_min) || (f64_interval < f64_interval_min)) ? f64_interval : f64_interval_min;
+			f64_interval_max = (f64_interval > f64_interval_max) ? f64_interval : f64_interval_max;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	if(0 != uint32_count)
+	{
+		qsort(ptr_f64_jitter, uint32_count, sizeof(f64_t_), rt_compare);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "ticks", gl_uint32_rt_samples);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "lost_ticks", uint32_lost);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "interval_min_us", f64_interval_min / 1000.0);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "interval_max_us", f64_interval_max / 1000.0);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "jitter_avg_us",
+			   (0 != uint32_count) ? f64_jitter_total / uint32_count / 1000.0 : 0.0);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "jitter_p99_us",
+			   (0 != uint32_count) ? ptr_f64_jitter[((uint32_count - 1) * 99) / 100] / 1000.0 : 0.0);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "jitter_max_us",
+			   (0 != uint32_count) ? ptr_f64_jitter[uint32_count - 1] / 1000.0 : 0.0);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "wake_late_min_us",
+			   (0 != str_wake.uint32_wakes) ? str_wake.uint32_late_min_ns / 1000.0 : 0.0);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "wake_late_avg_us",
+			   (0 != str_wake.uint32_wakes) ? (f64_t_)str_wake.uint64_late_total_ns / str_wake.uint32_wakes / 1000.0 : 0.0);
+	bench_emit("rt", RT_LOAD_TASKS, bench_dist_name(RT_LOAD_DIST), ptr_str_policy, "wake_late_max_us", str_wake.uint32_late_max_ns / 1000.0);
+
+	free(ptr_f64_jitter);
+}
+
+/**
+ * @brief a private function, body of every load task, busy waits for the
+ *		  execution time of the job, the tick interrupt is served meanwhile
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ rt_load_task(void)
+{
+	uint8_t_ uint8_index = (uint8_t_)(sos_get_running_task() - gl_arr_str_rt_tasks);
+
+	if(RT_LOAD_TASKS > uint8_index)
+	{
+		sim_consume_cycles(gl_arr_str_rt_specs[uint8_index].uint32_wcet_cycles);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
+
+/**
+ * @brief a private function, body of the monitor task, takes the host time
+ *		  of the first job of every tick
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ rt_monitor(void)
+{
+	uint64_t_ uint64_ns = bench_host_ns();
+	uint32_t_ uint32_tick = sos_get_ticks();
+
+	if(
+			(gl_uint32_rt_samples < gl_uint32_rt_max_samples) &&
+			(
+					(0 == gl_uint32_rt_samples) ||
+					(uint32_tick != gl_ptr_str_rt_samples[gl_uint32_rt_samples - 1].uint32_tick)
+					)
+			)
+	{
+		gl_ptr_str_rt_samples[gl_uint32_rt_samples].uint32_tick	= uint32_tick;
+		gl_ptr_str_rt_samples[gl_uint32_rt_samples].uint64_ns	= uint64_ns;
+		gl_uint32_rt_samples++;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
+
+/**
+ * @brief a private function, qsort order of the jitter samples
+ *
+ * @return -1, 0, 1
+ */
+static int rt_compare(const void * ptr_a, const void * ptr_b)
+{
+	f64_t_ f64_a = *(const f64_t_ *)ptr_a;
+	f64_t_ f64_b = *(const f64_t_ *)ptr_b;
+
+	return (f64_a > f64_b) - (f64_a < f64_b);
+}
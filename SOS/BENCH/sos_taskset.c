@@ -0,0 +1,361 @@
+/**
+ * @fileName	:	sos_taskset.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Scheduler stress runs of generated task sets on the host simulator
+ *
+ * usage: sos_taskset [results.csv]
+ *
+ * Every configuration, period distribution x priority assignment x task count
+ * x total utilization x execution time, runs TASKSET_SETS task sets made by
+ * bench_generate_taskset (UUniFast) through sos_create_task and sos_run.
+ * Jobs charge their execution time in slices so the tick interrupt is served
+ * on time, "var" jobs run 50 -> 100 % of their wcet.
+ * A monitor task (priority 0, every tick) records the ticks it ran in, a
+ * tick it missed is a lost tick: the tick interrupt or the scheduler pass of
+ * that tick never happened on time.
+ * Rows, param is "<priority>_u<utilization>_<execution>":
+ * 			deadline_misses			sos_get_deadline_stats misses per set
+ * 			jobs_dropped			releases skipped by a late task per set, jobs run
+ * 									short of the whole periods of the run
+ * 			miss_ratio				misses / jobs run
+ * 			sets_missing			share of the sets with at least one miss
+ * 			lost_ticks_avg/max		per set
+ * 			utilization				measured execution time / run time
+ * 			overhead_cycles_per_tick	simulated cycles not charged by the jobs, the
+ * 									scheduler, tick ISR and monitor register work
+ * 			conformance_missing/extra/out_of_order	per set, faults of the schedule
+ * 									conformance monitor (SERV/scm, on in this build),
+ * 									missing counts the releases SOS dropped (lost ticks
+ * 									and jobs_dropped, which also counts a job still
+ * 									pending at the end), the others stay 0
+ * The host time of the scheduler code is measured by sos_bench, the job
+ * slices of a loaded run would hide it.
+ */
+
+#include <stdio.h>
+
+#include "bench_interface.h"
+#include "sim_interface.h"
+#include "scm_interface.h"
+
+#define TASKSET_SEED					0x5EEDu
+#define TASKSET_SETS					10
+#define TASKSET_TICKS					500
+#define TASKSET_SLICE_CYCLES			2000UL		/* 250 us at 8 MHz, tick interrupt latency of a job */
+#define TASKSET_MONITOR_ID				(SOS_NUMBER_OF_TASK_IDS - 1)
+#define TASKSET_MAX_TASKS				(SOS_NUMBER_OF_TASKS - 1)
+#define TASKSET_VAR_MIN_PERCENT			50
+
+/* Execution time of the jobs */
+typedef enum
+{
+	TASKSET_EXEC_WCET				= 0	,	/* every job runs its wcet			*/
+	TASKSET_EXEC_VAR					,	/* uniform 50 -> 100 % of its wcet	*/
+	TASKSET_EXEC_TOTAL
+}enu_taskset_exec_t_;
+
+/* Results of the sets of one configuration */
+typedef struct
+{
+	uint32_t_	uint32_misses;
+	uint32_t_	uint32_dropped;
+	uint32_t_	uint32_jobs;
+	uint32_t_	uint32_sets_missing;
+	uint32_t_	uint32_lost_ticks;
+	uint32_t_	uint32_max_lost_ticks;
+	uint64_t_	uint64_work_cycles;
+	uint64_t_	uint64_run_cycles;
+	uint64_t_	uint64_overhead_cycles;
+	uint32_t_	uint32_conf_missing;
+	uint32_t_	uint32_conf_extra;
+	uint32_t_	uint32_conf_out_of_order;
+}str_taskset_result_t_;
+
+static void			taskset_run_config		(uint8_t_ uint8_n, enu_bench_dist_t_ enu_dist, enu_bench_prio_t_ enu_prio,
+											 uint8_t_ uint8_percent, enu_taskset_exec_t_ enu_exec);
+static void			taskset_run_set			(uint8_t_ uint8_n, str_taskset_result_t_ * ptr_str_result);
+static uint16_t_	taskset_task			(void);
+static uint16_t_	taskset_monitor			(void);
+
+static str_bench_task_spec_t_	gl_arr_str_taskset_specs[TASKSET_MAX_TASKS];
+static str_sos_task_t_			gl_arr_str_taskset_tasks[TASKSET_MAX_TASKS];
+static str_sos_task_t_			gl_str_taskset_monitor;
+static uint32_t_				gl_arr_uint32_taskset_jobs[TASKSET_MAX_TASKS];
+static enu_taskset_exec_t_		gl_enu_taskset_exec = TASKSET_EXEC_WCET;
+static uint64_t_				gl_uint64_taskset_work = 0;
+
+/* monitor, ticks seen since the run started */
+static uint32_t_				gl_uint32_taskset_first_tick = 0;
+static uint32_t_				gl_uint32_taskset_last_tick = 0;
+static uint32_t_				gl_uint32_taskset_ticks_seen = 0;
+
+static const char * const gl_arr_ptr_taskset_exec_names[TASKSET_EXEC_TOTAL] =
+{
+		"wcet", "var"
+};
+
+
+int main(int argc, char * argv[])
+{
+	static const uint8_t_ arr_uint8_counts[]	= {2, 4, 8, TASKSET_MAX_TASKS};
+	static const uint8_t_ arr_uint8_percents[]	= {30, 50, 70, 80, 90, 100};
+	static const enu_bench_dist_t_ arr_enu_dists[] = {BENCH_DIST_HARMONIC, BENCH_DIST_RANDOM};
+
+	if(FALSE == bench_open((argc > 1) ? argv[1] : NULL_PTR))
+	{
+		fprintf(stderr, "sos_taskset: can not open %s\n", argv[1]);
+		return 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_seed(TASKSET_SEED);
+
+	for(uint8_t_ uint8_dist = 0; uint8_dist < (sizeof(arr_enu_dists) / sizeof(arr_enu_dists[0])); uint8_dist++)
+	{
+		for(uint8_t_ uint8_prio = 0; uint8_prio < BENCH_PRIO_TOTAL; uint8_prio++)
+		{
+			for(uint8_t_ uint8_count = 0; uint8_count < sizeof(arr_uint8_counts); uint8_count++)
+			{
+				for(uint8_t_ uint8_percent = 0; uint8_percent < sizeof(arr_uint8_percents); uint8_percent++)
+				{
+					for(uint8_t_ uint8_exec = 0; uint8_exec < TASKSET_EXEC_TOTAL; uint8_exec++)
+					{
+						taskset_run_config(arr_uint8_counts[uint8_count], arr_enu_dists[uint8_dist],
+										   (enu_bench_prio_t_)uint8_prio, arr_uint8_percents[uint8_percent],
+										   (enu_taskset_exec_t_)uint8_exec);
+					}
+				}
+			}
+		}
+	}
+
+	bench_close();
+
+	return 0;
+}
+
+/**
+ * @brief a private function to run the task sets of one configuration and
+ *		  write its rows
+ *
+ * @return
+ */
+static void taskset_run_config(uint8_t_ uint8_n, enu_bench_dist_t_ enu_dist, enu_bench_prio_t_ enu_prio,
+							   uint8_t_ uint8_percent, enu_taskset_exec_t_ enu_exec)
+{
+	str_taskset_result_t_ str_result = {0};
+	const char * ptr_str_dist = bench_dist_name(enu_dist);
+	char arr_char_param[24];
+	f64_t_ f64_sets = TASKSET_SETS;
+	f64_t_ f64_ticks = (f64_t_)TASKSET_SETS * TASKSET_TICKS;
+
+	snprintf(arr_char_param, sizeof(arr_char_param), "%s_u%u.%02u_%s", bench_prio_name(enu_prio),
+			 uint8_percent / 100, uint8_percent % 100, gl_arr_ptr_taskset_exec_names[enu_exec]);
+
+	gl_enu_taskset_exec = enu_exec;
+
+	for(uint8_t_ uint8_set = 0; uint8_set < TASKSET_SETS; uint8_set++)
+	{
+		bench_generate_taskset(gl_arr_str_taskset_specs, uint8_n, uint8_percent / 100.0, enu_dist, enu_prio, 1);
+		taskset_run_set(uint8_n, &str_result);
+	}
+
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "deadline_misses",
+			   str_result.uint32_misses / f64_sets);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "jobs_dropped",
+			   str_result.uint32_dropped / f64_sets);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "miss_ratio",
+			   (0 != str_result.uint32_jobs) ? (f64_t_)str_result.uint32_misses / str_result.uint32_jobs : 0.0);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "sets_missing",
+			   str_result.uint32_sets_missing / f64_sets);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "lost_ticks_avg",
+			   str_result.uint32_lost_ticks / f64_sets);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "lost_ticks_max",
+			   (f64_t_)str_result.uint32_max_lost_ticks);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "utilization",
+			   (0 != str_result.uint64_run_cycles) ?
+					   (f64_t_)str_result.uint64_work_cycles / str_result.uint64_run_cycles : 0.0);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "overhead_cycles_per_tick",
+			   str_result.uint64_overhead_cycles / f64_ticks);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "conformance_missing",
+			   str_result.uint32_conf_missing / f64_sets);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "conformance_extra",
+			   str_result.uint32_conf_extra / f64_sets);
+	bench_emit("taskset", uint8_n, ptr_str_dist, arr_char_param, "conformance_out_of_order",
+			   str_result.uint32_conf_out_of_order / f64_sets);
+}
+
+/**
+ * @brief a private function to create the generated tasks and the monitor,
+ *		  run them for TASKSET_TICKS and add the results of the set
+ *
+ * @return
+ */
+static void taskset_run_set(uint8_t_ uint8_n, str_taskset_result_t_ * ptr_str_result)
+{
+	str_sos_deadline_stats_t_ str_stats;
+	str_scm_stats_t_ str_conformance;
+	uint64_t_ uint64_cycles;
+	uint64_t_ uint64_busy;
+	uint64_t_ uint64_overhead;
+	uint32_t_ uint32_expected;
+	uint32_t_ uint32_misses = 0;
+	uint32_t_ uint32_lost;
+
+	if(FALSE == bench_sos_start())
+	{
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	gl_str_taskset_monitor = (str_sos_task_t_){0};
+	gl_str_taskset_monitor.uint8_task_id			= TASKSET_MONITOR_ID;
+	gl_str_taskset_monitor.uint8_task_priority		= 0;
+	gl_str_taskset_monitor.uint16_task_periodicity	= 1;
+	gl_str_taskset_monitor.ptr_func_task			= taskset_monitor;
+	sos_create_task(&gl_str_taskset_monitor);
+
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		gl_arr_str_taskset_tasks[uint8_index] = (str_sos_task_t_){0};
+		gl_arr_str_taskset_tasks[uint8_index].uint8_task_id				= uint8_index;
+		gl_arr_str_taskset_tasks[uint8_index].uint8_task_priority		= gl_arr_str_taskset_specs[uint8_index].uint8_priority;
+		gl_arr_str_taskset_tasks[uint8_index].uint16_task_periodicity	= gl_arr_str_taskset_specs[uint8_index].uint16_period;
+		gl_arr_str_taskset_tasks[uint8_index].ptr_func_task				= taskset_task;
+		gl_arr_uint32_taskset_jobs[uint8_index] = 0;
+		sos_create_task(&gl_arr_str_taskset_tasks[uint8_index]);
+	}
+
+	gl_uint64_taskset_work			= 0;
+	gl_uint32_taskset_ticks_seen	= 0;
+
+	uint64_cycles	= sim_get_cycles();
+	uint64_busy		= bench_busy_cycles();
+
+	bench_sos_run_ticks(TASKSET_TICKS);
+
+	uint64_busy		= bench_busy_cycles() - uint64_busy;
+	uint64_cycles	= sim_get_cycles() - uint64_cycles;
+	uint64_overhead	= (uint64_busy > gl_uint64_taskset_work) ? (uint64_busy - gl_uint64_taskset_work) : 0;
+
+	for(uint8_t_ uint8_index = 0; uint8_index < uint8_n; uint8_index++)
+	{
+		if(SOS_STATUS_SUCCESS == sos_get_deadline_stats(uint8_index, &str_stats))
+		{
+			uint32_misses += str_stats.uint16_misses;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		/* whole periods in the run, the job of the last one may still wait for the CPU */
+		uint32_expected = (TASKSET_TICKS / gl_arr_str_taskset_specs[uint8_index].uint16_period) - 1;
+		ptr_str_result->uint32_dropped	+= (uint32_expected > gl_arr_uint32_taskset_jobs[uint8_index]) ?
+										   (uint32_expected - gl_arr_uint32_taskset_jobs[uint8_index]) : 0;
+		ptr_str_result->uint32_jobs		+= gl_arr_uint32_taskset_jobs[uint8_index];
+	}
+
+	uint32_lost = (0 != gl_uint32_taskset_ticks_seen) ?
+				  (gl_uint32_taskset_last_tick - gl_uint32_taskset_first_tick + 1 - gl_uint32_taskset_ticks_seen) :
+				  TASKSET_TICKS;
+
+	ptr_str_result->uint32_misses			+= uint32_misses;
+	ptr_str_result->uint32_sets_missing		+= (0 != uint32_misses) ? 1 : 0;
+	ptr_str_result->uint32_lost_ticks		+= uint32_lost;
+	ptr_str_result->uint32_max_lost_ticks	= (uint32_lost > ptr_str_result->uint32_max_lost_ticks) ?
+											  uint32_lost : ptr_str_result->uint32_max_lost_ticks;
+	ptr_str_result->uint64_work_cycles		+= gl_uint64_taskset_work;
+	ptr_str_result->uint64_run_cycles		+= uint64_cycles;
+	ptr_str_result->uint64_overhead_cycles	+= uint64_overhead;
+
+	if(SCM_STATUS_SUCCESS == scm_get_stats(&str_conformance))
+	{
+		ptr_str_result->uint32_conf_missing			+= str_conformance.uint32_missing;
+		ptr_str_result->uint32_conf_extra			+= str_conformance.uint32_extra;
+		ptr_str_result->uint32_conf_out_of_order	+= str_conformance.uint32_out_of_order;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	bench_sos_stop();
+}
+
+/**
+ * @brief a private function, body of every generated task, charges the
+ *		  execution time of the job in TASKSET_SLICE_CYCLES slices
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ taskset_task(void)
+{
+	uint8_t_ uint8_index = (uint8_t_)(sos_get_running_task() - gl_arr_str_taskset_tasks);
+	uint32_t_ uint32_work;
+	uint32_t_ uint32_slice;
+
+	if(TASKSET_MAX_TASKS > uint8_index)
+	{
+		uint32_work = gl_arr_str_taskset_specs[uint8_index].uint32_wcet_cycles;
+		if(TASKSET_EXEC_VAR == gl_enu_taskset_exec)
+		{
+			uint32_work = bench_random((uint32_work * TASKSET_VAR_MIN_PERCENT) / 100, uint32_work);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		gl_arr_uint32_taskset_jobs[uint8_index]++;
+
+		while(0 != uint32_work)
+		{
+			uint32_slice = (uint32_work > TASKSET_SLICE_CYCLES) ? TASKSET_SLICE_CYCLES : uint32_work;
+			gl_uint64_taskset_work += uint32_slice;
+			sim_consume_cycles(uint32_slice);
+			uint32_work -= uint32_slice;
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
+
+/**
+ * @brief a private function, body of the monitor task, counts the ticks it
+ *		  ran in
+ *
+ * @return SOS_TASK_DEFAULT_PERIOD
+ */
+static uint16_t_ taskset_monitor(void)
+{
+	uint32_t_ uint32_tick = sos_get_ticks();
+
+	if(0 == gl_uint32_taskset_ticks_seen)
+	{
+		gl_uint32_taskset_first_tick	= uint32_tick;
+		gl_uint32_taskset_last_tick		= uint32_tick;
+		gl_uint32_taskset_ticks_seen	= 1;
+	}
+	else if(uint32_tick != gl_uint32_taskset_last_tick)
+	{
+		gl_uint32_taskset_last_tick		= uint32_tick;
+		gl_uint32_taskset_ticks_seen++;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return SOS_TASK_DEFAULT_PERIOD;
+}
@@ -0,0 +1,91 @@
+/**
+ * @fileName	:	critical.c
+ * @Created		: 	6:20 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Nested critical sections that save and restore SREG
+ */
+
+#include "critical.h"
+#include "interrupts.h"
+#include "registers.h"
+
+#define CRITICAL_SREG		REG8(0x5F)		/* AVR Status Register */
+
+#if (CRITICAL_MEASURE == TRUE)
+/* written with interrupts disabled only */
+static INSTANCE uint16_t_ gl_arr_uint16_critical_max_us[CRITICAL_SITE_TOTAL];
+#endif
+
+void enter_critical(str_critical_t_ * ptr_str_critical, enu_critical_site_t_ enu_site)
+{
+	ptr_str_critical->uint8_sreg = CRITICAL_SREG;
+	cli();
+	ptr_str_critical->uint8_site = (uint8_t_)enu_site;
+#if (CRITICAL_MEASURE == TRUE)
+	ptr_str_critical->uint16_start = CRITICAL_TIME_NOW();
+#endif
+}
+
+void exit_critical(str_critical_t_ * ptr_str_critical)
+{
+#if (CRITICAL_MEASURE == TRUE)
+	uint16_t_ uint16_duration = (uint16_t_)(CRITICAL_TIME_NOW() - ptr_str_critical->uint16_start);
+
+	if(
+			(ptr_str_critical->uint8_site < CRITICAL_SITE_TOTAL) &&
+			(uint16_duration > gl_arr_uint16_critical_max_us[ptr_str_critical->uint8_site])
+			)
+	{
+		gl_arr_uint16_critical_max_us[ptr_str_critical->uint8_site] = uint16_duration;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#endif
+
+	/* interrupts are enabled again only if they were enabled at entry */
+	CRITICAL_SREG = ptr_str_critical->uint8_sreg;
+}
+
+enu_critical_status_t_ critical_get_max_duration(enu_critical_site_t_ enu_site, uint16_t_ * ptr_uint16_max_us)
+{
+	enu_critical_status_t_ enu_critical_status_retval = CRITICAL_STATUS_SUCCESS;
+
+	if(
+			(CRITICAL_SITE_TOTAL <= enu_site) ||
+			(NULL_PTR == ptr_uint16_max_us)
+			)
+	{
+		enu_critical_status_retval = CRITICAL_STATUS_INVALID_ARGS;
+	}
+	else
+	{
+#if (CRITICAL_MEASURE == TRUE)
+		/* 16 bit value written by ISRs, the read itself is not recorded */
+		uint8_t_ uint8_sreg = CRITICAL_SREG;
+
+		cli();
+		*ptr_uint16_max_us = gl_arr_uint16_critical_max_us[enu_site];
+		CRITICAL_SREG = uint8_sreg;
+#else
+		*ptr_uint16_max_us = 0;
+#endif
+	}
+
+	return enu_critical_status_retval;
+}
+
+void critical_reset_stats(void)
+{
+#if (CRITICAL_MEASURE == TRUE)
+	uint8_t_ uint8_sreg = CRITICAL_SREG;
+
+	cli();
+	for (uint8_t_ uint8_site = 0; uint8_site < CRITICAL_SITE_TOTAL; ++uint8_site)
+	{
+		gl_arr_uint16_critical_max_us[uint8_site] = 0;
+	}
+	CRITICAL_SREG = uint8_sreg;
+#endif
+}
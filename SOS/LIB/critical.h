@@ -0,0 +1,70 @@
+/**
+ * @fileName	:	critical.h
+ * @Created		: 	6:20 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Nested critical sections that save and restore SREG
+ *
+ * Usage:
+ *		str_critical_t_ lo_str_critical;
+ *
+ *		enter_critical(&lo_str_critical, CRITICAL_SITE_APP);
+ *		... shared data update ...
+ *		exit_critical(&lo_str_critical);
+ *
+ * The interrupt state is kept by the caller, so sections nest and the same
+ * code runs from task or ISR context, exit_critical only enables interrupts
+ * again if they were enabled at the matching enter_critical.
+ */
+
+
+#ifndef CRITICAL_H_
+#define CRITICAL_H_
+
+#include "std.h"
+#include "critical_cfg.h"
+
+typedef enum
+{
+	CRITICAL_STATUS_SUCCESS	= 0,
+	CRITICAL_STATUS_INVALID_ARGS,
+	CRITICAL_STATUS_TOTAL
+}enu_critical_status_t_;
+
+/* state of one section, a local variable of the caller */
+typedef struct
+{
+	uint16_t_	uint16_start;		/* CRITICAL_TIME_NOW at entry		*/
+	uint8_t_	uint8_sreg;			/* SREG before the section			*/
+	uint8_t_	uint8_site;			/* enu_critical_site_t_				*/
+}str_critical_t_;
+
+/**
+ *	@brief		                            :	Saves SREG and disables interrupts
+ *  @param[out]     ptr_str_critical        :   Section state, given to exit_critical
+ *  @param[in]      enu_site                :   Site the duration is recorded under
+ */
+void enter_critical(str_critical_t_ * ptr_str_critical, enu_critical_site_t_ enu_site);
+
+/**
+ *	@brief		                            :	Records the section duration and restores SREG
+ *  @param[in]      ptr_str_critical        :   State filled by the matching enter_critical
+ */
+void exit_critical(str_critical_t_ * ptr_str_critical);
+
+/**
+ *	@brief		                            :	Gets the longest interrupts disabled time of a site, the time of a
+ *	                                            nested section is included in the outer one
+ *  @param[in]      enu_site                :   Site
+ *  @param[out]     ptr_uint16_max_us       :   Pointer to store the time in microseconds
+ *
+ *  @Return     CRITICAL_STATUS_SUCCESS		:	Success
+ *              CRITICAL_STATUS_INVALID_ARGS:   Failed,     Invalid site or null pointer
+ */
+enu_critical_status_t_ critical_get_max_duration(enu_critical_site_t_ enu_site, uint16_t_ * ptr_uint16_max_us);
+
+/**
+ *	@brief		                            :	Clears the maximum duration of every site
+ */
+void critical_reset_stats(void);
+
+#endif /* CRITICAL_H_ */
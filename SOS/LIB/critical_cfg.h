@@ -0,0 +1,40 @@
+/**
+ * @fileName	:	critical_cfg.h
+ * @Created		: 	6:20 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Configuration file for the critical section facility
+ */
+
+
+#ifndef CRITICAL_CFG_H_
+#define CRITICAL_CFG_H_
+
+#include "registers.h"
+
+/* TRUE to keep the longest interrupts disabled time of every site */
+#define CRITICAL_MEASURE					TRUE
+
+/*
+ * time source of the measurement, TIMER_1 runs free at 1 us per count from
+ * timer_init on. The low byte is read first, it latches the high byte
+ * (TCNT1L 0x4C, TCNT1H 0x4D)
+ */
+#define CRITICAL_TIME_NOW()					REG16(0x4C)
+
+/* code sections that disable interrupts, one maximum duration each */
+typedef enum
+{
+	CRITICAL_SITE_SOS_DB	= 0,		/* task DB and chain updates	*/
+	CRITICAL_SITE_SOS_SYNC		,		/* semaphores, mutexes, events	*/
+	CRITICAL_SITE_TIMER			,		/* timer MCAL register updates	*/
+	CRITICAL_SITE_SWT			,		/* software timer list			*/
+	CRITICAL_SITE_HRT			,		/* high resolution timer list	*/
+	CRITICAL_SITE_DWQ			,		/* deferred work queue			*/
+	CRITICAL_SITE_MPL			,		/* memory pools					*/
+	CRITICAL_SITE_MBX			,		/* mailboxes					*/
+	CRITICAL_SITE_SCM			,		/* schedule conformance monitor	*/
+	CRITICAL_SITE_APP			,		/* application					*/
+	CRITICAL_SITE_TOTAL
+}enu_critical_site_t_;
+
+#endif /* CRITICAL_CFG_H_ */
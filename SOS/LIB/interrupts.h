@@ -37,6 +37,8 @@
 #define SPM_RDY_INT				__vector_20			/* Store Program Memory Ready Interrupt */
 
 
+#if defined(__AVR__)
+
 #define ISR(INT_VECT)			void INT_VECT(void) __attribute__((signal,used));\
 void INT_VECT(void)
 
@@ -46,6 +48,19 @@ void INT_VECT(void)
 #define sei() __asm__ __volatile__ ("sei" ::: "memory")			/* Sets Global Interrupt Enable Bit   */
 #define cli() __asm__ __volatile__ ("cli" ::: "memory")			/* Clears Global Interrupt Enable Bit */
 
+#else
+
+#include "registers.h"
+
+/* host build, the simulator calls the vectors and keeps the I bit in its SREG */
+#define ISR(INT_VECT)			void INT_VECT(void);\
+void INT_VECT(void)
+
+#define sei() (REG8(0x5F) |= (1 << 7))							/* Sets Global Interrupt Enable Bit   */
+#define cli() (REG8(0x5F) &= (uint8_t_)~(1 << 7))				/* Clears Global Interrupt Enable Bit */
+
+#endif
+
 
 
 #endif /* INTERRUPTS_H_ */
\ No newline at end of file
@@ -0,0 +1,34 @@
+/**
+ * @fileName	:	registers.h
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Memory mapped I/O register access used by every driver
+ *
+ * On the target a register is the absolute data space address, on a host build
+ * the access goes through the simulator (SIM/sim_interface.h) that keeps an
+ * emulated register file, moves its virtual clock and dispatches the ISRs
+ * before handing the register out.
+ */
+
+
+#ifndef REGISTERS_H_
+#define REGISTERS_H_
+
+#include "std.h"
+
+#if defined(__AVR__)
+
+#define REG8(ADDRESS)			(*((volatile uint8_t_*)(ADDRESS)))
+#define REG16(ADDRESS)			(*((volatile uint16_t_*)(ADDRESS)))	/* low byte at ADDRESS */
+
+#else
+
+volatile uint8_t_ *  sim_reg8  (uint8_t_ uint8_address);
+volatile uint16_t_ * sim_reg16 (uint8_t_ uint8_address);
+
+#define REG8(ADDRESS)			(*sim_reg8(ADDRESS))
+#define REG16(ADDRESS)			(*sim_reg16(ADDRESS))
+
+#endif
+
+#endif /* REGISTERS_H_ */
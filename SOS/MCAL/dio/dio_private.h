@@ -13,27 +13,28 @@
 
 /* LIB */
 #include "bit_math.h"
+#include "registers.h"
 
 /* ---------------------- DIO PORTS Registers Locations ---------------------- */
 
 /** PORT A **/
-#define DIO_U8_PORT_A_REG   *( ( volatile uint8_t_ * ) 0x3B )
-#define DIO_U8_DDR_A_REG    *( ( volatile uint8_t_ * ) 0x3A )
-#define DIO_U8_PIN_A_REG    *( ( volatile uint8_t_ * ) 0x39 )
+#define DIO_U8_PORT_A_REG   REG8(0x3B)
+#define DIO_U8_DDR_A_REG    REG8(0x3A)
+#define DIO_U8_PIN_A_REG    REG8(0x39)
 
 /** PORT B **/
-#define DIO_U8_PORT_B_REG   *( ( volatile uint8_t_ * ) 0x38 )
-#define DIO_U8_DDR_B_REG    *( ( volatile uint8_t_ * ) 0x37 )
-#define DIO_U8_PIN_B_REG    *( ( volatile uint8_t_ * ) 0x36 )
+#define DIO_U8_PORT_B_REG   REG8(0x38)
+#define DIO_U8_DDR_B_REG    REG8(0x37)
+#define DIO_U8_PIN_B_REG    REG8(0x36)
 
 /** PORT C **/
-#define DIO_U8_PORT_C_REG   *( ( volatile uint8_t_ * ) 0x35 )
-#define DIO_U8_DDR_C_REG    *( ( volatile uint8_t_ * ) 0x34 )
-#define DIO_U8_PIN_C_REG    *( ( volatile uint8_t_ * ) 0x33 )
+#define DIO_U8_PORT_C_REG   REG8(0x35)
+#define DIO_U8_DDR_C_REG    REG8(0x34)
+#define DIO_U8_PIN_C_REG    REG8(0x33)
 
 /** PORT D **/
-#define DIO_U8_PORT_D_REG   *( ( volatile uint8_t_ * ) 0x32 )
-#define DIO_U8_DDR_D_REG    *( ( volatile uint8_t_ * ) 0x31 )
-#define DIO_U8_PIN_D_REG    *( ( volatile uint8_t_ * ) 0x30 )
+#define DIO_U8_PORT_D_REG   REG8(0x32)
+#define DIO_U8_DDR_D_REG    REG8(0x31)
+#define DIO_U8_PIN_D_REG    REG8(0x30)
 
 #endif /* DIO_PRIVATE_H_ */
\ No newline at end of file
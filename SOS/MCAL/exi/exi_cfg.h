@@ -1,31 +1,31 @@
-/*
- * exi_config.h
- *
- *  Created on: May 16, 2023
- *      Author: Alaa
- */
-
-#ifndef EXI_CONFIG_H_
-#define EXI_CONFIG_H_
-
-
-/*************************************************************************************************************
- * 													Macros
- ************************************************************************************************************/
-
-#define MAX_EXTI			EXTI2
-
-/*************************************************************************************************************
- * 											User-defined data types
- ************************************************************************************************************/
-typedef struct
-{
-	enu_exi_id_t_ 	 		EXI_NUM		;
-	enu_exi_sense_mode_t_	SENSE_MODE	;
-	enu_exi_state_t_ 		EXI_EN		;
-}str_exi_config_t_;
-
-
-
-
+/*
+ * exi_config.h
+ *
+ *  Created on: May 16, 2023
+ *      Author: Alaa
+ */
+
+#ifndef EXI_CONFIG_H_
+#define EXI_CONFIG_H_
+
+
+/*************************************************************************************************************
+ * 													Macros
+ ************************************************************************************************************/
+
+#define MAX_EXTI			EXTI2
+
+/*************************************************************************************************************
+ * 											User-defined data types
+ ************************************************************************************************************/
+typedef struct
+{
+	enu_exi_id_t_ 	 		EXI_NUM		;
+	enu_exi_sense_mode_t_	SENSE_MODE	;
+	enu_exi_state_t_ 		EXI_EN		;
+}str_exi_config_t_;
+
+
+
+
 #endif /* EXI_CONFIG_H_ */
\ No newline at end of file
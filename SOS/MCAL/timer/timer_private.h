@@ -12,6 +12,8 @@
 #ifndef TIMER_PRIVATE_H_
 #define TIMER_PRIVATE_H_
 
+#include "registers.h"
+
 typedef enum{
 	bit0,
 	bit1,
@@ -30,7 +32,7 @@ typedef enum{
 /*							TIMER_REGISTERS								*/
 /************************************************************************/
 /********************************_TIMER0_REGISTERS_**********************/
-#define TCCR0		(*((volatile uint8_t_*)0x53))
+#define TCCR0		REG8(0x53)
 #define FOC0		bit7
 #define WGM00		bit6
 #define COM01		bit5
@@ -40,7 +42,7 @@ typedef enum{
 #define	CS01		bit1
 #define	CS00		bit0
 
-#define TIMSK		(*((volatile uint8_t_*)0x59))			/*Timer/Counter Interrupt Mask Register*/
+#define TIMSK		REG8(0x59)			/*Timer/Counter Interrupt Mask Register*/
 #define OCIE2		bit7
 #define TOIE2		bit6
 #define TICIE1		bit5
@@ -50,11 +52,11 @@ typedef enum{
 #define	OCIE0		bit1
 #define	TOIE0		bit0
 
-#define TCNT0		(*((volatile uint8_t_*)0x52))
+#define TCNT0		REG8(0x52)
 
-#define OCR0		(*((volatile uint8_t_*)0x5C))
+#define OCR0		REG8(0x5C)
 
-#define TIFR		(*((volatile uint8_t_*)0x58))
+#define TIFR		REG8(0x58)
 #define OCF2		bit7
 #define TOV2		bit6
 #define ICF1		bit5
@@ -65,25 +67,25 @@ typedef enum{
 #define TOV0		bit0
 
 /********************************_TIMER1_REGISTERS_**********************/
-#define ICR1		(*((volatile uint16_t_*)0x46))
-#define ICR1L		(*((volatile uint8_t_*)0x46))
-#define ICR1H		(*((volatile uint8_t_*)0x47))
+#define ICR1		REG16(0x46)
+#define ICR1L		REG8(0x46)
+#define ICR1H		REG8(0x47)
 
-#define OCR1A		(*((volatile uint16_t_*)0x4A))
-#define OCR1AL		(*((volatile uint8_t_*)0x4A))
-#define OCR1AH		(*((volatile uint8_t_*)0x4B))
-#define OCR1B		(*((volatile uint16_t_*)0x48))
-#define OCR1BL		(*((volatile uint8_t_*)0x48))
-#define OCR1BH 		(*((volatile uint8_t_*)0x49))
+#define OCR1A		REG16(0x4A)
+#define OCR1AL		REG8(0x4A)
+#define OCR1AH		REG8(0x4B)
+#define OCR1B		REG16(0x48)
+#define OCR1BL		REG8(0x48)
+#define OCR1BH 		REG8(0x49)
 
 
-#define TCNT1		(*((volatile uint16_t_*)0x4C))
-#define TCNT1L		(*((volatile uint8_t_*)0x4C))
-#define TCNT1H		(*((volatile uint8_t_*)0x4D))
+#define TCNT1		REG16(0x4C)
+#define TCNT1L		REG8(0x4C)
+#define TCNT1H		REG8(0x4D)
 
-#define TCCR1		(*((volatile uint16_t_*)0x4E))
-#define TCCR1A		(*((volatile uint8_t_*)0x4F))
-#define TCCR1B		(*((volatile uint8_t_*)0x4E))
+#define TCCR1		REG16(0x4E)
+#define TCCR1A		REG8(0x4F)
+#define TCCR1B		REG8(0x4E)
 #define COM1A1		bit7
 #define COM1A0		bit6
 #define COM1B1		bit5
@@ -101,7 +103,7 @@ typedef enum{
 #define	CS10		bit0
 
 /********************************_TIMER2_REGISTERS_**********************/
-#define TCCR2		(*((volatile uint8_t_*)0x45))
+#define TCCR2		REG8(0x45)
 #define FOC2		bit7
 #define WGM20		bit6
 #define COM21		bit5
@@ -111,14 +113,14 @@ typedef enum{
 #define	CS21		bit1
 #define	CS20		bit0
 
-#define TCNT2		(*((volatile uint8_t_*)0x44))
+#define TCNT2		REG8(0x44)
 
-#define OCR2		(*((volatile uint8_t_*)0x43))
+#define OCR2		REG8(0x43)
 
 /************************************************************************/
 /*							STATUS_REGISTER								*/
 /************************************************************************/
-#define SREG		(*((volatile uint8_t_*)0x5F))			/*AVR Status Register*/
+#define SREG		REG8(0x5F)			/*AVR Status Register*/
 #define Ibit		bit7							/*Global Interrupt Enable*/
 
 
@@ -1,592 +1,955 @@
-/**********************************************************************************************************************
- *  FILE DESCRIPTION
- *  -----------------------------------------------------------------------------------------------------------------
- *
- *         @Date:  	5:34 PM Monday, May 15, 2023
- *		   @File:  	timer_cfg.c         
- *		 @Module:  	Timer
- *		 @Author:	Ahmed Hesham
- *  @Description:  	Program file for Timer module     
- *  
- *********************************************************************************************************************/
-
-/**********************************************************************************************************************
- *  INCLUDES
- *********************************************************************************************************************/
-#include "timer_interface.h"
-#include "timer_cfg.h"
-#include "timer_private.h"
-
-/**********************************************************************************************************************
- *  GLOBAL DATA
- *********************************************************************************************************************/
-extern const str_timer_config_t str_timer_config [NUMBER_OF_TIMERS_USED];
-
-void (*timer_0_callback) (void) = NULL_PTR;
-
-void (*timer_1_callback) (void) = NULL_PTR;
-
-void (*timer_2_callback) (void) = NULL_PTR;
-
-void (*TIMER_0_pwmOnCallBack) (void) = NULL_PTR;
-
-void (*TIMER_0_pwmOffCallBack) (void) = NULL_PTR;
-
-
-uint32_t_ gl_uint32_timer0NumberOfOVFs	=	0;
-
-uint8_t_  gl_uint8_timer0RemTicks		=	0;
-
-volatile uint32_t_ gl_uint32_timer0OVFCounter	=	0;
-
-uint32_t_ gl_uint32_timer1NumberOfOVFs	=	0;
-
-uint16_t_ gl_uint16_timer1RemTicks		=	0;
-
-volatile uint32_t_ gl_uint32_timer1OVFCounter	=	0;
-
-uint32_t_ gl_uint32_timer2NumberOfOVFs	=	0;
-
-uint32_t_ gl_uint8_timer2RemTicks		=	0;
-
-volatile uint32_t_ gl_uint32_timer2OVFCounter	=	0;
-
-uint8_t_ gl_uint8_normalToPwm		=	0;
-/**********************************************************************************************************************
- *  GLOBAL FUNCTION IMPLEMENTATION
- *********************************************************************************************************************/
-/******************************************************************************
-* @Syntax          : enu_timer_error_t timer_init( void )
-* @Description     : Initialize Timer according to preprocessed configured definitions
-* @Sync\Async      : Synchronous
-* @Reentrancy      : Reentrant
-* @Parameters (in) : None
-* @Parameters (out): None
-* @Return value:   : enu_timer_error_t		TIMER_OK = 0
-*											TIMER_WRONG_TIMER_USED = 1
-*											TIMER_WRONG_DESIRED_TIME = 2
-*											TIMER_NOK = 3
-*******************************************************************************/
-enu_timer_error_t timer_init( void )
-{
-	enu_timer_error_t returnValue = TIMER_OK;
-	
-	for (uint8_t_ counter = 0; counter < NUMBER_OF_TIMERS_USED; counter++)
-	{
-		switch(str_timer_config[counter].timerUsed)
-		{
-			case TIMER_0:
-			switch(str_timer_config[counter].waveformUsed)
-			{
-				case TIMER_OV:
-				/*Choosing Normal Mode*/
-				CLR_BIT(TCCR0,WGM01); CLR_BIT(TCCR0,WGM00);
-				/*Enabling OVF Interrupt 0*/
-				SET_BIT(TIMSK,TOIE0);
-				//SET_BIT(TIMSK,TOIE0);
-				break;
-				
-				case TIMER_CTC:
-				/*Choosing CTC Mode*/
-				SET_BIT(TCCR0,WGM01); CLR_BIT(TCCR0,WGM00);
-				/*Enabling CTC Interrupt 0*/
-				SET_BIT(TIMSK,OCIE0);
-				break;
-				
-				case TIMER_PWM:
-				/*TO BE IMPLEMENTED*/
-				break;
-				
-				default:
-				returnValue = TIMER_NOK;
-				break;
-			}
-			break;
-			
-			case TIMER_1:
-			switch(str_timer_config[counter].waveformUsed)
-			{
-				case TIMER_OV:
-				CLR_BIT(TCCR1A,COM1A1);
-				CLR_BIT(TCCR1A,COM1A0);
-				
-				CLR_BIT(TCCR1B,WGM13);
-				CLR_BIT(TCCR1B,WGM12);
-				CLR_BIT(TCCR1A,WGM11);
-				CLR_BIT(TCCR1A,WGM10);
-				
-				//SET_BIT(TIMSK, TOIE1);
-				break;
-				
-				case TIMER_CTC:
-				break;
-				
-				case TIMER_PWM:
-				break;
-				
-				default:
-				returnValue = TIMER_NOK;
-				break;
-			}
-			break;
-			
-			case TIMER_2:
-			switch(str_timer_config[counter].waveformUsed)
-			{
-				case TIMER_OV:
-				/*Choosing Normal Mode*/
-				CLR_BIT(TCCR2,WGM21); CLR_BIT(TCCR2,WGM20);
-				/*Enabling OVF Interrupt 0*/
-				SET_BIT(TIMSK,TOIE2);
-				break;
-				
-				case TIMER_CTC:
-				/*Choosing CTC Mode*/
-				SET_BIT(TCCR0,WGM21); CLR_BIT(TCCR0,WGM20);
-				/*Enabling CTC Interrupt 0*/
-				SET_BIT(TIMSK,OCIE2);
-				break;
-				
-				case TIMER_PWM:
-				/*TO BE IMPLEMENTED*/
-				break;
-				
-				default:
-				returnValue = TIMER_NOK;
-				break;
-			}
-			break;
-			default:
-			returnValue =  TIMER_WRONG_TIMER_USED;
-			break;
-		}
-		if (returnValue)
-		{
-			break;
-		}
-	}
-	/*Enabling Global Interrupt*/
-	SET_BIT(SREG, Ibit);
-	
-	return returnValue;
-}
-
-/******************************************************************************
-* @Syntax          : enu_timer_error_t timer_set_time
-*					 (enu_timer_number_t enu_a_timerUsed, f32 f32_desiredTime)
-* @Description     : set the time at which the timer interrupts
-* @Sync\Async      : Synchronous
-* @Reentrancy      : Reentrant
-* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
-*					 f32					f32_a_desiredTime
-* @Parameters (out): None
-* @Return value:   : enu_timer_error_t		TIMER_OK = 0
-*											TIMER_WRONG_TIMER_USED = 1
-*											TIMER_WRONG_DESIRED_TIME = 2
-*											TIMER_NOK = 3
-*******************************************************************************/
-enu_timer_error_t timer_set_time(enu_timer_number_t enu_a_timerUsed, f32_t_ f32_desiredTime)
-{
-	enu_timer_error_t returnValue = TIMER_OK;
-	uint32_t_ uint32_tickTime = 0;
-	uint32_t_ uint32_numberOfTicks = 0;
-	uint16_t_ uint16_TCNTValue = 0;
-	
-	switch(enu_a_timerUsed)
-	{
-		case TIMER_0:
-		switch(str_timer_config[enu_a_timerUsed].waveformUsed)
-		{
-			case TIMER_OV:
-			uint32_tickTime = str_timer_config[enu_a_timerUsed].prescalerUsed / XTAL_FREQ;
-			uint32_numberOfTicks = ((f32_desiredTime*1000)/uint32_tickTime);
-			
-			gl_uint32_timer0NumberOfOVFs = uint32_numberOfTicks / 256;
-			gl_uint8_timer0RemTicks = uint32_numberOfTicks % 256;
-			
-			if (gl_uint8_timer0RemTicks)
-			{
-				TCNT0 = 256 - gl_uint8_timer0RemTicks;
-				gl_uint32_timer0NumberOfOVFs++;
-			}
-			break;
-			
-			case TIMER_CTC:
-			/*TO BE IMPLEMENTED*/
-			break;
-			
-			case TIMER_PWM:
-			/*DO NOTHING*/
-			break;
-			
-			default:
-			returnValue = TIMER_NOK;
-			break;
-		}
-		break;
-		
-		case TIMER_1:
-		switch(str_timer_config[enu_a_timerUsed].waveformUsed)
-		{
-			case TIMER_OV:
-			uint32_tickTime = str_timer_config[enu_a_timerUsed].prescalerUsed / XTAL_FREQ;
-			uint32_numberOfTicks = ((f32_desiredTime*1000)/uint32_tickTime);
-			
-			gl_uint32_timer1NumberOfOVFs = uint32_numberOfTicks / 65536;
-			gl_uint16_timer1RemTicks = uint32_numberOfTicks % 65536;
-			
-			if (gl_uint16_timer1RemTicks)
-			{
-				uint16_TCNTValue = 65536 - gl_uint16_timer1RemTicks;
-				
-				TCNT1L |= uint16_TCNTValue;
-				TCNT1H |= (uint16_TCNTValue>>8);
-				
-				gl_uint32_timer2NumberOfOVFs++;
-			}
-			break;
-			
-			case TIMER_CTC:
-			/*TO BE IMPLEMENTED*/
-			break;
-			
-			case TIMER_PWM:
-			/*DO NOTHING*/
-			break;
-			
-			default:
-			returnValue = TIMER_NOK;
-			break;
-		}
-		break;
-		
-		case TIMER_2:
-		switch(str_timer_config[enu_a_timerUsed].waveformUsed)
-		{
-			case TIMER_OV:
-			uint32_tickTime = str_timer_config[enu_a_timerUsed].prescalerUsed / XTAL_FREQ;
-			uint32_numberOfTicks = ((f32_desiredTime*1000)/uint32_tickTime);
-			
-			gl_uint32_timer2NumberOfOVFs = uint32_numberOfTicks / 256;
-			gl_uint8_timer2RemTicks = uint32_numberOfTicks % 256;
-			
-			if (gl_uint8_timer2RemTicks)
-			{
-				TCNT2 = 256 - gl_uint8_timer2RemTicks;
-				gl_uint32_timer2NumberOfOVFs++;
-			}
-			break;
-			
-			case TIMER_CTC:
-			/*TO BE IMPLEMENTED*/
-			break;
-			
-			case TIMER_PWM:
-			/*DO NOTHING*/
-			break;
-			
-			default:
-			returnValue = TIMER_NOK;
-			break;
-		}
-		break;
-		
-		default:
-		returnValue =  TIMER_WRONG_TIMER_USED;
-		break;
-		
-	}
-	return returnValue;
-}
-
-
-/******************************************************************************
-* @Syntax          : enu_timer_error_t timer_resume(enu_timer_number_t enu_a_timerUsed)
-* @Description     : makes the timer to start/resume counting
-* @Sync\Async      : Synchronous
-* @Reentrancy      : Reentrant
-* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
-* @Parameters (out): None
-* @Return value:   : enu_timer_error_t		TIMER_OK = 0
-*											TIMER_WRONG_TIMER_USED = 1
-*											TIMER_WRONG_DESIRED_TIME = 2
-*											TIMER_NOK = 3
-*******************************************************************************/
-enu_timer_error_t timer_resume(enu_timer_number_t enu_a_timerUsed)
-{
-	enu_timer_error_t returnValue = TIMER_OK;
-	switch(enu_a_timerUsed)
-	{
-		case TIMER_0:
-		switch(str_timer_config[TIMER_0].prescalerUsed)
-		{
-			case TIMER_PRESCLNG_1:
-			CLR_BIT(TCCR0, CS02);	CLR_BIT(TCCR0, CS01);	SET_BIT(TCCR0, CS00);
-			break;
-			
-			case TIMER_PRESCLNG_8:
-			CLR_BIT(TCCR0, CS02);	SET_BIT(TCCR0, CS01);	CLR_BIT(TCCR0, CS00);
-			break;
-			
-			case TIMER_PRESCLNG_64:
-			CLR_BIT(TCCR0, CS02);	SET_BIT(TCCR0, CS01);	SET_BIT(TCCR0, CS00);
-			break;
-			
-			case TIMER_PRESCLNG_256:
-			SET_BIT(TCCR0, CS02);	CLR_BIT(TCCR0, CS01);	CLR_BIT(TCCR0, CS00);
-			break;
-			
-			case TIMER_PRESCLNG_1024:
-			SET_BIT(TCCR0, CS02);	CLR_BIT(TCCR0, CS01);	SET_BIT(TCCR0, CS00);
-			break;
-			
-			default: returnValue = TIMER_NOK;	break;
-		}
-		break;
-		
-		case TIMER_1:
-		switch(str_timer_config[TIMER_1].prescalerUsed)
-		{
-			case TIMER_PRESCLNG_1:
-			CLR_BIT(TCCR1B, CS12);	CLR_BIT(TCCR1B, CS11);	SET_BIT(TCCR1B, CS10);
-			break;
-			
-			case TIMER_PRESCLNG_8:
-			CLR_BIT(TCCR1B, CS12);	SET_BIT(TCCR1B, CS11);	CLR_BIT(TCCR1B, CS10);
-			break;
-			
-			case TIMER_PRESCLNG_64:
-			CLR_BIT(TCCR1B, CS12);	SET_BIT(TCCR1B, CS11);	SET_BIT(TCCR1B, CS10);
-			break;
-			
-			case TIMER_PRESCLNG_256:
-			SET_BIT(TCCR1B, CS12);	CLR_BIT(TCCR1B, CS11);	CLR_BIT(TCCR1B, CS10);
-			break;
-			
-			case TIMER_PRESCLNG_1024:
-			SET_BIT(TCCR1B, CS12);	CLR_BIT(TCCR1B, CS11);	SET_BIT(TCCR1B, CS10);
-			break;
-			
-			default: returnValue = TIMER_NOK;	break;
-		}
-		break;
-		
-		case TIMER_2:
-		switch(str_timer_config[TIMER_1].prescalerUsed)
-		{
-			case TIMER_PRESCLNG_1:
-			CLR_BIT(TCCR2,CS22); CLR_BIT(TCCR2,CS21);	SET_BIT(TCCR2,CS20);
-			break;
-			
-			case TIMER_PRESCLNG_8:
-			CLR_BIT(TCCR2,CS22); SET_BIT(TCCR2,CS21);	CLR_BIT(TCCR2,CS20);
-			break;
-			
-			case TIMER_PRESCLNG_64:
-			SET_BIT(TCCR2,CS22); CLR_BIT(TCCR2,CS21);	CLR_BIT(TCCR2,CS20);
-			break;
-			
-			case TIMER_PRESCLNG_256:
-			SET_BIT(TCCR2,CS22); SET_BIT(TCCR2,CS21);	CLR_BIT(TCCR2,CS20);
-			break;
-			
-			case TIMER_PRESCLNG_1024:
-			SET_BIT(TCCR2,CS22); SET_BIT(TCCR2,CS21);	SET_BIT(TCCR2,CS20);
-			break;
-			
-			default: returnValue = TIMER_NOK;	break;
-		}
-		break;
-		default:
-		returnValue =  TIMER_NOK;
-		break;
-		
-	}
-	return returnValue;
-}
-
-
-/******************************************************************************
-* @Syntax          : enu_timer_error_t timer_pause(enu_timer_number_t enu_a_timerUsed)
-* @Description     : makes the timer to pause counting
-* @Sync\Async      : Synchronous
-* @Reentrancy      : Reentrant
-* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
-* @Parameters (out): None
-* @Return value:   : enu_timer_error_t		TIMER_OK = 0
-*											TIMER_WRONG_TIMER_USED = 1
-*											TIMER_WRONG_DESIRED_TIME = 2
-*											TIMER_NOK = 3
-*******************************************************************************/
-enu_timer_error_t timer_pause(enu_timer_number_t enu_a_timerUsed)
-{
-	enu_timer_error_t returnValue = TIMER_OK;
-	switch(enu_a_timerUsed)
-	{
-		case TIMER_0:
-		CLR_BIT(TCCR0, CS02);	CLR_BIT(TCCR0, CS01);	CLR_BIT(TCCR0, CS00);	break;
-		
-		case TIMER_1:
-		CLR_BIT(TCCR1B,CS12);	CLR_BIT(TCCR1B,CS11);	CLR_BIT(TCCR1B,CS10);	break;
-		
-		case TIMER_2:
-		CLR_BIT(TCCR2, CS22);	CLR_BIT(TCCR2, CS21);	CLR_BIT(TCCR2, CS20);	break;
-		
-		default:	
-		returnValue =			TIMER_WRONG_TIMER_USED;							break;
-		
-	}
-	return returnValue;
-}
-
-/******************************************************************************
-* @Syntax          : enu_timer_error_t timer_disable_interrupt(enu_timer_number_t enu_a_timerUsed)
-* @Description     : Disables timer's interrupts
-* @Sync\Async      : Synchronous
-* @Reentrancy      : Reentrant
-* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
-* @Parameters (out): None
-* @Return value:   : enu_timer_error_t		TIMER_OK = 0
-*											TIMER_WRONG_TIMER_USED = 1
-*											TIMER_WRONG_DESIRED_TIME = 2
-*											TIMER_NOK = 3
-*******************************************************************************/
-enu_timer_error_t timer_disable_interrupt(enu_timer_number_t enu_a_timerUsed)
-{
-	enu_timer_error_t returnValue = TIMER_OK;
-	switch(enu_a_timerUsed)
-	{
-		case TIMER_0:	CLR_BIT(TIMSK,TOIE0);				break;
-		
-		case TIMER_1:	CLR_BIT(TIMSK,TOIE1);				break;
-		
-		case TIMER_2:	CLR_BIT(TIMSK,TOIE2);				break;
-		
-		default:	returnValue =  TIMER_WRONG_TIMER_USED;	break;
-		
-	}
-	return returnValue;
-}
-
-/******************************************************************************
-* @Syntax          : enu_timer_error_t timer_enable_interrupt(enu_timer_number_t enu_a_timerUsed)
-* @Description     : Enables timer's interrupts
-* @Sync\Async      : Synchronous
-* @Reentrancy      : Reentrant
-* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
-* @Parameters (out): None
-* @Return value:   : enu_timer_error_t		TIMER_OK = 0
-*											TIMER_WRONG_TIMER_USED = 1
-*											TIMER_WRONG_DESIRED_TIME = 2
-*											TIMER_NOK = 3
-*******************************************************************************/
-enu_timer_error_t timer_enable_interrupt(enu_timer_number_t enu_a_timerUsed)
-{
-	enu_timer_error_t returnValue = TIMER_OK;
-	switch(enu_a_timerUsed)
-	{
-		case TIMER_0:	SET_BIT(TIMSK,TOIE0);				break;
-		
-		case TIMER_1:	SET_BIT(TIMSK,TOIE1);				break;
-		
-		case TIMER_2:	SET_BIT(TIMSK,TOIE2);				break;
-		
-		default:	returnValue =  TIMER_WRONG_TIMER_USED;	break;
-		
-	}
-	return returnValue;
-}
-
-/******************************************************************************
-* @Syntax          : enu_timer_error_t timer_set_callback
-*					 (enu_timer_number_t enu_a_timerUsed, void (*funPtr)(void))
-* @Description     : sets the call back function for a specific timer
-* @Sync\Async      : Synchronous
-* @Reentrancy      : Reentrant
-* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
-*					 void					(*funPtr)(void)
-* @Parameters (out): None
-* @Return value:   : enu_timer_error_t		TIMER_OK = 0
-*											TIMER_WRONG_TIMER_USED = 1
-*											TIMER_WRONG_DESIRED_TIME = 2
-*											TIMER_NOK = 3
-*******************************************************************************/
-enu_timer_error_t timer_set_callback(enu_timer_number_t enu_a_timerUsed, void (*funPtr)(void))
-{
-	enu_timer_error_t returnValue = TIMER_OK;
-	
-	if(funPtr != NULL_PTR)	
-	{	
-		switch(enu_a_timerUsed)
-		{
-			case TIMER_0:	timer_0_callback = funPtr;			break;
-			
-			case TIMER_1:	timer_1_callback = funPtr;			break;
-			
-			case TIMER_2:	timer_2_callback = funPtr;			break;
-			
-			default:	returnValue = TIMER_WRONG_TIMER_USED;	break;
-		}
-	}
-	else
-	{
-		returnValue = TIMER_NOK;
-	}
-	return returnValue;
-}
-
-ISR(TIM0_OVF_INT)
-{
-	if (gl_uint8_normalToPwm == 0	)
-	{
-		gl_uint32_timer0OVFCounter ++;
-		if (gl_uint32_timer0OVFCounter == gl_uint32_timer0NumberOfOVFs)
-		{
-			if(timer_0_callback != NULL_PTR)
-			{
-				timer_0_callback();
-			}
-			gl_uint32_timer0OVFCounter   =	0;
-			TCNT0 = 256 - gl_uint8_timer0RemTicks;
-		}
-	}
-	else
-	{
-		/*TO BE IMPLEMENT*/
-	}
-}
-
-ISR(TIM1_OVF_INT)
-{
-	gl_uint32_timer1OVFCounter ++;
-	if (gl_uint32_timer1OVFCounter  == gl_uint32_timer1NumberOfOVFs)
-	{
-		if(timer_1_callback != NULL_PTR)
-		{
-			timer_1_callback();
-		}
-		gl_uint32_timer1OVFCounter  =	0;
-		TCNT1 = 65536 - gl_uint16_timer1RemTicks;
-		
-	}
-
-}
-
-ISR(TIM2_OVF_INT)
-{
-	gl_uint32_timer2OVFCounter ++;
-	if (gl_uint32_timer2OVFCounter  == gl_uint32_timer2NumberOfOVFs)
-	{
-		if(timer_2_callback != NULL_PTR)
-		{
-			timer_2_callback();
-		}
-		gl_uint32_timer2OVFCounter  =	0;
-		TCNT2 = 256 - gl_uint8_timer2RemTicks;
-		
-	}
-
-}
-/**********************************************************************************************************************
- *  END OF FILE: timer_program.c
- *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------
+ *
+ *         @Date:  	5:34 PM Monday, May 15, 2023
+ *		   @File:  	timer_cfg.c         
+ *		 @Module:  	Timer
+ *		 @Author:	Ahmed Hesham
+ *  @Description:  	Program file for Timer module     
+ *  
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "timer_interface.h"
+#include "timer_cfg.h"
+#include "timer_private.h"
+#include "dwq_interface.h"
+#include "critical.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA
+ *********************************************************************************************************************/
+extern const str_timer_config_t str_timer_config [NUMBER_OF_TIMERS_USED];
+
+INSTANCE void (*timer_0_callback) (void) = NULL_PTR;
+
+INSTANCE void (*timer_1_callback) (void) = NULL_PTR;
+
+INSTANCE void (*timer_2_callback) (void) = NULL_PTR;
+
+INSTANCE void (*timer_1_compare_callback[TIMER_COMPARE_TOTAL]) (void) = {NULL_PTR, NULL_PTR};
+
+INSTANCE enu_timer_cbf_mode_t timer_callback_mode[3] = {TIMER_CBF_IMMEDIATE, TIMER_CBF_IMMEDIATE, TIMER_CBF_IMMEDIATE};
+
+INSTANCE void (*TIMER_0_pwmOnCallBack) (void) = NULL_PTR;
+
+INSTANCE void (*TIMER_0_pwmOffCallBack) (void) = NULL_PTR;
+
+
+INSTANCE uint32_t_ gl_uint32_timer0NumberOfOVFs	=	0;
+
+INSTANCE uint8_t_  gl_uint8_timer0RemTicks		=	0;
+
+INSTANCE volatile uint32_t_ gl_uint32_timer0OVFCounter	=	0;
+
+INSTANCE uint32_t_ gl_uint32_timer1NumberOfOVFs	=	0;
+
+INSTANCE uint16_t_ gl_uint16_timer1RemTicks		=	0;
+
+INSTANCE volatile uint32_t_ gl_uint32_timer1OVFCounter	=	0;
+
+INSTANCE uint32_t_ gl_uint32_timer2NumberOfOVFs	=	0;
+
+INSTANCE uint32_t_ gl_uint8_timer2RemTicks		=	0;
+
+INSTANCE volatile uint32_t_ gl_uint32_timer2OVFCounter	=	0;
+
+INSTANCE uint8_t_ gl_uint8_normalToPwm		=	0;
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION IMPLEMENTATION
+ *********************************************************************************************************************/
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_init( void )
+* @Description     : Initialize Timer according to preprocessed configured definitions,
+*					 TIMER_1 in normal mode starts counting (free running time base)
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : None
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_init( void )
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	str_critical_t_ lo_str_critical;
+	
+	/*TIMSK is shared by every timer, its updates are read-modify-write*/
+	enter_critical(&lo_str_critical, CRITICAL_SITE_TIMER);
+	for (uint8_t_ counter = 0; counter < NUMBER_OF_TIMERS_USED; counter++)
+	{
+		switch(str_timer_config[counter].timerUsed)
+		{
+			case TIMER_0:
+			switch(str_timer_config[counter].waveformUsed)
+			{
+				case TIMER_OV:
+				/*Choosing Normal Mode*/
+				CLR_BIT(TCCR0,WGM01); CLR_BIT(TCCR0,WGM00);
+				/*Enabling OVF Interrupt 0*/
+				SET_BIT(TIMSK,TOIE0);
+				//SET_BIT(TIMSK,TOIE0);
+				break;
+				
+				case TIMER_CTC:
+				/*Choosing CTC Mode*/
+				SET_BIT(TCCR0,WGM01); CLR_BIT(TCCR0,WGM00);
+				/*Enabling CTC Interrupt 0*/
+				SET_BIT(TIMSK,OCIE0);
+				break;
+				
+				case TIMER_PWM:
+				/*TO BE IMPLEMENTED*/
+				break;
+				
+				default:
+				returnValue = TIMER_NOK;
+				break;
+			}
+			break;
+			
+			case TIMER_1:
+			switch(str_timer_config[counter].waveformUsed)
+			{
+				case TIMER_OV:
+				CLR_BIT(TCCR1A,COM1A1);
+				CLR_BIT(TCCR1A,COM1A0);
+				
+				CLR_BIT(TCCR1B,WGM13);
+				CLR_BIT(TCCR1B,WGM12);
+				CLR_BIT(TCCR1A,WGM11);
+				CLR_BIT(TCCR1A,WGM10);
+				
+				//SET_BIT(TIMSK, TOIE1);
+				/*Free running time base from init on: critical section, lock and busy times, hrt*/
+				returnValue = timer_resume(TIMER_1);
+				break;
+				
+				case TIMER_CTC:
+				break;
+				
+				case TIMER_PWM:
+				break;
+				
+				default:
+				returnValue = TIMER_NOK;
+				break;
+			}
+			break;
+			
+			case TIMER_2:
+			switch(str_timer_config[counter].waveformUsed)
+			{
+				case TIMER_OV:
+				/*Choosing Normal Mode*/
+				CLR_BIT(TCCR2,WGM21); CLR_BIT(TCCR2,WGM20);
+				/*Enabling OVF Interrupt 0*/
+				SET_BIT(TIMSK,TOIE2);
+				break;
+				
+				case TIMER_CTC:
+				/*Choosing CTC Mode*/
+				SET_BIT(TCCR0,WGM21); CLR_BIT(TCCR0,WGM20);
+				/*Enabling CTC Interrupt 0*/
+				SET_BIT(TIMSK,OCIE2);
+				break;
+				
+				case TIMER_PWM:
+				/*TO BE IMPLEMENTED*/
+				break;
+				
+				default:
+				returnValue = TIMER_NOK;
+				break;
+			}
+			break;
+			default:
+			returnValue =  TIMER_WRONG_TIMER_USED;
+			break;
+		}
+		if (returnValue)
+		{
+			break;
+		}
+	}
+	/*Global Interrupt is left as it was, the application enables it once everything is initialized*/
+	exit_critical(&lo_str_critical);
+	
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_set_time
+*					 (enu_timer_number_t enu_a_timerUsed, f32 f32_desiredTime)
+* @Description     : set the time at which the timer interrupts
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+*					 f32					f32_a_desiredTime
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_set_time(enu_timer_number_t enu_a_timerUsed, f32_t_ f32_desiredTime)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	uint32_t_ uint32_tickTime = 0;
+	uint32_t_ uint32_numberOfTicks = 0;
+	uint16_t_ uint16_TCNTValue = 0;
+	str_critical_t_ lo_str_critical;
+	
+	/*the OVF ISRs use the numbers of OVFs and the remaining ticks*/
+	enter_critical(&lo_str_critical, CRITICAL_SITE_TIMER);
+	switch(enu_a_timerUsed)
+	{
+		case TIMER_0:
+		switch(str_timer_config[enu_a_timerUsed].waveformUsed)
+		{
+			case TIMER_OV:
+			uint32_tickTime = str_timer_config[enu_a_timerUsed].prescalerUsed / XTAL_FREQ;
+			uint32_numberOfTicks = ((f32_desiredTime*1000)/uint32_tickTime);
+			
+			gl_uint32_timer0NumberOfOVFs = uint32_numberOfTicks / 256;
+			gl_uint8_timer0RemTicks = uint32_numberOfTicks % 256;
+			gl_uint32_timer0OVFCounter = 0;	/* a new time counts a full period */
+			
+			if (gl_uint8_timer0RemTicks)
+			{
+				TCNT0 = 256 - gl_uint8_timer0RemTicks;
+				gl_uint32_timer0NumberOfOVFs++;
+			}
+			break;
+			
+			case TIMER_CTC:
+			/*TO BE IMPLEMENTED*/
+			break;
+			
+			case TIMER_PWM:
+			/*DO NOTHING*/
+			break;
+			
+			default:
+			returnValue = TIMER_NOK;
+			break;
+		}
+		break;
+		
+		case TIMER_1:
+		switch(str_timer_config[enu_a_timerUsed].waveformUsed)
+		{
+			case TIMER_OV:
+			uint32_tickTime = str_timer_config[enu_a_timerUsed].prescalerUsed / XTAL_FREQ;
+			uint32_numberOfTicks = ((f32_desiredTime*1000)/uint32_tickTime);
+			
+			gl_uint32_timer1NumberOfOVFs = uint32_numberOfTicks / 65536;
+			gl_uint16_timer1RemTicks = uint32_numberOfTicks % 65536;
+			gl_uint32_timer1OVFCounter = 0;
+			
+			if (gl_uint16_timer1RemTicks)
+			{
+				uint16_TCNTValue = 65536 - gl_uint16_timer1RemTicks;
+				
+				TCNT1L |= uint16_TCNTValue;
+				TCNT1H |= (uint16_TCNTValue>>8);
+				
+				gl_uint32_timer2NumberOfOVFs++;
+			}
+			break;
+			
+			case TIMER_CTC:
+			/*TO BE IMPLEMENTED*/
+			break;
+			
+			case TIMER_PWM:
+			/*DO NOTHING*/
+			break;
+			
+			default:
+			returnValue = TIMER_NOK;
+			break;
+		}
+		break;
+		
+		case TIMER_2:
+		switch(str_timer_config[enu_a_timerUsed].waveformUsed)
+		{
+			case TIMER_OV:
+			uint32_tickTime = str_timer_config[enu_a_timerUsed].prescalerUsed / XTAL_FREQ;
+			uint32_numberOfTicks = ((f32_desiredTime*1000)/uint32_tickTime);
+			
+			gl_uint32_timer2NumberOfOVFs = uint32_numberOfTicks / 256;
+			gl_uint8_timer2RemTicks = uint32_numberOfTicks % 256;
+			gl_uint32_timer2OVFCounter = 0;
+			
+			if (gl_uint8_timer2RemTicks)
+			{
+				TCNT2 = 256 - gl_uint8_timer2RemTicks;
+				gl_uint32_timer2NumberOfOVFs++;
+			}
+			break;
+			
+			case TIMER_CTC:
+			/*TO BE IMPLEMENTED*/
+			break;
+			
+			case TIMER_PWM:
+			/*DO NOTHING*/
+			break;
+			
+			default:
+			returnValue = TIMER_NOK;
+			break;
+		}
+		break;
+		
+		default:
+		returnValue =  TIMER_WRONG_TIMER_USED;
+		break;
+		
+	}
+	exit_critical(&lo_str_critical);
+	return returnValue;
+}
+
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_resume(enu_timer_number_t enu_a_timerUsed)
+* @Description     : makes the timer to start/resume counting
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_resume(enu_timer_number_t enu_a_timerUsed)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	switch(enu_a_timerUsed)
+	{
+		case TIMER_0:
+		switch(str_timer_config[TIMER_0].prescalerUsed)
+		{
+			case TIMER_PRESCLNG_1:
+			CLR_BIT(TCCR0, CS02);	CLR_BIT(TCCR0, CS01);	SET_BIT(TCCR0, CS00);
+			break;
+			
+			case TIMER_PRESCLNG_8:
+			CLR_BIT(TCCR0, CS02);	SET_BIT(TCCR0, CS01);	CLR_BIT(TCCR0, CS00);
+			break;
+			
+			case TIMER_PRESCLNG_64:
+			CLR_BIT(TCCR0, CS02);	SET_BIT(TCCR0, CS01);	SET_BIT(TCCR0, CS00);
+			break;
+			
+			case TIMER_PRESCLNG_256:
+			SET_BIT(TCCR0, CS02);	CLR_BIT(TCCR0, CS01);	CLR_BIT(TCCR0, CS00);
+			break;
+			
+			case TIMER_PRESCLNG_1024:
+			SET_BIT(TCCR0, CS02);	CLR_BIT(TCCR0, CS01);	SET_BIT(TCCR0, CS00);
+			break;
+			
+			default: returnValue = TIMER_NOK;	break;
+		}
+		break;
+		
+		case TIMER_1:
+		switch(str_timer_config[TIMER_1].prescalerUsed)
+		{
+			case TIMER_PRESCLNG_1:
+			CLR_BIT(TCCR1B, CS12);	CLR_BIT(TCCR1B, CS11);	SET_BIT(TCCR1B, CS10);
+			break;
+			
+			case TIMER_PRESCLNG_8:
+			CLR_BIT(TCCR1B, CS12);	SET_BIT(TCCR1B, CS11);	CLR_BIT(TCCR1B, CS10);
+			break;
+			
+			case TIMER_PRESCLNG_64:
+			CLR_BIT(TCCR1B, CS12);	SET_BIT(TCCR1B, CS11);	SET_BIT(TCCR1B, CS10);
+			break;
+			
+			case TIMER_PRESCLNG_256:
+			SET_BIT(TCCR1B, CS12);	CLR_BIT(TCCR1B, CS11);	CLR_BIT(TCCR1B, CS10);
+			break;
+			
+			case TIMER_PRESCLNG_1024:
+			SET_BIT(TCCR1B, CS12);	CLR_BIT(TCCR1B, CS11);	SET_BIT(TCCR1B, CS10);
+			break;
+			
+			default: returnValue = TIMER_NOK;	break;
+		}
+		break;
+		
+		case TIMER_2:
+		switch(str_timer_config[TIMER_1].prescalerUsed)
+		{
+			case TIMER_PRESCLNG_1:
+			CLR_BIT(TCCR2,CS22); CLR_BIT(TCCR2,CS21);	SET_BIT(TCCR2,CS20);
+			break;
+			
+			case TIMER_PRESCLNG_8:
+			CLR_BIT(TCCR2,CS22); SET_BIT(TCCR2,CS21);	CLR_BIT(TCCR2,CS20);
+			break;
+			
+			case TIMER_PRESCLNG_64:
+			SET_BIT(TCCR2,CS22); CLR_BIT(TCCR2,CS21);	CLR_BIT(TCCR2,CS20);
+			break;
+			
+			case TIMER_PRESCLNG_256:
+			SET_BIT(TCCR2,CS22); SET_BIT(TCCR2,CS21);	CLR_BIT(TCCR2,CS20);
+			break;
+			
+			case TIMER_PRESCLNG_1024:
+			SET_BIT(TCCR2,CS22); SET_BIT(TCCR2,CS21);	SET_BIT(TCCR2,CS20);
+			break;
+			
+			default: returnValue = TIMER_NOK;	break;
+		}
+		break;
+		default:
+		returnValue =  TIMER_NOK;
+		break;
+		
+	}
+	return returnValue;
+}
+
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_pause(enu_timer_number_t enu_a_timerUsed)
+* @Description     : makes the timer to pause counting
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_pause(enu_timer_number_t enu_a_timerUsed)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	switch(enu_a_timerUsed)
+	{
+		case TIMER_0:
+		CLR_BIT(TCCR0, CS02);	CLR_BIT(TCCR0, CS01);	CLR_BIT(TCCR0, CS00);	break;
+		
+		case TIMER_1:
+		CLR_BIT(TCCR1B,CS12);	CLR_BIT(TCCR1B,CS11);	CLR_BIT(TCCR1B,CS10);	break;
+		
+		case TIMER_2:
+		CLR_BIT(TCCR2, CS22);	CLR_BIT(TCCR2, CS21);	CLR_BIT(TCCR2, CS20);	break;
+		
+		default:	
+		returnValue =			TIMER_WRONG_TIMER_USED;							break;
+		
+	}
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_disable_interrupt(enu_timer_number_t enu_a_timerUsed)
+* @Description     : Disables timer's interrupts
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_disable_interrupt(enu_timer_number_t enu_a_timerUsed)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	str_critical_t_ lo_str_critical;
+	
+	enter_critical(&lo_str_critical, CRITICAL_SITE_TIMER);
+	switch(enu_a_timerUsed)
+	{
+		case TIMER_0:	CLR_BIT(TIMSK,TOIE0);				break;
+		
+		case TIMER_1:	CLR_BIT(TIMSK,TOIE1);				break;
+		
+		case TIMER_2:	CLR_BIT(TIMSK,TOIE2);				break;
+		
+		default:	returnValue =  TIMER_WRONG_TIMER_USED;	break;
+		
+	}
+	exit_critical(&lo_str_critical);
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_enable_interrupt(enu_timer_number_t enu_a_timerUsed)
+* @Description     : Enables timer's interrupts
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_enable_interrupt(enu_timer_number_t enu_a_timerUsed)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	str_critical_t_ lo_str_critical;
+	
+	enter_critical(&lo_str_critical, CRITICAL_SITE_TIMER);
+	switch(enu_a_timerUsed)
+	{
+		case TIMER_0:	SET_BIT(TIMSK,TOIE0);				break;
+		
+		case TIMER_1:	SET_BIT(TIMSK,TOIE1);				break;
+		
+		case TIMER_2:	SET_BIT(TIMSK,TOIE2);				break;
+		
+		default:	returnValue =  TIMER_WRONG_TIMER_USED;	break;
+		
+	}
+	exit_critical(&lo_str_critical);
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_set_callback
+*					 (enu_timer_number_t enu_a_timerUsed, void (*funPtr)(void))
+* @Description     : sets the call back function for a specific timer
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+*					 void					(*funPtr)(void)
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_set_callback(enu_timer_number_t enu_a_timerUsed, void (*funPtr)(void))
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	
+	if(funPtr != NULL_PTR)	
+	{	
+		switch(enu_a_timerUsed)
+		{
+			case TIMER_0:	timer_0_callback = funPtr;			break;
+			
+			case TIMER_1:	timer_1_callback = funPtr;			break;
+			
+			case TIMER_2:	timer_2_callback = funPtr;			break;
+			
+			default:	returnValue = TIMER_WRONG_TIMER_USED;	break;
+		}
+	}
+	else
+	{
+		returnValue = TIMER_NOK;
+	}
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_set_callback_mode
+*					 (enu_timer_number_t enu_a_timerUsed, enu_timer_cbf_mode_t enu_a_cbfMode)
+* @Description     : chooses where the overflow call back of a timer runs, a
+*					 deferred call back is queued by the ISR to the deferred
+*					 work queue and run later by the SOS from task context
+*					 (compare call backs always run in the ISR)
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+*					 enu_timer_cbf_mode_t		enu_a_cbfMode
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_set_callback_mode(enu_timer_number_t enu_a_timerUsed, enu_timer_cbf_mode_t enu_a_cbfMode)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	
+	if((enu_a_cbfMode == TIMER_CBF_IMMEDIATE) || (enu_a_cbfMode == TIMER_CBF_DEFERRED))
+	{
+		switch(enu_a_timerUsed)
+		{
+			case TIMER_0:
+			case TIMER_1:
+			case TIMER_2:	timer_callback_mode[enu_a_timerUsed] = enu_a_cbfMode;	break;
+			
+			default:	returnValue = TIMER_WRONG_TIMER_USED;						break;
+		}
+	}
+	else
+	{
+		returnValue = TIMER_NOK;
+	}
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_get_elapsed_us
+*					 (enu_timer_number_t enu_a_timerUsed, uint32_t_* ptr_uint32_a_elapsedUs)
+* @Description     : gets the time passed since the timer last called its
+*					 callback (time set by timer_set_time), normal mode only,
+*					 TIMER_NOK for a timer missing from str_timer_config
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+* @Parameters (out): uint32_t_				*ptr_uint32_a_elapsedUs
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_get_elapsed_us(enu_timer_number_t enu_a_timerUsed, uint32_t_* ptr_uint32_a_elapsedUs)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	uint32_t_ uint32_OVFs = 0;
+	uint32_t_ uint32_counts = 0;
+	uint32_t_ uint32_startCount = 0;
+	str_critical_t_ lo_str_critical;
+	
+	if(ptr_uint32_a_elapsedUs == NULL_PTR)
+	{
+		return TIMER_NOK;
+	}
+	
+	/*
+	 * elapsed counts = OVFs * timer top + TCNT - preload, the OVF counter is
+	 * read twice so an overflow between the two reads is not lost
+	 */
+	switch(enu_a_timerUsed)
+	{
+		case TIMER_0:
+		do
+		{
+			uint32_OVFs = gl_uint32_timer0OVFCounter;
+			uint32_counts = TCNT0;
+		} while(uint32_OVFs != gl_uint32_timer0OVFCounter);
+		uint32_startCount = gl_uint8_timer0RemTicks ? (256 - gl_uint8_timer0RemTicks) : 0;
+		uint32_counts = (uint32_OVFs * 256) + uint32_counts - uint32_startCount;
+		break;
+		
+		case TIMER_1:
+		do
+		{
+			/*16 bit timer registers share one TEMP byte with the ISRs*/
+			enter_critical(&lo_str_critical, CRITICAL_SITE_TIMER);
+			uint32_OVFs = gl_uint32_timer1OVFCounter;
+			uint32_counts = TCNT1;
+			exit_critical(&lo_str_critical);
+		} while(uint32_OVFs != gl_uint32_timer1OVFCounter);
+		uint32_startCount = gl_uint16_timer1RemTicks ? (65536 - gl_uint16_timer1RemTicks) : 0;
+		uint32_counts = (uint32_OVFs * 65536) + uint32_counts - uint32_startCount;
+		break;
+		
+		case TIMER_2:
+		do
+		{
+			uint32_OVFs = gl_uint32_timer2OVFCounter;
+			uint32_counts = TCNT2;
+		} while(uint32_OVFs != gl_uint32_timer2OVFCounter);
+		uint32_startCount = gl_uint8_timer2RemTicks ? (256 - gl_uint8_timer2RemTicks) : 0;
+		uint32_counts = (uint32_OVFs * 256) + uint32_counts - uint32_startCount;
+		break;
+		
+		default:
+		returnValue = TIMER_WRONG_TIMER_USED;
+		break;
+	}
+	
+	if(returnValue == TIMER_OK)
+	{
+		/*the config table only lists the timers in use, look the entry up by timer*/
+		returnValue = TIMER_NOK;
+		for(uint8_t_ uint8_index = 0; uint8_index < NUMBER_OF_TIMERS_USED; uint8_index++)
+		{
+			if(str_timer_config[uint8_index].timerUsed == enu_a_timerUsed)
+			{
+				*ptr_uint32_a_elapsedUs = (uint32_counts * str_timer_config[uint8_index].prescalerUsed) / XTAL_FREQ;
+				returnValue = TIMER_OK;
+				break;
+			}
+		}
+	}
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_get_count
+*					 (enu_timer_number_t enu_a_timerUsed, uint16_t_* ptr_uint16_a_count)
+* @Description     : reads the current counter value of a timer
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t		enu_a_timerUsed
+* @Parameters (out): uint16_t_				*ptr_uint16_a_count
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_get_count(enu_timer_number_t enu_a_timerUsed, uint16_t_* ptr_uint16_a_count)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	str_critical_t_ lo_str_critical;
+	
+	if(ptr_uint16_a_count == NULL_PTR)
+	{
+		return TIMER_NOK;
+	}
+	
+	switch(enu_a_timerUsed)
+	{
+		case TIMER_0:	*ptr_uint16_a_count = TCNT0;	break;
+		case TIMER_1:
+		/*16 bit timer registers share one TEMP byte with the ISRs*/
+		enter_critical(&lo_str_critical, CRITICAL_SITE_TIMER);
+		*ptr_uint16_a_count = TCNT1;
+		exit_critical(&lo_str_critical);
+		break;
+		case TIMER_2:	*ptr_uint16_a_count = TCNT2;	break;
+		default:		returnValue = TIMER_WRONG_TIMER_USED;	break;
+	}
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_compare_set
+*					 (enu_timer_number_t enu_a_timerUsed, enu_timer_compare_channel_t enu_a_channel,
+*					  uint16_t_ uint16_a_count)
+* @Description     : arms a compare channel of a free running (normal mode)
+*					 timer, its interrupt fires once the counter reaches
+*					 uint16_a_count, TIMER_1 only
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t			enu_a_timerUsed
+*					 enu_timer_compare_channel_t	enu_a_channel
+*					 uint16_t_						uint16_a_count
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_compare_set(enu_timer_number_t enu_a_timerUsed, enu_timer_compare_channel_t enu_a_channel, uint16_t_ uint16_a_count)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	str_critical_t_ lo_str_critical;
+	
+	if(enu_a_timerUsed != TIMER_1)
+	{
+		returnValue = TIMER_WRONG_TIMER_USED;
+	}
+	else
+	{
+		/* TIFR flags are cleared by writing 1, a read-modify-write would clear the others too */
+		enter_critical(&lo_str_critical, CRITICAL_SITE_TIMER);
+		switch(enu_a_channel)
+		{
+			case TIMER_COMPARE_A:
+			OCR1A = uint16_a_count;
+			TIFR = (1 << OCF1A);
+			SET_BIT(TIMSK, OCIE1A);
+			break;
+			
+			case TIMER_COMPARE_B:
+			OCR1B = uint16_a_count;
+			TIFR = (1 << OCF1B);
+			SET_BIT(TIMSK, OCIE1B);
+			break;
+			
+			default:
+			returnValue = TIMER_NOK;
+			break;
+		}
+		exit_critical(&lo_str_critical);
+	}
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_compare_disable
+*					 (enu_timer_number_t enu_a_timerUsed, enu_timer_compare_channel_t enu_a_channel)
+* @Description     : disarms a compare channel, TIMER_1 only
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t			enu_a_timerUsed
+*					 enu_timer_compare_channel_t	enu_a_channel
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_compare_disable(enu_timer_number_t enu_a_timerUsed, enu_timer_compare_channel_t enu_a_channel)
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	str_critical_t_ lo_str_critical;
+	
+	if(enu_a_timerUsed != TIMER_1)
+	{
+		returnValue = TIMER_WRONG_TIMER_USED;
+	}
+	else
+	{
+		enter_critical(&lo_str_critical, CRITICAL_SITE_TIMER);
+		switch(enu_a_channel)
+		{
+			case TIMER_COMPARE_A:	CLR_BIT(TIMSK, OCIE1A);		break;
+			case TIMER_COMPARE_B:	CLR_BIT(TIMSK, OCIE1B);		break;
+			default:				returnValue = TIMER_NOK;	break;
+		}
+		exit_critical(&lo_str_critical);
+	}
+	return returnValue;
+}
+
+/******************************************************************************
+* @Syntax          : enu_timer_error_t timer_compare_set_callback
+*					 (enu_timer_number_t enu_a_timerUsed, enu_timer_compare_channel_t enu_a_channel,
+*					  void (*funPtr)(void))
+* @Description     : sets the function called on a compare match, TIMER_1 only
+* @Sync\Async      : Synchronous
+* @Reentrancy      : Reentrant
+* @Parameters (in) : enu_timer_number_t			enu_a_timerUsed
+*					 enu_timer_compare_channel_t	enu_a_channel
+*					 void (*funPtr)(void)
+* @Parameters (out): None
+* @Return value:   : enu_timer_error_t		TIMER_OK = 0
+*											TIMER_WRONG_TIMER_USED = 1
+*											TIMER_WRONG_DESIRED_TIME = 2
+*											TIMER_NOK = 3
+*******************************************************************************/
+enu_timer_error_t timer_compare_set_callback(enu_timer_number_t enu_a_timerUsed, enu_timer_compare_channel_t enu_a_channel, void (*funPtr)(void))
+{
+	enu_timer_error_t returnValue = TIMER_OK;
+	
+	if(enu_a_timerUsed != TIMER_1)
+	{
+		returnValue = TIMER_WRONG_TIMER_USED;
+	}
+	else if((enu_a_channel >= TIMER_COMPARE_TOTAL) || (funPtr == NULL_PTR))
+	{
+		returnValue = TIMER_NOK;
+	}
+	else
+	{
+		timer_1_compare_callback[enu_a_channel] = funPtr;
+	}
+	return returnValue;
+}
+
+ISR(TIM0_OVF_INT)
+{
+	if (gl_uint8_normalToPwm == 0	)
+	{
+		gl_uint32_timer0OVFCounter ++;
+		if (gl_uint32_timer0OVFCounter == gl_uint32_timer0NumberOfOVFs)
+		{
+			/*
+			 * re-arm before the callback, it may not return for a long time
+			 * (SOS preemptive kernel switches to a task from inside it)
+			 */
+			gl_uint32_timer0OVFCounter   =	0;
+			TCNT0 = 256 - gl_uint8_timer0RemTicks;
+			if(timer_0_callback == NULL_PTR)
+			{
+				/* Do Nothing */
+			}
+			else if(timer_callback_mode[TIMER_0] == TIMER_CBF_DEFERRED)
+			{
+				dwq_post(timer_0_callback);
+			}
+			else
+			{
+				timer_0_callback();
+			}
+		}
+	}
+	else
+	{
+		/*TO BE IMPLEMENT*/
+	}
+}
+
+ISR(TIM1_OVF_INT)
+{
+	gl_uint32_timer1OVFCounter ++;
+	if (gl_uint32_timer1OVFCounter  == gl_uint32_timer1NumberOfOVFs)
+	{
+		if(timer_1_callback == NULL_PTR)
+		{
+			/* Do Nothing */
+		}
+		else if(timer_callback_mode[TIMER_1] == TIMER_CBF_DEFERRED)
+		{
+			dwq_post(timer_1_callback);
+		}
+		else
+		{
+			timer_1_callback();
+		}
+		gl_uint32_timer1OVFCounter  =	0;
+		TCNT1 = 65536 - gl_uint16_timer1RemTicks;
+		
+	}
+
+}
+
+ISR(TIM1_COMPA_INT)
+{
+	if(timer_1_compare_callback[TIMER_COMPARE_A] != NULL_PTR)
+	{
+		timer_1_compare_callback[TIMER_COMPARE_A]();
+	}
+}
+
+ISR(TIM1_COMPB_INT)
+{
+	if(timer_1_compare_callback[TIMER_COMPARE_B] != NULL_PTR)
+	{
+		timer_1_compare_callback[TIMER_COMPARE_B]();
+	}
+}
+
+ISR(TIM2_OVF_INT)
+{
+	gl_uint32_timer2OVFCounter ++;
+	if (gl_uint32_timer2OVFCounter  == gl_uint32_timer2NumberOfOVFs)
+	{
+		if(timer_2_callback == NULL_PTR)
+		{
+			/* Do Nothing */
+		}
+		else if(timer_callback_mode[TIMER_2] == TIMER_CBF_DEFERRED)
+		{
+			dwq_post(timer_2_callback);
+		}
+		else
+		{
+			timer_2_callback();
+		}
+		gl_uint32_timer2OVFCounter  =	0;
+		TCNT2 = 256 - gl_uint8_timer2RemTicks;
+		
+	}
+
+}
+/**********************************************************************************************************************
+ *  END OF FILE: timer_program.c
+ *********************************************************************************************************************/
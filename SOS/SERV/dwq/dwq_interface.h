@@ -0,0 +1,76 @@
+/**
+ * @fileName	:	dwq_interface.h
+ * @Created		: 	4:40 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for the deferred work queue (bottom halves)
+ *
+ * An ISR posts its callback to a ring buffer in constant time without masking
+ * interrupts and returns, the Simple Operating System drains the queue from
+ * task context before the tasks of every scheduler pass (cooperative kernel)
+ * or before every job (preemptive kernel), and while idle.
+ * The ring has a single producer (AVR ISRs do not nest) and a single consumer,
+ * so dwq_post is for ISR context only, task code calls its work directly.
+ */
+
+
+#ifndef DWQ_INTERFACE_H_
+#define DWQ_INTERFACE_H_
+
+#include "std.h"
+
+typedef void(*ptr_func_dwq_work_t_)(void);
+
+typedef enum
+{
+	DWQ_STATUS_SUCCESS				= 0	,
+	DWQ_STATUS_INVALID_ARGS				,
+	DWQ_STATUS_QUEUE_FULL				,
+	DWQ_STATUS_TOTAL
+}enu_dwq_status_t_;
+
+/*
+ * uint16_max_work_us is the longest deferred callback, the time it would have
+ * kept interrupts disabled if it ran in its ISR, measured on the TIMER_1 1 us
+ * counter started by timer_init
+ */
+typedef struct
+{
+	uint32_t_	uint32_posted;
+	uint32_t_	uint32_dropped;
+	uint8_t_	uint8_max_depth;
+	uint16_t_	uint16_max_work_us;
+}str_dwq_stats_t_;
+
+
+/**
+ *	@brief		                            :	Empties the queue and resets the statistics, called by sos_init
+ */
+void dwq_init(void);
+
+/**
+ *	@brief		                            :	Queues a callback to run later from task context, O(1),
+ *	                                            ISR context only
+ *  @param[in]      ptr_func_work           :   Callback to queue
+ *
+ *  @Return     DWQ_STATUS_SUCCESS		    :	Success
+ *              DWQ_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              DWQ_STATUS_QUEUE_FULL       :   Failed,     No free slot, the work is dropped and counted
+ */
+enu_dwq_status_t_ dwq_post(ptr_func_dwq_work_t_ ptr_func_work);
+
+/**
+ *	@brief		                            :	Runs the queued callbacks in posting order, work posted meanwhile
+ *	                                            is run by the same call, called by the SOS scheduler
+ */
+void dwq_drain(void);
+
+/**
+ *	@brief		                            :	Gets the queue statistics since dwq_init
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ *
+ *  @Return     DWQ_STATUS_SUCCESS		    :	Success
+ *              DWQ_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_dwq_status_t_ dwq_get_stats(str_dwq_stats_t_ * ptr_str_stats);
+
+#endif /* DWQ_INTERFACE_H_ */
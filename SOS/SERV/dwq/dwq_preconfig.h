@@ -0,0 +1,15 @@
+/**
+ * @fileName	:	dwq_preconfig.h
+ * @Created		: 	4:40 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Pre-compiled configurations file for the deferred work queue
+ */
+
+
+#ifndef DWQ_PRECONFIG_H_
+#define DWQ_PRECONFIG_H_
+
+/* queue slots, power of 2 up to 128, one slot is kept free to tell full from empty */
+#define DWQ_QUEUE_SIZE					16
+
+#endif /* DWQ_PRECONFIG_H_ */
@@ -0,0 +1,37 @@
+/**
+ * @fileName	:	dwq_private.h
+ * @Created		: 	4:40 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Private file for the deferred work queue
+ */
+
+
+#ifndef DWQ_PRIVATE_H_
+#define DWQ_PRIVATE_H_
+
+#include "dwq_interface.h"
+#include "dwq_preconfig.h"
+#include "sos_preconfig.h"
+#include "timer_interface.h"
+#include "critical.h"
+
+#if ((DWQ_QUEUE_SIZE & (DWQ_QUEUE_SIZE - 1)) != 0) || (DWQ_QUEUE_SIZE > 128) || (DWQ_QUEUE_SIZE < 2)
+#error "DWQ_QUEUE_SIZE must be a power of 2 between 2 and 128"
+#endif
+
+#define DWQ_INDEX_MASK					(DWQ_QUEUE_SIZE - 1)
+
+/*
+ * posting never locks, the head is only written by ISRs and the tail only by
+ * the consumer. The preemptive kernel drains from every job, a drain preempted
+ * by a higher priority job is left to finish (one consumer at a time).
+ */
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+#define DWQ_LOCK(PTR_CRITICAL)		enter_critical((PTR_CRITICAL), CRITICAL_SITE_DWQ)
+#define DWQ_UNLOCK(PTR_CRITICAL)	exit_critical(PTR_CRITICAL)
+#else
+#define DWQ_LOCK(PTR_CRITICAL)		((void)(PTR_CRITICAL))
+#define DWQ_UNLOCK(PTR_CRITICAL)	((void)(PTR_CRITICAL))
+#endif
+
+#endif /* DWQ_PRIVATE_H_ */
@@ -0,0 +1,152 @@
+/**
+ * @fileName	:	dwq_program.c
+ * @Created		: 	4:40 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Program file for the deferred work queue
+ */
+#include "dwq_private.h"
+
+static INSTANCE ptr_func_dwq_work_t_ volatile	gl_arr_ptr_func_dwq_queue[DWQ_QUEUE_SIZE];
+static INSTANCE volatile uint8_t_		gl_uint8_dwq_head = 0;		/* written by ISRs only */
+static INSTANCE volatile uint8_t_		gl_uint8_dwq_tail = 0;		/* written by the consumer only */
+static INSTANCE uint8_t_					gl_uint8_dwq_draining = FALSE;
+static INSTANCE volatile str_dwq_stats_t_	gl_str_dwq_stats;
+
+/**
+ *	@brief		                            :	Empties the queue and resets the statistics, called by sos_init
+ */
+void dwq_init(void)
+{
+    gl_uint8_dwq_tail                       = gl_uint8_dwq_head;
+    gl_uint8_dwq_draining                   = FALSE;
+    gl_str_dwq_stats.uint32_posted          = 0;
+    gl_str_dwq_stats.uint32_dropped         = 0;
+    gl_str_dwq_stats.uint8_max_depth        = 0;
+    gl_str_dwq_stats.uint16_max_work_us     = 0;
+}
+
+/**
+ *	@brief		                            :	Queues a callback to run later from task context, O(1),
+ *	                                            ISR context only
+ *  @param[in]      ptr_func_work           :   Callback to queue
+ *
+ *  @Return     DWQ_STATUS_SUCCESS		    :	Success
+ *              DWQ_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              DWQ_STATUS_QUEUE_FULL       :   Failed,     No free slot, the work is dropped and counted
+ */
+enu_dwq_status_t_ dwq_post(ptr_func_dwq_work_t_ ptr_func_work)
+{
+    enu_dwq_status_t_ enu_dwq_status_retval = DWQ_STATUS_SUCCESS;
+    uint8_t_ uint8_head = gl_uint8_dwq_head;
+    uint8_t_ uint8_next = (uint8_head + 1) & DWQ_INDEX_MASK;
+    uint8_t_ uint8_depth;
+
+    if(NULL_PTR == ptr_func_work)
+    {
+        enu_dwq_status_retval = DWQ_STATUS_INVALID_ARGS;
+    }
+    else if(uint8_next == gl_uint8_dwq_tail)
+    {
+        gl_str_dwq_stats.uint32_dropped++;
+        enu_dwq_status_retval = DWQ_STATUS_QUEUE_FULL;
+    }
+    else
+    {
+        /* slot first, then publish it by moving the head (single byte store) */
+        gl_arr_ptr_func_dwq_queue[uint8_head]   = ptr_func_work;
+        gl_uint8_dwq_head                       = uint8_next;
+
+        gl_str_dwq_stats.uint32_posted++;
+        uint8_depth = (uint8_next - gl_uint8_dwq_tail) & DWQ_INDEX_MASK;
+        if(uint8_depth > gl_str_dwq_stats.uint8_max_depth)
+        {
+            gl_str_dwq_stats.uint8_max_depth = uint8_depth;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return enu_dwq_status_retval;
+}
+
+/**
+ *	@brief		                            :	Runs the queued callbacks in posting order, work posted meanwhile
+ *	                                            is run by the same call, called by the SOS scheduler
+ */
+void dwq_drain(void)
+{
+    ptr_func_dwq_work_t_ ptr_func_work;
+    uint16_t_ uint16_start = 0;
+    uint16_t_ uint16_end = 0;
+    uint8_t_ uint8_tail;
+    str_critical_t_ lo_str_critical;
+
+    DWQ_LOCK(&lo_str_critical);
+    if(TRUE == gl_uint8_dwq_draining)
+    {
+        DWQ_UNLOCK(&lo_str_critical);
+        return;
+    }
+    else
+    {
+        gl_uint8_dwq_draining = TRUE;
+    }
+    DWQ_UNLOCK(&lo_str_critical);
+
+    uint8_tail = gl_uint8_dwq_tail;
+    while(uint8_tail != gl_uint8_dwq_head)
+    {
+        ptr_func_work = gl_arr_ptr_func_dwq_queue[uint8_tail];
+
+        /* free the slot before the call, the work may be posted again meanwhile */
+        uint8_tail          = (uint8_tail + 1) & DWQ_INDEX_MASK;
+        gl_uint8_dwq_tail   = uint8_tail;
+
+        timer_get_count(TIMER_1, &uint16_start);
+        ptr_func_work();
+        timer_get_count(TIMER_1, &uint16_end);
+
+        if((uint16_t_)(uint16_end - uint16_start) > gl_str_dwq_stats.uint16_max_work_us)
+        {
+            gl_str_dwq_stats.uint16_max_work_us = uint16_end - uint16_start;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    gl_uint8_dwq_draining = FALSE;
+}
+
+/**
+ *	@brief		                            :	Gets the queue statistics since dwq_init
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ *
+ *  @Return     DWQ_STATUS_SUCCESS		    :	Success
+ *              DWQ_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_dwq_status_t_ dwq_get_stats(str_dwq_stats_t_ * ptr_str_stats)
+{
+    enu_dwq_status_t_ enu_dwq_status_retval = DWQ_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_stats)
+    {
+        enu_dwq_status_retval = DWQ_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        /* counters are written by ISRs, copy them in one piece */
+        enter_critical(&lo_str_critical, CRITICAL_SITE_DWQ);
+        ptr_str_stats->uint32_posted        = gl_str_dwq_stats.uint32_posted;
+        ptr_str_stats->uint32_dropped       = gl_str_dwq_stats.uint32_dropped;
+        ptr_str_stats->uint8_max_depth      = gl_str_dwq_stats.uint8_max_depth;
+        ptr_str_stats->uint16_max_work_us   = gl_str_dwq_stats.uint16_max_work_us;
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_dwq_status_retval;
+}
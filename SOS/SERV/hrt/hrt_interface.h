@@ -0,0 +1,88 @@
+/**
+ * @fileName	:	hrt_interface.h
+ * @Created		: 	3:10 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for the high resolution timer service, sub-tick one-shot
+ *					timers on the TIMER_1 compare match A/B channels
+ *
+ * TIMER_1 runs free in normal mode, pending timers are kept in a list sorted by
+ * expiry and the two nearest ones are armed on compare A and B, so two close
+ * expiries are both served by hardware. Callbacks run in the compare ISR.
+ */
+
+
+#ifndef HRT_INTERFACE_H_
+#define HRT_INTERFACE_H_
+
+#include "std.h"
+
+typedef void(*ptr_func_hrt_callback_t_)(void);
+
+typedef enum
+{
+	HRT_STATUS_SUCCESS				= 0	,
+	HRT_STATUS_FAILED					,
+	HRT_STATUS_INVALID_ARGS				,
+	HRT_STATUS_NOT_RUNNING				,
+	HRT_STATUS_TOTAL
+}enu_hrt_status_t_;
+
+typedef struct str_hrt_timer_t_
+{
+	/** Owned by HRT */
+	struct str_hrt_timer_t_ *	ptr_str_next;
+	uint16_t_					uint16_expiry;			/* TIMER_1 count				*/
+	uint8_t_					uint8_channel;			/* armed compare channel or none	*/
+	uint8_t_					uint8_running;
+	ptr_func_hrt_callback_t_	ptr_func_callback;
+}str_hrt_timer_t_;
+
+/* Firing error = counter at callback entry - requested expiry */
+typedef struct
+{
+	uint32_t_	uint32_fired;
+	uint32_t_	uint32_total_error_us;
+	uint16_t_	uint16_max_error_us;
+}str_hrt_stats_t_;
+
+
+/**
+ *	@brief		                            :	Hooks the compare channels of TIMER_1, the free running counter
+ *	                                            started by timer_init (resumed here if it was paused)
+ *
+ *  @Return     HRT_STATUS_SUCCESS		    :	Success
+ *              HRT_STATUS_FAILED           :   Failed,     Timer driver error
+ */
+enu_hrt_status_t_ hrt_init(void);
+
+/**
+ *	@brief		                            :	Starts (or re-arms) a one-shot timer
+ *  @param[in,out]  ptr_str_timer 	        :   Caller owned, zero initialized timer
+ *  @param[in]      uint16_delay_us         :   Delay from now in microseconds
+ *  @param[in]      ptr_func_callback       :   Called from the compare ISR on expiry
+ *
+ *  @Return     HRT_STATUS_SUCCESS		    :	Success
+ *              HRT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or delay above HRT_MAX_DELAY_COUNTS
+ */
+enu_hrt_status_t_ hrt_start(str_hrt_timer_t_ * ptr_str_timer, uint16_t_ uint16_delay_us, ptr_func_hrt_callback_t_ ptr_func_callback);
+
+/**
+ *	@brief		                            :	Cancels a pending timer
+ *  @param[in,out]  ptr_str_timer 	        :   Timer to cancel
+ *
+ *  @Return     HRT_STATUS_SUCCESS		    :	Success
+ *              HRT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              HRT_STATUS_NOT_RUNNING      :   Failed,     Timer already fired or never started
+ */
+enu_hrt_status_t_ hrt_cancel(str_hrt_timer_t_ * ptr_str_timer);
+
+/**
+ *	@brief		                            :	Gets the firing error statistics since hrt_init
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ *
+ *  @Return     HRT_STATUS_SUCCESS		    :	Success
+ *              HRT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_hrt_status_t_ hrt_get_stats(str_hrt_stats_t_ * ptr_str_stats);
+
+#endif /* HRT_INTERFACE_H_ */
@@ -0,0 +1,21 @@
+/**
+ * @fileName	:	hrt_preconfig.h
+ * @Created		: 	3:10 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Pre-compiled configurations file for the high resolution timer service
+ */
+
+
+#ifndef HRT_PRECONFIG_H_
+#define HRT_PRECONFIG_H_
+
+/* must match the TIMER_1 entry of timer_cfg.c (8 -> 1 count per us @ 8 MHz) */
+#define HRT_TIMER_PRESCALER				8
+
+/* a compare closer than this to the counter may be missed, it is pushed to now + lead */
+#define HRT_MIN_LEAD_COUNTS				16
+
+/* longest delay, keeps the rest of the 16 bit counter range to detect late expiries */
+#define HRT_MAX_DELAY_COUNTS			0xF000
+
+#endif /* HRT_PRECONFIG_H_ */
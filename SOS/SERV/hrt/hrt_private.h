@@ -0,0 +1,34 @@
+/**
+ * @fileName	:	hrt_private.h
+ * @Created		: 	3:10 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Private file for the high resolution timer service
+ */
+
+
+#ifndef HRT_PRIVATE_H_
+#define HRT_PRIVATE_H_
+
+#include "hrt_interface.h"
+#include "hrt_preconfig.h"
+#include "timer_cfg.h"
+#include "critical.h"
+
+#define HRT_CHANNEL_NONE				0xFF
+
+#define HRT_US_TO_COUNTS(US)			((uint16_t_)(((uint32_t_)(US) * XTAL_FREQ) / HRT_TIMER_PRESCALER))
+#define HRT_COUNTS_TO_US(COUNTS)		((uint16_t_)(((uint32_t_)(COUNTS) * HRT_TIMER_PRESCALER) / XTAL_FREQ))
+
+/* list updates mask the compare ISRs, a callback updating the list keeps them masked */
+#define HRT_LOCK(PTR_CRITICAL)		enter_critical((PTR_CRITICAL), CRITICAL_SITE_HRT)
+#define HRT_UNLOCK(PTR_CRITICAL)	exit_critical(PTR_CRITICAL)
+
+static void			hrt_insert			(str_hrt_timer_t_ * ptr_str_timer);
+static void			hrt_remove			(str_hrt_timer_t_ * ptr_str_timer);
+static void			hrt_arm				(void);
+static uint16_t_	hrt_remaining		(uint16_t_ uint16_expiry, uint16_t_ uint16_now);
+static void			hrt_compare_handler	(enu_timer_compare_channel_t enu_channel);
+static void			hrt_compare_a_isr	(void);
+static void			hrt_compare_b_isr	(void);
+
+#endif /* HRT_PRIVATE_H_ */
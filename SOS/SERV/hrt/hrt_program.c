@@ -0,0 +1,367 @@
+/**
+ * @fileName	:	hrt_program.c
+ * @Created		: 	3:10 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Program file for the high resolution timer service
+ */
+#include "hrt_private.h"
+
+static INSTANCE str_hrt_timer_t_ *	gl_ptr_str_hrt_head = NULL_PTR;							/* nearest expiry first */
+static INSTANCE str_hrt_timer_t_ *	gl_arr_ptr_str_hrt_armed[TIMER_COMPARE_TOTAL] = {NULL_PTR, NULL_PTR};
+static INSTANCE str_hrt_stats_t_		gl_str_hrt_stats;
+
+/**
+ *	@brief		                            :	Hooks the compare channels of TIMER_1, the free running counter
+ *	                                            started by timer_init (resumed here if it was paused)
+ *
+ *  @Return     HRT_STATUS_SUCCESS		    :	Success
+ *              HRT_STATUS_FAILED           :   Failed,     Timer driver error
+ */
+enu_hrt_status_t_ hrt_init(void)
+{
+    enu_hrt_status_t_ enu_hrt_status_retval = HRT_STATUS_SUCCESS;
+
+    gl_ptr_str_hrt_head                                 = NULL_PTR;
+    gl_arr_ptr_str_hrt_armed[TIMER_COMPARE_A]           = NULL_PTR;
+    gl_arr_ptr_str_hrt_armed[TIMER_COMPARE_B]           = NULL_PTR;
+    gl_str_hrt_stats.uint32_fired                       = 0;
+    gl_str_hrt_stats.uint32_total_error_us              = 0;
+    gl_str_hrt_stats.uint16_max_error_us                = 0;
+
+    if(
+            (TIMER_OK != timer_compare_disable(TIMER_1, TIMER_COMPARE_A))                       ||
+            (TIMER_OK != timer_compare_disable(TIMER_1, TIMER_COMPARE_B))                       ||
+            (TIMER_OK != timer_compare_set_callback(TIMER_1, TIMER_COMPARE_A, hrt_compare_a_isr)) ||
+            (TIMER_OK != timer_compare_set_callback(TIMER_1, TIMER_COMPARE_B, hrt_compare_b_isr)) ||
+            (TIMER_OK != timer_resume(TIMER_1))
+            )
+    {
+        enu_hrt_status_retval = HRT_STATUS_FAILED;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return enu_hrt_status_retval;
+}
+
+/**
+ *	@brief		                            :	Starts (or re-arms) a one-shot timer
+ *  @param[in,out]  ptr_str_timer 	        :   Caller owned, zero initialized timer
+ *  @param[in]      uint16_delay_us         :   Delay from now in microseconds
+ *  @param[in]      ptr_func_callback       :   Called from the compare ISR on expiry
+ *
+ *  @Return     HRT_STATUS_SUCCESS		    :	Success
+ *              HRT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or delay above HRT_MAX_DELAY_COUNTS
+ */
+enu_hrt_status_t_ hrt_start(str_hrt_timer_t_ * ptr_str_timer, uint16_t_ uint16_delay_us, ptr_func_hrt_callback_t_ ptr_func_callback)
+{
+    enu_hrt_status_t_ enu_hrt_status_retval = HRT_STATUS_SUCCESS;
+    uint16_t_ uint16_now = 0;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_timer)     ||
+            (NULL_PTR == ptr_func_callback) ||
+            (((uint32_t_)uint16_delay_us * XTAL_FREQ) / HRT_TIMER_PRESCALER > HRT_MAX_DELAY_COUNTS)
+            )
+    {
+        enu_hrt_status_retval = HRT_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        HRT_LOCK(&lo_str_critical);
+        if(TRUE == ptr_str_timer->uint8_running)
+        {
+            hrt_remove(ptr_str_timer);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        timer_get_count(TIMER_1, &uint16_now);
+        ptr_str_timer->uint16_expiry        = uint16_now + HRT_US_TO_COUNTS(uint16_delay_us);
+        ptr_str_timer->ptr_func_callback    = ptr_func_callback;
+        hrt_insert(ptr_str_timer);
+        hrt_arm();
+        HRT_UNLOCK(&lo_str_critical);
+    }
+
+    return enu_hrt_status_retval;
+}
+
+/**
+ *	@brief		                            :	Cancels a pending timer
+ *  @param[in,out]  ptr_str_timer 	        :   Timer to cancel
+ *
+ *  @Return     HRT_STATUS_SUCCESS		    :	Success
+ *              HRT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              HRT_STATUS_NOT_RUNNING      :   Failed,     Timer already fired or never started
+ */
+enu_hrt_status_t_ hrt_cancel(str_hrt_timer_t_ * ptr_str_timer)
+{
+    enu_hrt_status_t_ enu_hrt_status_retval = HRT_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_timer)
+    {
+        enu_hrt_status_retval = HRT_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        HRT_LOCK(&lo_str_critical);
+        if(TRUE == ptr_str_timer->uint8_running)
+        {
+            hrt_remove(ptr_str_timer);
+            hrt_arm();
+        }
+        else
+        {
+            enu_hrt_status_retval = HRT_STATUS_NOT_RUNNING;
+        }
+        HRT_UNLOCK(&lo_str_critical);
+    }
+
+    return enu_hrt_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the firing error statistics since hrt_init
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ *
+ *  @Return     HRT_STATUS_SUCCESS		    :	Success
+ *              HRT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_hrt_status_t_ hrt_get_stats(str_hrt_stats_t_ * ptr_str_stats)
+{
+    enu_hrt_status_t_ enu_hrt_status_retval = HRT_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_stats)
+    {
+        enu_hrt_status_retval = HRT_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        HRT_LOCK(&lo_str_critical);
+        *ptr_str_stats = gl_str_hrt_stats;
+        HRT_UNLOCK(&lo_str_critical);
+    }
+
+    return enu_hrt_status_retval;
+}
+
+/**
+ * @brief a private function to get the counts left until an expiry, an expiry
+ *		  already passed (late) counts as 0
+ *
+ * @param uint16_expiry : TIMER_1 count of the expiry
+ * @param uint16_now    : current TIMER_1 count
+ *
+ * @return counts left
+ */
+static uint16_t_ hrt_remaining(uint16_t_ uint16_expiry, uint16_t_ uint16_now)
+{
+    uint16_t_ uint16_remaining = uint16_expiry - uint16_now;
+
+    return (uint16_remaining > HRT_MAX_DELAY_COUNTS) ? 0 : uint16_remaining;
+}
+
+/**
+ * @brief a private function to link a timer in the list sorted by expiry
+ *
+ * @param ptr_str_timer : the timer to link (not in the list, expiry set)
+ *
+ * @return
+ */
+static void hrt_insert(str_hrt_timer_t_ * ptr_str_timer)
+{
+    str_hrt_timer_t_ ** ptr_ptr_str_link = &gl_ptr_str_hrt_head;
+    uint16_t_ uint16_now = 0;
+    uint16_t_ uint16_remaining;
+
+    timer_get_count(TIMER_1, &uint16_now);
+    uint16_remaining = hrt_remaining(ptr_str_timer->uint16_expiry, uint16_now);
+
+    while(
+            (NULL_PTR != *ptr_ptr_str_link) &&
+            (hrt_remaining((*ptr_ptr_str_link)->uint16_expiry, uint16_now) <= uint16_remaining)
+            )
+    {
+        ptr_ptr_str_link = &((*ptr_ptr_str_link)->ptr_str_next);
+    }
+
+    ptr_str_timer->ptr_str_next     = *ptr_ptr_str_link;
+    ptr_str_timer->uint8_channel    = HRT_CHANNEL_NONE;
+    ptr_str_timer->uint8_running    = TRUE;
+    *ptr_ptr_str_link               = ptr_str_timer;
+}
+
+/**
+ * @brief a private function to unlink a timer and release its compare channel
+ *
+ * @param ptr_str_timer : the timer to unlink (in the list)
+ *
+ * @return
+ */
+static void hrt_remove(str_hrt_timer_t_ * ptr_str_timer)
+{
+    str_hrt_timer_t_ ** ptr_ptr_str_link = &gl_ptr_str_hrt_head;
+
+    while(
+            (NULL_PTR != *ptr_ptr_str_link) &&
+            (ptr_str_timer != *ptr_ptr_str_link)
+            )
+    {
+        ptr_ptr_str_link = &((*ptr_ptr_str_link)->ptr_str_next);
+    }
+
+    if(NULL_PTR != *ptr_ptr_str_link)
+    {
+        *ptr_ptr_str_link = ptr_str_timer->ptr_str_next;
+    }
+    else
+    {
+        /* not linked */
+    }
+
+    if(HRT_CHANNEL_NONE != ptr_str_timer->uint8_channel)
+    {
+        timer_compare_disable(TIMER_1, (enu_timer_compare_channel_t)ptr_str_timer->uint8_channel);
+        gl_arr_ptr_str_hrt_armed[ptr_str_timer->uint8_channel] = NULL_PTR;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    ptr_str_timer->ptr_str_next     = NULL_PTR;
+    ptr_str_timer->uint8_channel    = HRT_CHANNEL_NONE;
+    ptr_str_timer->uint8_running    = FALSE;
+}
+
+/**
+ * @brief a private function to keep the two nearest timers armed on the
+ *		  compare channels, a channel held by a timer that is no longer
+ *		  among them is taken back
+ *
+ * @return
+ */
+static void hrt_arm(void)
+{
+    str_hrt_timer_t_ * arr_ptr_str_nearest[TIMER_COMPARE_TOTAL];
+    str_hrt_timer_t_ * ptr_str_timer;
+    uint8_t_ uint8_channel;
+    uint8_t_ uint8_index;
+    uint16_t_ uint16_now = 0;
+    uint16_t_ uint16_compare;
+
+    arr_ptr_str_nearest[0] = gl_ptr_str_hrt_head;
+    arr_ptr_str_nearest[1] = (NULL_PTR != gl_ptr_str_hrt_head) ? gl_ptr_str_hrt_head->ptr_str_next : NULL_PTR;
+
+    for (uint8_channel = 0; uint8_channel < TIMER_COMPARE_TOTAL; uint8_channel++)
+    {
+        ptr_str_timer = gl_arr_ptr_str_hrt_armed[uint8_channel];
+
+        if(
+                (NULL_PTR != ptr_str_timer)                 &&
+                (ptr_str_timer != arr_ptr_str_nearest[0])   &&
+                (ptr_str_timer != arr_ptr_str_nearest[1])
+                )
+        {
+            timer_compare_disable(TIMER_1, (enu_timer_compare_channel_t)uint8_channel);
+            ptr_str_timer->uint8_channel                = HRT_CHANNEL_NONE;
+            gl_arr_ptr_str_hrt_armed[uint8_channel]     = NULL_PTR;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    for (uint8_index = 0; uint8_index < TIMER_COMPARE_TOTAL; uint8_index++)
+    {
+        ptr_str_timer = arr_ptr_str_nearest[uint8_index];
+
+        if(
+                (NULL_PTR != ptr_str_timer) &&
+                (HRT_CHANNEL_NONE == ptr_str_timer->uint8_channel)
+                )
+        {
+            uint8_channel = (NULL_PTR == gl_arr_ptr_str_hrt_armed[TIMER_COMPARE_A]) ? TIMER_COMPARE_A : TIMER_COMPARE_B;
+
+            /* a compare the counter already passed would only match after a full wrap */
+            timer_get_count(TIMER_1, &uint16_now);
+            uint16_compare = ptr_str_timer->uint16_expiry;
+            if(hrt_remaining(uint16_compare, uint16_now) < HRT_MIN_LEAD_COUNTS)
+            {
+                uint16_compare = uint16_now + HRT_MIN_LEAD_COUNTS;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            timer_compare_set(TIMER_1, (enu_timer_compare_channel_t)uint8_channel, uint16_compare);
+            ptr_str_timer->uint8_channel                = uint8_channel;
+            gl_arr_ptr_str_hrt_armed[uint8_channel]     = ptr_str_timer;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief a private function to serve a compare match, the expired timer is
+ *		  dropped, the next nearest one takes the channel, then the callback runs
+ *
+ * @param enu_channel : the channel that matched
+ *
+ * @return
+ */
+static void hrt_compare_handler(enu_timer_compare_channel_t enu_channel)
+{
+    str_hrt_timer_t_ * ptr_str_timer = gl_arr_ptr_str_hrt_armed[enu_channel];
+    uint16_t_ uint16_now = 0;
+    uint16_t_ uint16_error_us;
+
+    if(NULL_PTR != ptr_str_timer)
+    {
+        timer_get_count(TIMER_1, &uint16_now);
+        uint16_error_us = HRT_COUNTS_TO_US((uint16_t_)(uint16_now - ptr_str_timer->uint16_expiry));
+
+        gl_str_hrt_stats.uint32_fired++;
+        gl_str_hrt_stats.uint32_total_error_us += uint16_error_us;
+        if(uint16_error_us > gl_str_hrt_stats.uint16_max_error_us)
+        {
+            gl_str_hrt_stats.uint16_max_error_us = uint16_error_us;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        hrt_remove(ptr_str_timer);
+        hrt_arm();
+        ptr_str_timer->ptr_func_callback();
+    }
+    else
+    {
+        /* spurious match of a disarmed channel */
+        timer_compare_disable(TIMER_1, enu_channel);
+    }
+}
+
+static void hrt_compare_a_isr(void)
+{
+    hrt_compare_handler(TIMER_COMPARE_A);
+}
+
+static void hrt_compare_b_isr(void)
+{
+    hrt_compare_handler(TIMER_COMPARE_B);
+}
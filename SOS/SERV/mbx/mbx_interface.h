@@ -0,0 +1,113 @@
+/**
+ * @fileName	:	mbx_interface.h
+ * @Created		: 	8:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for the zero-copy mailboxes
+ *
+ * A mailbox queues block pointers (usually memory pool blocks, mpl_interface.h),
+ * the producer fills a block and sends it, the consumer receives the same
+ * block and frees it when done, nothing is copied. The sender must not touch a
+ * block once mbx_send succeeded, the receiver owns it from then on.
+ * A receiving task that finds the mailbox empty is blocked on the mailbox
+ * semaphore and is not run again until a message is handed to it.
+ *
+ * Usage:
+ *		producer (task or ISR):
+ *			if(MPL_STATUS_SUCCESS == mpl_alloc(&gl_str_frame_pool, &ptr_frame))
+ *			{
+ *				fill(ptr_frame);
+ *				if(MBX_STATUS_SUCCESS != mbx_send(&gl_str_frame_mbx, ptr_frame))
+ *				{
+ *					mpl_free(&gl_str_frame_pool, ptr_frame);
+ *				}
+ *			}
+ *		consumer (coroutine task, static ptr_frame):
+ *			MBX_CR_RECEIVE(&gl_str_frame_mbx, &ptr_frame);
+ *			use(ptr_frame);
+ *			mpl_free(&gl_str_frame_pool, ptr_frame);
+ */
+
+
+#ifndef MBX_INTERFACE_H_
+#define MBX_INTERFACE_H_
+
+#include "std.h"
+#include "sos_interface.h"
+
+typedef enum
+{
+	MBX_STATUS_SUCCESS				= 0	,
+	MBX_STATUS_INVALID_ARGS				,
+	MBX_STATUS_FULL						,
+	MBX_STATUS_EMPTY					,
+	MBX_STATUS_WOULD_BLOCK				,
+	MBX_STATUS_TOTAL
+}enu_mbx_status_t_;
+
+typedef struct
+{
+	/** Owned by MBX */
+	void **			ptr_ptr_slots;
+	str_sos_sem_t_	str_sem_messages;		/* one unit per queued message		*/
+	uint8_t_		uint8_capacity;
+	uint8_t_		uint8_head;				/* next slot to write				*/
+	uint8_t_		uint8_tail;				/* next slot to read				*/
+	uint8_t_		uint8_count;
+	uint16_t_		uint16_rejected;		/* sends refused while full			*/
+}str_mbx_t_;
+
+/**
+ * @brief Receives a message in a coroutine task (sos_coroutine.h), the task
+ *		  is not run again until a message is available, PTR_PTR_MSG must point
+ *		  to a static variable
+ */
+#define MBX_CR_RECEIVE(PTR_MBX, PTR_PTR_MSG)											\
+	SOS_CR_WAIT_EVENT(MBX_STATUS_WOULD_BLOCK != mbx_receive((PTR_MBX), (PTR_PTR_MSG)))
+
+
+/**
+ *	@brief		                            :	Empties a mailbox
+ *  @param[out]     ptr_str_mbx             :   Caller owned mailbox
+ *  @param[in]      ptr_ptr_slots           :   Caller owned array of uint8_capacity pointers
+ *  @param[in]      uint8_capacity          :   Messages the mailbox can hold, 1 or more
+ *
+ *  @Return     MBX_STATUS_SUCCESS		    :	Success
+ *              MBX_STATUS_INVALID_ARGS     :   Failed,     Null pointer or zero capacity
+ */
+enu_mbx_status_t_ mbx_init(str_mbx_t_ * ptr_str_mbx, void ** ptr_ptr_slots, uint8_t_ uint8_capacity);
+
+/**
+ *	@brief		                            :	Queues a message, ownership of the block moves to the receiver,
+ *	                                            task or ISR context
+ *  @param[in,out]  ptr_str_mbx             :   Mailbox
+ *  @param[in]      ptr_msg                 :   Message block
+ *
+ *  @Return     MBX_STATUS_SUCCESS		    :	Success
+ *              MBX_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              MBX_STATUS_FULL             :   Failed,     Mailbox full, the caller keeps the block
+ */
+enu_mbx_status_t_ mbx_send(str_mbx_t_ * ptr_str_mbx, void * ptr_msg);
+
+/**
+ *	@brief		                            :	Takes the oldest message, the caller owns the block afterwards
+ *  @param[in,out]  ptr_str_mbx             :   Mailbox
+ *  @param[out]     ptr_ptr_msg             :   Pointer to store the message block
+ *
+ *  @Return     MBX_STATUS_SUCCESS		    :	Success
+ *              MBX_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              MBX_STATUS_WOULD_BLOCK      :   Failed,     Task registered as a receiver, return from the task
+ *              MBX_STATUS_EMPTY            :   Failed,     No message and not called from a task
+ */
+enu_mbx_status_t_ mbx_receive(str_mbx_t_ * ptr_str_mbx, void ** ptr_ptr_msg);
+
+/**
+ *	@brief		                            :	Gets the number of queued messages
+ *  @param[in]      ptr_str_mbx             :   Mailbox
+ *  @param[out]     ptr_uint8_count         :   Pointer to store the number of messages
+ *
+ *  @Return     MBX_STATUS_SUCCESS		    :	Success
+ *              MBX_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_mbx_status_t_ mbx_get_count(str_mbx_t_ * ptr_str_mbx, uint8_t_ * ptr_uint8_count);
+
+#endif /* MBX_INTERFACE_H_ */
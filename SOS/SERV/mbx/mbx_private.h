@@ -0,0 +1,17 @@
+/**
+ * @fileName	:	mbx_private.h
+ * @Created		: 	8:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Private file for the zero-copy mailboxes
+ */
+
+
+#ifndef MBX_PRIVATE_H_
+#define MBX_PRIVATE_H_
+
+#include "mbx_interface.h"
+#include "critical.h"
+
+#define MBX_NEXT_SLOT(PTR_MBX, INDEX)	((uint8_t_)(((INDEX) + 1 == (PTR_MBX)->uint8_capacity) ? 0 : ((INDEX) + 1)))
+
+#endif /* MBX_PRIVATE_H_ */
@@ -0,0 +1,161 @@
+/**
+ * @fileName	:	mbx_program.c
+ * @Created		: 	8:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Program file for the zero-copy mailboxes
+ */
+#include "mbx_private.h"
+
+/**
+ *	@brief		                            :	Empties a mailbox
+ *  @param[out]     ptr_str_mbx             :   Caller owned mailbox
+ *  @param[in]      ptr_ptr_slots           :   Caller owned array of uint8_capacity pointers
+ *  @param[in]      uint8_capacity          :   Messages the mailbox can hold, 1 or more
+ *
+ *  @Return     MBX_STATUS_SUCCESS		    :	Success
+ *              MBX_STATUS_INVALID_ARGS     :   Failed,     Null pointer or zero capacity
+ */
+enu_mbx_status_t_ mbx_init(str_mbx_t_ * ptr_str_mbx, void ** ptr_ptr_slots, uint8_t_ uint8_capacity)
+{
+    enu_mbx_status_t_ enu_mbx_status_retval = MBX_STATUS_SUCCESS;
+
+    if(
+            (NULL_PTR == ptr_str_mbx)   ||
+            (NULL_PTR == ptr_ptr_slots) ||
+            (0 == uint8_capacity)
+            )
+    {
+        enu_mbx_status_retval = MBX_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        ptr_str_mbx->ptr_ptr_slots      = ptr_ptr_slots;
+        ptr_str_mbx->uint8_capacity     = uint8_capacity;
+        ptr_str_mbx->uint8_head         = 0;
+        ptr_str_mbx->uint8_tail         = 0;
+        ptr_str_mbx->uint8_count        = 0;
+        ptr_str_mbx->uint16_rejected    = 0;
+        (void)sos_sem_init(&ptr_str_mbx->str_sem_messages, 0, uint8_capacity);
+    }
+
+    return enu_mbx_status_retval;
+}
+
+/**
+ *	@brief		                            :	Queues a message, ownership of the block moves to the receiver,
+ *	                                            task or ISR context
+ *  @param[in,out]  ptr_str_mbx             :   Mailbox
+ *  @param[in]      ptr_msg                 :   Message block
+ *
+ *  @Return     MBX_STATUS_SUCCESS		    :	Success
+ *              MBX_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              MBX_STATUS_FULL             :   Failed,     Mailbox full, the caller keeps the block
+ */
+enu_mbx_status_t_ mbx_send(str_mbx_t_ * ptr_str_mbx, void * ptr_msg)
+{
+    enu_mbx_status_t_ enu_mbx_status_retval = MBX_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_mbx) ||
+            (NULL_PTR == ptr_msg)
+            )
+    {
+        enu_mbx_status_retval = MBX_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_MBX);
+        if(ptr_str_mbx->uint8_count == ptr_str_mbx->uint8_capacity)
+        {
+            ptr_str_mbx->uint16_rejected++;
+            enu_mbx_status_retval = MBX_STATUS_FULL;
+        }
+        else
+        {
+            ptr_str_mbx->ptr_ptr_slots[ptr_str_mbx->uint8_head] = ptr_msg;
+            ptr_str_mbx->uint8_head = MBX_NEXT_SLOT(ptr_str_mbx, ptr_str_mbx->uint8_head);
+            ptr_str_mbx->uint8_count++;
+
+            /* the message is queued before its unit is given, a unit always finds one */
+            (void)sos_sem_give(&ptr_str_mbx->str_sem_messages);
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_mbx_status_retval;
+}
+
+/**
+ *	@brief		                            :	Takes the oldest message, the caller owns the block afterwards
+ *  @param[in,out]  ptr_str_mbx             :   Mailbox
+ *  @param[out]     ptr_ptr_msg             :   Pointer to store the message block
+ *
+ *  @Return     MBX_STATUS_SUCCESS		    :	Success
+ *              MBX_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              MBX_STATUS_WOULD_BLOCK      :   Failed,     Task registered as a receiver, return from the task
+ *              MBX_STATUS_EMPTY            :   Failed,     No message and not called from a task
+ */
+enu_mbx_status_t_ mbx_receive(str_mbx_t_ * ptr_str_mbx, void ** ptr_ptr_msg)
+{
+    enu_mbx_status_t_ enu_mbx_status_retval = MBX_STATUS_SUCCESS;
+    enu_sos_status_t_ enu_sos_status;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_mbx) ||
+            (NULL_PTR == ptr_ptr_msg)
+            )
+    {
+        enu_mbx_status_retval = MBX_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enu_sos_status = sos_sem_take(&ptr_str_mbx->str_sem_messages);
+        if(SOS_STATUS_SUCCESS == enu_sos_status)
+        {
+            enter_critical(&lo_str_critical, CRITICAL_SITE_MBX);
+            *ptr_ptr_msg = ptr_str_mbx->ptr_ptr_slots[ptr_str_mbx->uint8_tail];
+            ptr_str_mbx->uint8_tail = MBX_NEXT_SLOT(ptr_str_mbx, ptr_str_mbx->uint8_tail);
+            ptr_str_mbx->uint8_count--;
+            exit_critical(&lo_str_critical);
+        }
+        else if(SOS_STATUS_WOULD_BLOCK == enu_sos_status)
+        {
+            enu_mbx_status_retval = MBX_STATUS_WOULD_BLOCK;
+        }
+        else
+        {
+            enu_mbx_status_retval = MBX_STATUS_EMPTY;
+        }
+    }
+
+    return enu_mbx_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the number of queued messages
+ *  @param[in]      ptr_str_mbx             :   Mailbox
+ *  @param[out]     ptr_uint8_count         :   Pointer to store the number of messages
+ *
+ *  @Return     MBX_STATUS_SUCCESS		    :	Success
+ *              MBX_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_mbx_status_t_ mbx_get_count(str_mbx_t_ * ptr_str_mbx, uint8_t_ * ptr_uint8_count)
+{
+    enu_mbx_status_t_ enu_mbx_status_retval = MBX_STATUS_SUCCESS;
+
+    if(
+            (NULL_PTR == ptr_str_mbx) ||
+            (NULL_PTR == ptr_uint8_count)
+            )
+    {
+        enu_mbx_status_retval = MBX_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        *ptr_uint8_count = ptr_str_mbx->uint8_count;
+    }
+
+    return enu_mbx_status_retval;
+}
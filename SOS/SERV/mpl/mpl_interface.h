@@ -0,0 +1,111 @@
+/**
+ * @fileName	:	mpl_interface.h
+ * @Created		: 	8:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for the fixed-block memory pools
+ *
+ * A pool splits a caller owned array into equal blocks, free blocks are linked
+ * through their own first byte (index of the next free block) so alloc and
+ * free are a single list push/pop, O(1) and without fragmentation. A bit per
+ * block tells whether it is free, a block freed twice is refused. Both run in
+ * a short critical section and may be called from task or ISR context.
+ *
+ * Usage:
+ *		static void * gl_arr_frame_storage[MPL_STORAGE_WORDS(sizeof(str_frame_t_), 8)];
+ *		static str_mpl_pool_t_ gl_str_frame_pool;
+ *
+ *		mpl_init(&gl_str_frame_pool, gl_arr_frame_storage, sizeof(str_frame_t_), 8);
+ */
+
+
+#ifndef MPL_INTERFACE_H_
+#define MPL_INTERFACE_H_
+
+#include "std.h"
+#include "mpl_preconfig.h"
+
+/* block size rounded up to the pointer size, every block stays pointer aligned */
+#define MPL_BLOCK_SIZE(SIZE)					((((SIZE) + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *))
+
+/* pool storage in words, declare it as an array of void * for the link alignment */
+#define MPL_STORAGE_WORDS(SIZE, COUNT)			((MPL_BLOCK_SIZE(SIZE) / sizeof(void *)) * (COUNT))
+
+/* free block map, one bit per block */
+#define MPL_FREE_MAP_BYTES						((MPL_MAX_BLOCK_COUNT + 7) / 8)
+
+typedef enum
+{
+	MPL_STATUS_SUCCESS				= 0	,
+	MPL_STATUS_INVALID_ARGS				,
+	MPL_STATUS_EMPTY					,
+	MPL_STATUS_DOUBLE_FREE				,
+	MPL_STATUS_TOTAL
+}enu_mpl_status_t_;
+
+typedef struct
+{
+	/** Owned by MPL */
+	uint8_t_ *	ptr_uint8_storage;
+	uint16_t_	uint16_block_size;
+	uint8_t_	uint8_block_count;
+	uint8_t_	uint8_free_count;
+	uint8_t_	uint8_min_free;				/* low water mark since mpl_init	*/
+	uint16_t_	uint16_alloc_failed;
+	uint8_t_	uint8_free_head;				/* index of the first free block	*/
+	uint8_t_	arr_uint8_free_map[MPL_FREE_MAP_BYTES];	/* bit set while the block is free	*/
+}str_mpl_pool_t_;
+
+typedef struct
+{
+	uint8_t_	uint8_block_count;
+	uint8_t_	uint8_free_count;
+	uint8_t_	uint8_min_free;
+	uint16_t_	uint16_alloc_failed;
+}str_mpl_stats_t_;
+
+
+/**
+ *	@brief		                            :	Splits the storage into blocks and frees all of them
+ *  @param[out]     ptr_str_pool            :   Caller owned pool
+ *  @param[in]      ptr_storage             :   MPL_STORAGE_WORDS(uint16_block_size, uint8_block_count) words
+ *  @param[in]      uint16_block_size       :   Usable bytes per block (rounded up by MPL_BLOCK_SIZE)
+ *  @param[in]      uint8_block_count       :   Number of blocks, 1 to MPL_MAX_BLOCK_COUNT
+ *
+ *  @Return     MPL_STATUS_SUCCESS		    :	Success
+ *              MPL_STATUS_INVALID_ARGS     :   Failed,     Null pointer, zero size or count out of range
+ */
+enu_mpl_status_t_ mpl_init(str_mpl_pool_t_ * ptr_str_pool, void * ptr_storage, uint16_t_ uint16_block_size, uint8_t_ uint8_block_count);
+
+/**
+ *	@brief		                            :	Takes a block, O(1), task or ISR context
+ *  @param[in,out]  ptr_str_pool            :   Pool
+ *  @param[out]     ptr_ptr_block           :   Pointer to store the block address (NULL_PTR when empty)
+ *
+ *  @Return     MPL_STATUS_SUCCESS		    :	Success
+ *              MPL_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              MPL_STATUS_EMPTY            :   Failed,     No free block, counted in uint16_alloc_failed
+ */
+enu_mpl_status_t_ mpl_alloc(str_mpl_pool_t_ * ptr_str_pool, void ** ptr_ptr_block);
+
+/**
+ *	@brief		                            :	Gives a block back to its pool, O(1), task or ISR context
+ *  @param[in,out]  ptr_str_pool            :   Pool the block was taken from
+ *  @param[in]      ptr_block               :   Block address returned by mpl_alloc
+ *
+ *  @Return     MPL_STATUS_SUCCESS		    :	Success
+ *              MPL_STATUS_INVALID_ARGS     :   Failed,     Null pointer or not a block of this pool
+ *              MPL_STATUS_DOUBLE_FREE      :   Failed,     Block already free, the pool is unchanged
+ */
+enu_mpl_status_t_ mpl_free(str_mpl_pool_t_ * ptr_str_pool, void * ptr_block);
+
+/**
+ *	@brief		                            :	Gets the pool usage
+ *  @param[in]      ptr_str_pool            :   Pool
+ *  @param[out]     ptr_str_stats           :   Pointer to store the usage
+ *
+ *  @Return     MPL_STATUS_SUCCESS		    :	Success
+ *              MPL_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_mpl_status_t_ mpl_get_stats(str_mpl_pool_t_ * ptr_str_pool, str_mpl_stats_t_ * ptr_str_stats);
+
+#endif /* MPL_INTERFACE_H_ */
@@ -0,0 +1,15 @@
+/**
+ * @fileName	:	mpl_preconfig.h
+ * @Created		: 	8:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Pre-compiled configurations file for the fixed-block memory pools
+ */
+
+
+#ifndef MPL_PRECONFIG_H_
+#define MPL_PRECONFIG_H_
+
+/* largest block count of a pool, every pool keeps one state bit per block (double free check) */
+#define MPL_MAX_BLOCK_COUNT				32
+
+#endif /* MPL_PRECONFIG_H_ */
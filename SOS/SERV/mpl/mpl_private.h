@@ -0,0 +1,27 @@
+/**
+ * @fileName	:	mpl_private.h
+ * @Created		: 	8:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Private file for the fixed-block memory pools
+ */
+
+
+#ifndef MPL_PRIVATE_H_
+#define MPL_PRIVATE_H_
+
+#include "mpl_interface.h"
+#include "mpl_preconfig.h"
+#include "critical.h"
+
+#if (MPL_MAX_BLOCK_COUNT > 255) || (MPL_MAX_BLOCK_COUNT < 1)
+#error "MPL_MAX_BLOCK_COUNT must be between 1 and 255"
+#endif
+
+/* free list end, block indexes go up to 254 */
+#define MPL_FREE_NONE					0xFF
+
+/* free map cell and bit of a block index */
+#define MPL_FREE_MAP_BYTE(INDEX)		((INDEX) >> 3)
+#define MPL_FREE_MAP_BIT(INDEX)			((uint8_t_)(1 << ((INDEX) & 7)))
+
+#endif /* MPL_PRIVATE_H_ */
@@ -0,0 +1,215 @@
+/**
+ * @fileName	:	mpl_program.c
+ * @Created		: 	8:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Program file for the fixed-block memory pools
+ */
+#include "mpl_private.h"
+
+/**
+ *	@brief		                            :	Splits the storage into blocks and frees all of them
+ *  @param[out]     ptr_str_pool            :   Caller owned pool
+ *  @param[in]      ptr_storage             :   MPL_STORAGE_WORDS(uint16_block_size, uint8_block_count) words
+ *  @param[in]      uint16_block_size       :   Usable bytes per block (rounded up by MPL_BLOCK_SIZE)
+ *  @param[in]      uint8_block_count       :   Number of blocks, 1 to MPL_MAX_BLOCK_COUNT
+ *
+ *  @Return     MPL_STATUS_SUCCESS		    :	Success
+ *              MPL_STATUS_INVALID_ARGS     :   Failed,     Null pointer, zero size or count out of range
+ */
+enu_mpl_status_t_ mpl_init(str_mpl_pool_t_ * ptr_str_pool, void * ptr_storage, uint16_t_ uint16_block_size, uint8_t_ uint8_block_count)
+{
+    enu_mpl_status_t_ enu_mpl_status_retval = MPL_STATUS_SUCCESS;
+    uint8_t_ * ptr_uint8_block;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_pool)  ||
+            (NULL_PTR == ptr_storage)   ||
+            (0 == uint16_block_size)    ||
+            (0 == uint8_block_count)    ||
+            (MPL_MAX_BLOCK_COUNT < uint8_block_count)
+            )
+    {
+        enu_mpl_status_retval = MPL_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        uint16_block_size = MPL_BLOCK_SIZE(uint16_block_size);
+
+        enter_critical(&lo_str_critical, CRITICAL_SITE_MPL);
+        ptr_str_pool->ptr_uint8_storage     = (uint8_t_ *)ptr_storage;
+        ptr_str_pool->uint16_block_size     = uint16_block_size;
+        ptr_str_pool->uint8_block_count     = uint8_block_count;
+        ptr_str_pool->uint8_free_count      = uint8_block_count;
+        ptr_str_pool->uint8_min_free        = uint8_block_count;
+        ptr_str_pool->uint16_alloc_failed   = 0;
+
+        /* link every block to the next one, the last one ends the list */
+        ptr_uint8_block = ptr_str_pool->ptr_uint8_storage;
+        for (uint8_t_ uint8_block = 1; uint8_block < uint8_block_count; ++uint8_block)
+        {
+            *ptr_uint8_block = uint8_block;
+            ptr_uint8_block += uint16_block_size;
+        }
+        *ptr_uint8_block = MPL_FREE_NONE;
+        ptr_str_pool->uint8_free_head = 0;
+        for (uint8_t_ uint8_byte = 0; uint8_byte < MPL_FREE_MAP_BYTES; ++uint8_byte)
+        {
+            ptr_str_pool->arr_uint8_free_map[uint8_byte] = 0;
+        }
+        for (uint8_t_ uint8_block = 0; uint8_block < uint8_block_count; ++uint8_block)
+        {
+            ptr_str_pool->arr_uint8_free_map[MPL_FREE_MAP_BYTE(uint8_block)] |= MPL_FREE_MAP_BIT(uint8_block);
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_mpl_status_retval;
+}
+
+/**
+ *	@brief		                            :	Takes a block, O(1), task or ISR context
+ *  @param[in,out]  ptr_str_pool            :   Pool
+ *  @param[out]     ptr_ptr_block           :   Pointer to store the block address (NULL_PTR when empty)
+ *
+ *  @Return     MPL_STATUS_SUCCESS		    :	Success
+ *              MPL_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              MPL_STATUS_EMPTY            :   Failed,     No free block, counted in uint16_alloc_failed
+ */
+enu_mpl_status_t_ mpl_alloc(str_mpl_pool_t_ * ptr_str_pool, void ** ptr_ptr_block)
+{
+    enu_mpl_status_t_ enu_mpl_status_retval = MPL_STATUS_SUCCESS;
+    void * ptr_block = NULL_PTR;
+    uint8_t_ uint8_index;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_pool) ||
+            (NULL_PTR == ptr_ptr_block)
+            )
+    {
+        enu_mpl_status_retval = MPL_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_MPL);
+        uint8_index = ptr_str_pool->uint8_free_head;
+        if(MPL_FREE_NONE != uint8_index)
+        {
+            ptr_block = ptr_str_pool->ptr_uint8_storage + ((uint16_t_)uint8_index * ptr_str_pool->uint16_block_size);
+            ptr_str_pool->uint8_free_head = *(uint8_t_ *)ptr_block;
+            ptr_str_pool->uint8_free_count--;
+            ptr_str_pool->arr_uint8_free_map[MPL_FREE_MAP_BYTE(uint8_index)] &= (uint8_t_)~MPL_FREE_MAP_BIT(uint8_index);
+            if(ptr_str_pool->uint8_free_count < ptr_str_pool->uint8_min_free)
+            {
+                ptr_str_pool->uint8_min_free = ptr_str_pool->uint8_free_count;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            ptr_str_pool->uint16_alloc_failed++;
+            enu_mpl_status_retval = MPL_STATUS_EMPTY;
+        }
+        exit_critical(&lo_str_critical);
+
+        *ptr_ptr_block = ptr_block;
+    }
+
+    return enu_mpl_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gives a block back to its pool, O(1), task or ISR context
+ *  @param[in,out]  ptr_str_pool            :   Pool the block was taken from
+ *  @param[in]      ptr_block               :   Block address returned by mpl_alloc
+ *
+ *  @Return     MPL_STATUS_SUCCESS		    :	Success
+ *              MPL_STATUS_INVALID_ARGS     :   Failed,     Null pointer or not a block of this pool
+ *              MPL_STATUS_DOUBLE_FREE      :   Failed,     Block already free, the pool is unchanged
+ */
+enu_mpl_status_t_ mpl_free(str_mpl_pool_t_ * ptr_str_pool, void * ptr_block)
+{
+    enu_mpl_status_t_ enu_mpl_status_retval = MPL_STATUS_SUCCESS;
+    uint16_t_ uint16_offset;
+    uint8_t_ uint8_index;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_pool)                              ||
+            (NULL_PTR == ptr_block)                                 ||
+            ((uint8_t_ *)ptr_block < ptr_str_pool->ptr_uint8_storage)
+            )
+    {
+        enu_mpl_status_retval = MPL_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        /* block start inside the storage, the division is the only non constant cost */
+        uint16_offset = (uint16_t_)((uint8_t_ *)ptr_block - ptr_str_pool->ptr_uint8_storage);
+        if(
+                ((uint16_offset / ptr_str_pool->uint16_block_size) >= ptr_str_pool->uint8_block_count) ||
+                (0 != (uint16_offset % ptr_str_pool->uint16_block_size))
+                )
+        {
+            enu_mpl_status_retval = MPL_STATUS_INVALID_ARGS;
+        }
+        else
+        {
+            uint8_index = (uint8_t_)(uint16_offset / ptr_str_pool->uint16_block_size);
+
+            enter_critical(&lo_str_critical, CRITICAL_SITE_MPL);
+            if(0 == (ptr_str_pool->arr_uint8_free_map[MPL_FREE_MAP_BYTE(uint8_index)] & MPL_FREE_MAP_BIT(uint8_index)))
+            {
+                *(uint8_t_ *)ptr_block          = ptr_str_pool->uint8_free_head;
+                ptr_str_pool->uint8_free_head   = uint8_index;
+                ptr_str_pool->uint8_free_count++;
+                ptr_str_pool->arr_uint8_free_map[MPL_FREE_MAP_BYTE(uint8_index)] |= MPL_FREE_MAP_BIT(uint8_index);
+            }
+            else
+            {
+                /* already in the free list, linking it again would hand it out twice */
+                enu_mpl_status_retval = MPL_STATUS_DOUBLE_FREE;
+            }
+            exit_critical(&lo_str_critical);
+        }
+    }
+
+    return enu_mpl_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the pool usage
+ *  @param[in]      ptr_str_pool            :   Pool
+ *  @param[out]     ptr_str_stats           :   Pointer to store the usage
+ *
+ *  @Return     MPL_STATUS_SUCCESS		    :	Success
+ *              MPL_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_mpl_status_t_ mpl_get_stats(str_mpl_pool_t_ * ptr_str_pool, str_mpl_stats_t_ * ptr_str_stats)
+{
+    enu_mpl_status_t_ enu_mpl_status_retval = MPL_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_pool) ||
+            (NULL_PTR == ptr_str_stats)
+            )
+    {
+        enu_mpl_status_retval = MPL_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_MPL);
+        ptr_str_stats->uint8_block_count    = ptr_str_pool->uint8_block_count;
+        ptr_str_stats->uint8_free_count     = ptr_str_pool->uint8_free_count;
+        ptr_str_stats->uint8_min_free       = ptr_str_pool->uint8_min_free;
+        ptr_str_stats->uint16_alloc_failed  = ptr_str_pool->uint16_alloc_failed;
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_mpl_status_retval;
+}
@@ -0,0 +1,154 @@
+/**
+ * @fileName	:	scm_interface.h
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for the schedule conformance monitor
+ *
+ * The monitor keeps its own release model of the periodic tasks of the active
+ * mode, built only from the priority, period and first release of every task
+ * and the delays returned by the jobs, and checks every run dispatched by the
+ * Simple Operating System against it:
+ * 		missing			a released job dropped because SOS served a later release
+ * 						of its task instead, or shed by an overload action
+ * 		extra			a run without a release, a sync object wake or a chain
+ * 		out of order	a run while a released job of a higher priority task waited
+ * It is fed by SOS hooks (SOS_CONFORMANCE_MONITOR in sos_preconfig.h), a tick
+ * costs one compare unless a task is released, a run one pass over the task
+ * IDs, so it can stay on in test firmware.
+ * A task waiting on a sync object has no missing releases, chain successors
+ * run behind their predecessors and are only counted.
+ */
+
+
+#ifndef SCM_INTERFACE_H_
+#define SCM_INTERFACE_H_
+
+#include "std.h"
+
+typedef enum
+{
+	SCM_STATUS_SUCCESS				= 0	,
+	SCM_STATUS_INVALID_ARGS				,
+	SCM_STATUS_TOTAL
+}enu_scm_status_t_;
+
+typedef enum
+{
+	SCM_FAULT_NONE					= 0	,
+	SCM_FAULT_MISSING					,
+	SCM_FAULT_EXTRA						,
+	SCM_FAULT_OUT_OF_ORDER				,
+	SCM_FAULT_TOTAL
+}enu_scm_fault_t_;
+
+/* called on every fault, from the tick ISR or the scheduler, keep it short */
+typedef void(*ptr_func_scm_fault_t_)(enu_scm_fault_t_ enu_fault, uint8_t_ uint8_task_id, uint32_t_ uint32_tick);
+
+typedef struct
+{
+	uint32_t_			uint32_releases;			/* periodic releases of the model			*/
+	uint32_t_			uint32_runs;				/* jobs started by SOS						*/
+	uint32_t_			uint32_missing;
+	uint32_t_			uint32_extra;
+	uint32_t_			uint32_out_of_order;
+	enu_scm_fault_t_	enu_last_fault;				/* SCM_FAULT_NONE while conforming			*/
+	uint8_t_			uint8_last_fault_task_id;
+	uint32_t_			uint32_last_fault_tick;
+}str_scm_stats_t_;
+
+/* period given to scm_track for a task released by its chain predecessors only */
+#define SCM_EVENT_TASK					0
+
+
+/**
+ *	@brief		                            :	Drops the model and clears the statistics, called by sos_init
+ */
+void scm_init(void);
+
+/**
+ *	@brief		                            :	Adds a task of the active mode to the model or updates it, a job
+ *	                                            released already stays pending, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[in]      uint8_priority          :   Task priority, 0 is the highest
+ *  @param[in]      uint16_period           :   Ticks between releases, SCM_EVENT_TASK for a chain successor
+ *  @param[in]      uint32_first_release    :   Tick of the next release
+ */
+void scm_track(uint8_t_ uint8_task_id, uint8_t_ uint8_priority, uint16_t_ uint16_period, uint32_t_ uint32_first_release);
+
+/**
+ *	@brief		                            :	Removes a task from the model, its runs are extra from now on,
+ *	                                            called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ */
+void scm_forget(uint8_t_ uint8_task_id);
+
+/**
+ *	@brief		                            :	Removes every task from the model (mode switch), called by SOS
+ */
+void scm_forget_all(void);
+
+/**
+ *	@brief		                            :	Releases the jobs of the model due at a tick, O(1) when no task is
+ *	                                            released, called from the tick ISR
+ *  @param[in]      uint32_tick             :   System tick just counted
+ */
+void scm_tick(uint32_t_ uint32_tick);
+
+/**
+ *	@brief		                            :	Checks a job about to start against the model, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[in]      uint32_tick             :   Tick the scheduler serves (scheduler pass or tick ISR)
+ */
+void scm_dispatch(uint8_t_ uint8_task_id, uint32_t_ uint32_tick);
+
+/**
+ *	@brief		                            :	Drops a released job shed by an overload action, it counts as
+ *	                                            missing, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[in]      uint32_tick             :   Tick the scheduler serves
+ */
+void scm_skip(uint8_t_ uint8_task_id, uint32_t_ uint32_tick);
+
+/**
+ *	@brief		                            :	Applies the delay returned by a job to the model, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[in]      uint32_tick             :   Tick a delay returned by a woken run counts from
+ *  @param[in]      uint16_delay            :   Value returned by the task, 0 (SOS_TASK_DEFAULT_PERIOD) keeps the period
+ */
+void scm_complete(uint8_t_ uint8_task_id, uint32_t_ uint32_tick, uint16_t_ uint16_delay);
+
+/**
+ *	@brief		                            :	Marks the running task as waiting on a sync object, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ */
+void scm_block(uint8_t_ uint8_task_id);
+
+/**
+ *	@brief		                            :	Marks a waiter as released by a sync object, it may run once
+ *	                                            without a periodic release, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ */
+void scm_wake(uint8_t_ uint8_task_id);
+
+/**
+ *	@brief		                            :	Gets the conformance statistics since scm_init or scm_clear_stats
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ *
+ *  @Return     SCM_STATUS_SUCCESS		    :	Success
+ *              SCM_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_scm_status_t_ scm_get_stats(str_scm_stats_t_ * ptr_str_stats);
+
+/**
+ *	@brief		                            :	Clears the statistics, the model is kept
+ */
+void scm_clear_stats(void);
+
+/**
+ *	@brief		                            :	Sets the function called on every fault (e.g. to stop a soak run
+ *	                                            at the first one), NULL_PTR for none
+ *  @param[in]      ptr_func_fault          :   Fault callback
+ */
+void scm_set_fault_callback(ptr_func_scm_fault_t_ ptr_func_fault);
+
+#endif /* SCM_INTERFACE_H_ */
@@ -0,0 +1,60 @@
+/**
+ * @fileName	:	scm_private.h
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Private file for the schedule conformance monitor
+ */
+
+
+#ifndef SCM_PRIVATE_H_
+#define SCM_PRIVATE_H_
+
+#include "scm_interface.h"
+#include "sos_preconfig.h"
+#include "critical.h"
+
+/* Model state of a task ID */
+#define SCM_TASK_NONE					0		/* not in the active mode						*/
+#define SCM_TASK_PERIODIC				1		/* released by its period						*/
+#define SCM_TASK_EVENT					2		/* released by its chain predecessors			*/
+
+/* released jobs counted per task, the next releases of a task that never runs are missing */
+#define SCM_MAX_PENDING					0xFF
+
+/* TRUE once the free running tick NOW reached TICK, wraparound safe */
+#define SCM_TICK_REACHED(NOW, TICK)		((sint32_t_)((NOW) - (TICK)) >= 0)
+
+/*
+ * The preemptive kernel calls every hook with interrupts disabled. The
+ * cooperative one runs the jobs from sos_run, a dispatch or a completion must
+ * not interleave with the releases of the tick ISR
+ */
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+#define SCM_LOCK(PTR_CRITICAL)			((void)(PTR_CRITICAL))
+#define SCM_UNLOCK(PTR_CRITICAL)		((void)(PTR_CRITICAL))
+#else
+#define SCM_LOCK(PTR_CRITICAL)			enter_critical((PTR_CRITICAL), CRITICAL_SITE_SCM)
+#define SCM_UNLOCK(PTR_CRITICAL)		exit_critical(PTR_CRITICAL)
+#endif
+
+/* Model of a task, indexed by task ID */
+typedef struct
+{
+	uint8_t_	uint8_state;					/* SCM_TASK_NONE/PERIODIC/EVENT					*/
+	uint8_t_	uint8_priority;
+	uint16_t_	uint16_period;
+	uint32_t_	uint32_next_release;
+	uint32_t_	uint32_pending_release;			/* oldest released job not started yet			*/
+	uint32_t_	uint32_run_release;				/* release of the last run, base of a delay		*/
+	uint8_t_	uint8_pending;					/* released jobs not started yet, one period apart	*/
+	uint8_t_	bool_run_released;				/* last run consumed a release					*/
+	uint8_t_	bool_woken;						/* may run once without a release				*/
+	uint8_t_	bool_blocked;					/* waiting on a sync object						*/
+}str_scm_task_t_;
+
+static void scm_fault			(enu_scm_fault_t_ enu_fault, uint8_t_ uint8_task_id, uint32_t_ uint32_tick);
+static void scm_release			(str_scm_task_t_ * ptr_str_task, uint8_t_ uint8_task_id, uint32_t_ uint32_tick);
+static void scm_consume			(str_scm_task_t_ * ptr_str_task, uint8_t_ uint8_task_id, uint32_t_ uint32_tick);
+static void scm_update_next_due	(uint32_t_ uint32_release);
+
+#endif /* SCM_PRIVATE_H_ */
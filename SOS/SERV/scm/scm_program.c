@@ -0,0 +1,536 @@
+/**
+ * @fileName	:	scm_program.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Program file for the schedule conformance monitor
+ */
+#include "scm_private.h"
+
+static INSTANCE str_scm_task_t_			gl_arr_str_scm_tasks[SOS_NUMBER_OF_TASK_IDS];
+static INSTANCE str_scm_stats_t_		gl_str_scm_stats;
+static INSTANCE ptr_func_scm_fault_t_	gl_ptr_func_scm_fault = NULL_PTR;
+static INSTANCE uint32_t_				gl_uint32_scm_tick = 0;				/* last tick seen by scm_tick				*/
+static INSTANCE uint32_t_				gl_uint32_scm_next_due = 0;			/* earliest release of the model			*/
+static INSTANCE uint8_t_				gl_uint8_scm_next_due_valid = FALSE;
+
+/**
+ *	@brief		                            :	Drops the model and clears the statistics, called by sos_init
+ */
+void scm_init(void)
+{
+    scm_forget_all();
+    scm_clear_stats();
+}
+
+/**
+ *	@brief		                            :	Adds a task of the active mode to the model or updates it, a job
+ *	                                            released already stays pending, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[in]      uint8_priority          :   Task priority, 0 is the highest
+ *  @param[in]      uint16_period           :   Ticks between releases, SCM_EVENT_TASK for a chain successor
+ *  @param[in]      uint32_first_release    :   Tick of the next release
+ */
+void scm_track(uint8_t_ uint8_task_id, uint8_t_ uint8_priority, uint16_t_ uint16_period, uint32_t_ uint32_first_release)
+{
+    str_scm_task_t_ * ptr_str_task;
+
+    if(SOS_NUMBER_OF_TASK_IDS > uint8_task_id)
+    {
+        ptr_str_task = &gl_arr_str_scm_tasks[uint8_task_id];
+        ptr_str_task->uint8_priority = uint8_priority;
+
+        if(SCM_EVENT_TASK == uint16_period)
+        {
+            ptr_str_task->uint8_state   = SCM_TASK_EVENT;
+            ptr_str_task->uint8_pending = 0;
+        }
+        else
+        {
+            /* a release the task has not reached yet is a new phase, a past one was released by the model already */
+            if(
+                    (SCM_TASK_PERIODIC != ptr_str_task->uint8_state) ||
+                    (FALSE == SCM_TICK_REACHED(gl_uint32_scm_tick, uint32_first_release))
+                    )
+            {
+                ptr_str_task->uint32_next_release = uint32_first_release;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+            ptr_str_task->uint8_state   = SCM_TASK_PERIODIC;
+            ptr_str_task->uint16_period = uint16_period;
+            scm_update_next_due(ptr_str_task->uint32_next_release);
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ *	@brief		                            :	Removes a task from the model, its runs are extra from now on,
+ *	                                            called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ */
+void scm_forget(uint8_t_ uint8_task_id)
+{
+    str_scm_task_t_ * ptr_str_task;
+
+    if(SOS_NUMBER_OF_TASK_IDS > uint8_task_id)
+    {
+        ptr_str_task = &gl_arr_str_scm_tasks[uint8_task_id];
+        ptr_str_task->uint8_state       = SCM_TASK_NONE;
+        ptr_str_task->uint8_pending     = 0;
+        ptr_str_task->bool_run_released = FALSE;
+        ptr_str_task->bool_woken        = FALSE;
+        ptr_str_task->bool_blocked      = FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ *	@brief		                            :	Removes every task from the model (mode switch), called by SOS
+ */
+void scm_forget_all(void)
+{
+    for(uint8_t_ uint8_task_id = 0; uint8_task_id < SOS_NUMBER_OF_TASK_IDS; ++uint8_task_id)
+    {
+        scm_forget(uint8_task_id);
+    }
+    gl_uint8_scm_next_due_valid = FALSE;
+}
+
+/**
+ *	@brief		                            :	Releases the jobs of the model due at a tick, O(1) when no task is
+ *	                                            released, called from the tick ISR
+ *  @param[in]      uint32_tick             :   System tick just counted
+ */
+void scm_tick(uint32_t_ uint32_tick)
+{
+    str_scm_task_t_ * ptr_str_task;
+
+    gl_uint32_scm_tick = uint32_tick;
+
+    if(
+            (TRUE == gl_uint8_scm_next_due_valid) &&
+            (SCM_TICK_REACHED(uint32_tick, gl_uint32_scm_next_due))
+            )
+    {
+        gl_uint8_scm_next_due_valid = FALSE;
+
+        for(uint8_t_ uint8_task_id = 0; uint8_task_id < SOS_NUMBER_OF_TASK_IDS; ++uint8_task_id)
+        {
+            ptr_str_task = &gl_arr_str_scm_tasks[uint8_task_id];
+
+            if(SCM_TASK_PERIODIC == ptr_str_task->uint8_state)
+            {
+                if(SCM_TICK_REACHED(uint32_tick, ptr_str_task->uint32_next_release))
+                {
+                    scm_release(ptr_str_task, uint8_task_id, uint32_tick);
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+                scm_update_next_due(ptr_str_task->uint32_next_release);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+    else
+    {
+        /* nothing released this tick */
+    }
+}
+
+/**
+ *	@brief		                            :	Checks a job about to start against the model, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[in]      uint32_tick             :   Tick the scheduler serves (scheduler pass or tick ISR)
+ */
+void scm_dispatch(uint8_t_ uint8_task_id, uint32_t_ uint32_tick)
+{
+    str_scm_task_t_ * ptr_str_task;
+    str_scm_task_t_ * ptr_str_other;
+    uint8_t_ bool_check_order = FALSE;
+    str_critical_t_ lo_str_critical;
+
+    if(SOS_NUMBER_OF_TASK_IDS > uint8_task_id)
+    {
+        SCM_LOCK(&lo_str_critical);
+        ptr_str_task = &gl_arr_str_scm_tasks[uint8_task_id];
+        gl_str_scm_stats.uint32_runs++;
+
+        if(SCM_TASK_EVENT == ptr_str_task->uint8_state)
+        {
+            /* released by its chain */
+        }
+        else if(
+                (SCM_TASK_PERIODIC == ptr_str_task->uint8_state) &&
+                (0 != ptr_str_task->uint8_pending) &&
+                (SCM_TICK_REACHED(uint32_tick, ptr_str_task->uint32_pending_release))
+                )
+        {
+            /* a woken task due by its period runs once for both */
+            ptr_str_task->bool_woken        = FALSE;
+            ptr_str_task->bool_run_released = TRUE;
+            ptr_str_task->uint32_run_release = ptr_str_task->uint32_pending_release;
+            scm_consume(ptr_str_task, uint8_task_id, uint32_tick);
+            bool_check_order = TRUE;
+        }
+        else if(
+                (SCM_TASK_PERIODIC == ptr_str_task->uint8_state) &&
+                (TRUE == ptr_str_task->bool_woken)
+                )
+        {
+            ptr_str_task->bool_woken        = FALSE;
+            ptr_str_task->bool_run_released = FALSE;
+            bool_check_order = TRUE;
+        }
+        else
+        {
+            /* not released, or not in the active mode */
+            ptr_str_task->bool_run_released = FALSE;
+            scm_fault(SCM_FAULT_EXTRA, uint8_task_id, uint32_tick);
+        }
+        ptr_str_task->bool_blocked = FALSE;
+
+        /* a released job of a higher priority task that was not waiting on a sync object goes first */
+        for(uint8_t_ uint8_other_id = 0; (TRUE == bool_check_order) && (uint8_other_id < SOS_NUMBER_OF_TASK_IDS); ++uint8_other_id)
+        {
+            ptr_str_other = &gl_arr_str_scm_tasks[uint8_other_id];
+
+            if(
+                    (SCM_TASK_PERIODIC == ptr_str_other->uint8_state) &&
+                    (0 != ptr_str_other->uint8_pending) &&
+                    (FALSE == ptr_str_other->bool_blocked) &&
+                    (FALSE == ptr_str_other->bool_woken) &&
+                    (ptr_str_other->uint8_priority < ptr_str_task->uint8_priority) &&
+                    (SCM_TICK_REACHED(uint32_tick, ptr_str_other->uint32_pending_release))
+                    )
+            {
+                scm_fault(SCM_FAULT_OUT_OF_ORDER, uint8_task_id, uint32_tick);
+                bool_check_order = FALSE;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        SCM_UNLOCK(&lo_str_critical);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ *	@brief		                            :	Drops a released job shed by an overload action, it counts as
+ *	                                            missing, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[in]      uint32_tick             :   Tick the scheduler serves
+ */
+void scm_skip(uint8_t_ uint8_task_id, uint32_t_ uint32_tick)
+{
+    str_scm_task_t_ * ptr_str_task;
+    str_critical_t_ lo_str_critical;
+
+    if(SOS_NUMBER_OF_TASK_IDS > uint8_task_id)
+    {
+        SCM_LOCK(&lo_str_critical);
+        ptr_str_task = &gl_arr_str_scm_tasks[uint8_task_id];
+
+        if(
+                (0 != ptr_str_task->uint8_pending) &&
+                (SCM_TICK_REACHED(uint32_tick, ptr_str_task->uint32_pending_release))
+                )
+        {
+            scm_fault(SCM_FAULT_MISSING, uint8_task_id, uint32_tick);
+            scm_consume(ptr_str_task, uint8_task_id, uint32_tick);
+        }
+        else
+        {
+            /* a woken run shed */
+            ptr_str_task->bool_woken = FALSE;
+        }
+        SCM_UNLOCK(&lo_str_critical);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ *	@brief		                            :	Applies the delay returned by a job to the model, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[in]      uint32_tick             :   Tick a delay returned by a woken run counts from
+ *  @param[in]      uint16_delay            :   Value returned by the task, 0 (SOS_TASK_DEFAULT_PERIOD) keeps the period
+ */
+void scm_complete(uint8_t_ uint8_task_id, uint32_t_ uint32_tick, uint16_t_ uint16_delay)
+{
+    str_scm_task_t_ * ptr_str_task;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (SOS_NUMBER_OF_TASK_IDS > uint8_task_id) &&
+            (0 != uint16_delay)
+            )
+    {
+        SCM_LOCK(&lo_str_critical);
+        ptr_str_task = &gl_arr_str_scm_tasks[uint8_task_id];
+
+        if(SCM_TASK_PERIODIC == ptr_str_task->uint8_state)
+        {
+#if (SOS_KERNEL_MODE == SOS_KERNEL_COOPERATIVE)
+            /* no job queue, the delay replaces the releases not served yet */
+            ptr_str_task->uint8_pending = 0;
+#else
+            /* a job released during the run (overrun) still runs */
+#endif
+            ptr_str_task->uint32_next_release = uint16_delay +
+                    ((TRUE == ptr_str_task->bool_run_released) ? ptr_str_task->uint32_run_release : uint32_tick);
+            if(SCM_TICK_REACHED(gl_uint32_scm_tick, ptr_str_task->uint32_next_release))
+            {
+                /* already due, the next scheduler pass may serve it before the next tick */
+                scm_release(ptr_str_task, uint8_task_id, gl_uint32_scm_tick);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+            scm_update_next_due(ptr_str_task->uint32_next_release);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        SCM_UNLOCK(&lo_str_critical);
+    }
+    else
+    {
+        /* the period goes on */
+    }
+}
+
+/**
+ *	@brief		                            :	Marks the running task as waiting on a sync object, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ */
+void scm_block(uint8_t_ uint8_task_id)
+{
+    if(SOS_NUMBER_OF_TASK_IDS > uint8_task_id)
+    {
+        gl_arr_str_scm_tasks[uint8_task_id].bool_blocked = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ *	@brief		                            :	Marks a waiter as released by a sync object, it may run once
+ *	                                            without a periodic release, called by SOS
+ *  @param[in]      uint8_task_id           :   Task ID
+ */
+void scm_wake(uint8_t_ uint8_task_id)
+{
+    if(SOS_NUMBER_OF_TASK_IDS > uint8_task_id)
+    {
+        gl_arr_str_scm_tasks[uint8_task_id].bool_blocked    = FALSE;
+        gl_arr_str_scm_tasks[uint8_task_id].bool_woken      = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ *	@brief		                            :	Gets the conformance statistics since scm_init or scm_clear_stats
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ *
+ *  @Return     SCM_STATUS_SUCCESS		    :	Success
+ *              SCM_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_scm_status_t_ scm_get_stats(str_scm_stats_t_ * ptr_str_stats)
+{
+    enu_scm_status_t_ enu_scm_status_retval = SCM_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_stats)
+    {
+        enu_scm_status_retval = SCM_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        /* the tick ISR counts missing releases */
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SCM);
+        *ptr_str_stats = gl_str_scm_stats;
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_scm_status_retval;
+}
+
+/**
+ *	@brief		                            :	Clears the statistics, the model is kept
+ */
+void scm_clear_stats(void)
+{
+    str_critical_t_ lo_str_critical;
+
+    enter_critical(&lo_str_critical, CRITICAL_SITE_SCM);
+    gl_str_scm_stats.uint32_releases            = 0;
+    gl_str_scm_stats.uint32_runs                = 0;
+    gl_str_scm_stats.uint32_missing             = 0;
+    gl_str_scm_stats.uint32_extra               = 0;
+    gl_str_scm_stats.uint32_out_of_order        = 0;
+    gl_str_scm_stats.enu_last_fault             = SCM_FAULT_NONE;
+    gl_str_scm_stats.uint8_last_fault_task_id   = 0;
+    gl_str_scm_stats.uint32_last_fault_tick     = 0;
+    exit_critical(&lo_str_critical);
+}
+
+/**
+ *	@brief		                            :	Sets the function called on every fault (e.g. to stop a soak run
+ *	                                            at the first one), NULL_PTR for none
+ *  @param[in]      ptr_func_fault          :   Fault callback
+ */
+void scm_set_fault_callback(ptr_func_scm_fault_t_ ptr_func_fault)
+{
+    gl_ptr_func_scm_fault = ptr_func_fault;
+}
+
+/**
+ * @brief a private function to count a fault and report it
+ *
+ * @param enu_fault     : fault kind
+ * @param uint8_task_id : task of the fault
+ * @param uint32_tick   : tick of the fault
+ *
+ * @return
+ */
+static void scm_fault(enu_scm_fault_t_ enu_fault, uint8_t_ uint8_task_id, uint32_t_ uint32_tick)
+{
+    switch(enu_fault)
+    {
+        case SCM_FAULT_MISSING:         gl_str_scm_stats.uint32_missing++;       break;
+        case SCM_FAULT_EXTRA:           gl_str_scm_stats.uint32_extra++;         break;
+        case SCM_FAULT_OUT_OF_ORDER:    gl_str_scm_stats.uint32_out_of_order++;  break;
+        default:                        /* Do Nothing */                         break;
+    }
+    gl_str_scm_stats.enu_last_fault             = enu_fault;
+    gl_str_scm_stats.uint8_last_fault_task_id   = uint8_task_id;
+    gl_str_scm_stats.uint32_last_fault_tick     = uint32_tick;
+
+    if(NULL_PTR != gl_ptr_func_scm_fault)
+    {
+        gl_ptr_func_scm_fault(enu_fault, uint8_task_id, uint32_tick);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief a private function to release the due jobs of a task of the model,
+ *		  they stay pending until a run tells which ones SOS kept
+ *
+ * @param ptr_str_task  : model of the task
+ * @param uint8_task_id : task ID
+ * @param uint32_tick   : current tick
+ *
+ * @return
+ */
+static void scm_release(str_scm_task_t_ * ptr_str_task, uint8_t_ uint8_task_id, uint32_t_ uint32_tick)
+{
+    do
+    {
+        gl_str_scm_stats.uint32_releases++;
+
+        if(0 == ptr_str_task->uint8_pending)
+        {
+            ptr_str_task->uint8_pending             = 1;
+            ptr_str_task->uint32_pending_release    = ptr_str_task->uint32_next_release;
+        }
+        else if(TRUE == ptr_str_task->bool_blocked)
+        {
+            /* a waiter runs once when woken */
+        }
+        else if(SCM_MAX_PENDING == ptr_str_task->uint8_pending)
+        {
+            /* the task does not run at all */
+            scm_fault(SCM_FAULT_MISSING, uint8_task_id, uint32_tick);
+        }
+        else
+        {
+            ptr_str_task->uint8_pending++;
+        }
+        ptr_str_task->uint32_next_release += ptr_str_task->uint16_period;
+    }
+    while(SCM_TICK_REACHED(uint32_tick, ptr_str_task->uint32_next_release));
+}
+
+/**
+ * @brief a private function to take the oldest pending job of a task for a
+ *		  run (or a shed), SOS serves one job per task and scheduler tick, the
+ *		  other pending jobs released at or before that tick are missing, the
+ *		  later ones stay pending
+ *
+ * @param ptr_str_task  : model of the task
+ * @param uint8_task_id : task ID
+ * @param uint32_tick   : tick the scheduler serves
+ *
+ * @return
+ */
+static void scm_consume(str_scm_task_t_ * ptr_str_task, uint8_t_ uint8_task_id, uint32_t_ uint32_tick)
+{
+    ptr_str_task->uint8_pending--;
+    ptr_str_task->uint32_pending_release += ptr_str_task->uint16_period;
+
+    while(
+            (0 != ptr_str_task->uint8_pending) &&
+            (SCM_TICK_REACHED(uint32_tick, ptr_str_task->uint32_pending_release))
+            )
+    {
+        scm_fault(SCM_FAULT_MISSING, uint8_task_id, uint32_tick);
+        ptr_str_task->uint8_pending--;
+        ptr_str_task->uint32_pending_release += ptr_str_task->uint16_period;
+    }
+}
+
+/**
+ * @brief a private function to keep the earliest release of the model, the
+ *		  tick walks the tasks only when it is reached
+ *
+ * @param uint32_release : a release of the model
+ *
+ * @return
+ */
+static void scm_update_next_due(uint32_t_ uint32_release)
+{
+    if(
+            (FALSE == gl_uint8_scm_next_due_valid) ||
+            (SCM_TICK_REACHED(gl_uint32_scm_next_due, uint32_release))
+            )
+    {
+        gl_uint32_scm_next_due      = uint32_release;
+        gl_uint8_scm_next_due_valid = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
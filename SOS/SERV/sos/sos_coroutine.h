@@ -0,0 +1,116 @@
+/**
+ * @fileName	:	sos_coroutine.h
+ * @Created		: 	10:12 AM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Stackless (protothread style) coroutines for Simple Operating System tasks
+ *
+ * A long running task can be split across several ticks by yielding back to the
+ * scheduler, the resume point is kept in the task structure so no separate stack
+ * is needed. Local variables are NOT preserved across a yield/wait, use static
+ * variables for anything that has to survive.
+ *
+ * Usage:
+ *		static uint16_t_ app_task(void)
+ *		{
+ *			static uint8_t_ lo_uint8_step;
+ *
+ *			SOS_CR_BEGIN();
+ *			for(lo_uint8_step = 0; lo_uint8_step < 10; lo_uint8_step++)
+ *			{
+ *				do_part_of_the_job();
+ *				SOS_CR_YIELD();
+ *			}
+ *			SOS_CR_WAIT_TICKS(50);
+ *			SOS_CR_END();
+ *		}
+ *
+ * @note	switch/case can not be used inside a coroutine body and only one
+ *			yield/wait macro may be placed per source line (__LINE__ is the resume point)
+ */
+
+#ifndef SOS_COROUTINE_H_
+#define SOS_COROUTINE_H_
+
+#include "sos_interface.h"
+
+/**
+ * @brief Starts the coroutine body, jumps to the point the task stopped at
+ *		  on its previous run
+ */
+#define SOS_CR_BEGIN()																	\
+	str_sos_task_t_ * ptr_str_cr_task = sos_get_running_task();							\
+	switch(ptr_str_cr_task->uint16_task_resume_point)									\
+	{																					\
+		case 0:
+
+/**
+ * @brief Gives the CPU back to the scheduler, the task continues from here
+ *		  on its next run (after one task period)
+ */
+#define SOS_CR_YIELD()																	\
+	do																					\
+	{																					\
+		ptr_str_cr_task->uint16_task_resume_point = __LINE__;							\
+		return SOS_TASK_DEFAULT_PERIOD;													\
+		case __LINE__:;																	\
+	} while(0)
+
+/**
+ * @brief Suspends the task for TICKS system ticks (1 or more), the task
+ *		  returns the delay to the scheduler so the wait is tick exact
+ *		  whatever the task period is
+ */
+#define SOS_CR_WAIT_TICKS(TICKS)														\
+	do																					\
+	{																					\
+		ptr_str_cr_task->uint16_task_resume_point = __LINE__;							\
+		return (TICKS);																	\
+		case __LINE__:;																	\
+	} while(0)
+
+/**
+ * @brief Suspends the task until CONDITION is true, the condition is
+ *		  re-evaluated once per task run
+ */
+#define SOS_CR_WAIT_EVENT(CONDITION)													\
+	do																					\
+	{																					\
+		ptr_str_cr_task->uint16_task_resume_point = __LINE__;							\
+		case __LINE__:																	\
+		if(!(CONDITION))																\
+		{																				\
+			return SOS_TASK_DEFAULT_PERIOD;												\
+		}																				\
+	} while(0)
+
+/**
+ * @brief Takes a semaphore unit, the task is not run again until a give hands
+ *		  it one (no polling)
+ */
+#define SOS_CR_SEM_TAKE(PTR_SEM)														\
+	SOS_CR_WAIT_EVENT(SOS_STATUS_WOULD_BLOCK != sos_sem_take(PTR_SEM))
+
+/**
+ * @brief Locks a mutex, the task is not run again until the owner unlocks it
+ *		  and hands it over, unlock with sos_mutex_unlock before SOS_CR_END
+ */
+#define SOS_CR_MUTEX_LOCK(PTR_MUTEX)													\
+	SOS_CR_WAIT_EVENT(SOS_STATUS_WOULD_BLOCK != sos_mutex_lock(PTR_MUTEX))
+
+/**
+ * @brief Waits for any flag of MASK, the matched flags are stored in
+ *		  PTR_FLAGS (static variable) and cleared when CLEAR is TRUE
+ */
+#define SOS_CR_EVENT_WAIT(PTR_EVENT, MASK, CLEAR, PTR_FLAGS)							\
+	SOS_CR_WAIT_EVENT(SOS_STATUS_WOULD_BLOCK != sos_event_wait((PTR_EVENT), (MASK), (CLEAR), (PTR_FLAGS)))
+
+/**
+ * @brief Ends the coroutine body and returns from the task, the next run
+ *		  starts again from SOS_CR_BEGIN
+ */
+#define SOS_CR_END()																	\
+	}																					\
+	ptr_str_cr_task->uint16_task_resume_point = 0;										\
+	return SOS_TASK_DEFAULT_PERIOD
+
+#endif /* SOS_COROUTINE_H_ */
@@ -1,127 +1,583 @@
-/**
- * @fileName	:	sos_interface.h
- * @Created		: 	2:08 AM Tuesday, May 30, 2023
- * @Author		: 	Hamsters
- * @brief		: 	Interface file for Simple Operating System 
- */ 
-
-
-#ifndef SOS_INTERFACE_H_
-#define SOS_INTERFACE_H_
-
-#include "std.h"
-
-
-
-typedef void(*ptr_func_task_t_)(void);
-
-typedef enum
-{
-	SOS_STATUS_SUCCESS				= 0	,
-	SOS_STATUS_FAILED					,
-	SOS_STATUS_INVALID_STATE			,
-	SOS_STATUS_INVALID_ARGS             ,
-	SOS_STATUS_INVALID_TASK_ID			,
-	SOS_STATUS_DATABASE_FULL			,
-	SOS_STATUS_TOTAL
-}enu_sos_status_t_;
-
-
-typedef struct
-{
-	uint8_t_ 			uint8_task_id;
-	uint8_t_ 			uint8_task_priority;
-	uint16_t_  			uint16_task_periodicity;
-	ptr_func_task_t_	ptr_func_task;
-}str_sos_task_t_;
-
-
-/**
- *	@syntax				:	sos_init(void);
- *	@description		:	Initializes the sos module
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	None
- *  @Parameters (out)	:	None
- *  @Return value		:	SOS_STATUS_SUCCESS in case timers doesn't return an error
- *							SOS_STATUS_INVALID_STATE in case timers return an error
- */ 
-enu_sos_status_t_ sos_init(void);
-
-/**
- *	@syntax				:	sos_deinit(void);
- *	@description		:	deinitializes the sos module
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	None
- *  @Parameters (out)	:	None
- *
- *
- */
-enu_sos_status_t_ sos_deinit(void);
-
-/**
- *	@syntax				:	sos_create_task(str_sos_task_t_* ptr_str_task);
- *	@description		:	Creates tasks and add them to the database
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	*ptr_str_task
- *  @Parameters (out)	:	*ptr_str_task
- *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
- *							SOS_STATUS_DATABASE_FULL in case of Database is full
- */
-enu_sos_status_t_ sos_create_task(str_sos_task_t_* ptr_str_task);
-
-/**
- *	@syntax				:	sos_delete_task(uint8_t_ uint8_task_id);
- *	@description		:	delete tasks from Database
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	uint8_taskID
- *  @Parameters (out)	:	None
- *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
- *							SOS_STATUS_TASK_NFOUND in case task is not found
- */
-enu_sos_status_t_ sos_delete_task(uint8_t_ uint8_task_id);
-
-/**
- *	@syntax				:	sos_modify_task(str_sos_task_t_ str_task);
- *	@description		:	Modifies tasks and updates the  database
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	str_task
- *  @Parameters (out)	:	None
- *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
- *							SOS_STATUS_TASK_NFOUND in case task is not found
- */
-enu_sos_status_t_ sos_modify_task(uint8_t_ uint8_task_id);
-
-/**
- *	@syntax				:	sos_run(void);
- *	@description		:	Starts timer
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	None
- *  @Parameters (out)	:	None
- *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
- *							SOS_STATUS_INVALID_STATE in case timers return an error
- */
-void sos_run(void);
-
-/**
- *	@syntax				:	sos_modify_task(str_sos_taskCreate_t_ str_task);
- *	@description		:	Stops the timer
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	uint8_taskID
- *  @Parameters (out)	:	None
- *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
- *							SOS_STATUS_INVALID_STATE in case timers return an error
- */
-void sos_disable(void);
-
-
-
-#endif
-
-
+/**
+ * @fileName	:	sos_interface.h
+ * @Created		: 	2:08 AM Tuesday, May 30, 2023
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for Simple Operating System 
+ */ 
+
+
+#ifndef SOS_INTERFACE_H_
+#define SOS_INTERFACE_H_
+
+#include "std.h"
+#include "sos_preconfig.h"
+
+
+
+/*
+ * A task returns the delay in ticks until its next run, counted from the tick
+ * that released the current run, or SOS_TASK_DEFAULT_PERIOD to keep running
+ * every uint16_task_periodicity ticks
+ */
+typedef uint16_t_(*ptr_func_task_t_)(void);
+
+#define SOS_TASK_DEFAULT_PERIOD			0
+
+/* tick/ms conversions for sos_get_ticks values, a delay in ms is rounded up to whole ticks */
+#define SOS_MS_TO_TICKS(MS)				(((uint32_t_)(MS) + SOS_SYS_TICK_TIME_MS - 1) / SOS_SYS_TICK_TIME_MS)
+#define SOS_TICKS_TO_MS(TICKS)			((uint32_t_)(TICKS) * SOS_SYS_TICK_TIME_MS)
+
+typedef enum
+{
+	SOS_STATUS_SUCCESS				= 0	,
+	SOS_STATUS_FAILED					,
+	SOS_STATUS_INVALID_STATE			,
+	SOS_STATUS_INVALID_ARGS             ,
+	SOS_STATUS_INVALID_TASK_ID			,
+	SOS_STATUS_DATABASE_FULL			,
+	SOS_STATUS_INVALID_MODE_ID			,
+	SOS_STATUS_CHAIN_CYCLE				,
+	SOS_STATUS_WOULD_BLOCK				,	/* task registered as a waiter, return from the task	*/
+	SOS_STATUS_NOT_OWNER				,
+	SOS_STATUS_TOTAL
+}enu_sos_status_t_;
+
+typedef enum
+{
+	SOS_MODE_SWITCH_NEXT_TICK		= 0	,	/* switch right after the current tick is served			*/
+	SOS_MODE_SWITCH_HYPER_PERIOD		,	/* switch when the current mode completes its hyper-period	*/
+	SOS_MODE_SWITCH_TOTAL
+}enu_sos_mode_switch_t_;
+
+
+/* What the scheduler does when a job of the task misses its deadline */
+typedef enum
+{
+	SOS_OVERLOAD_NONE				= 0	,	/* miss only counted											*/
+	SOS_OVERLOAD_SKIP_NEXT				,	/* next job is dropped, a job late at dispatch is dropped itself	*/
+	SOS_OVERLOAD_DEGRADE				,	/* period doubled on each miss, restored as jobs meet again		*/
+	SOS_OVERLOAD_HANDLER				,	/* ptr_func_overload is called with the task ID					*/
+	SOS_OVERLOAD_TOTAL
+}enu_sos_overload_action_t_;
+
+/* Called from the scheduler (preemptive: with interrupts disabled), keep it short */
+typedef void(*ptr_func_overload_t_)(uint8_t_ uint8_task_id);
+
+typedef struct
+{
+	uint8_t_ 			uint8_task_id;
+	uint8_t_ 			uint8_task_priority;
+	uint16_t_  			uint16_task_periodicity;
+	ptr_func_task_t_	ptr_func_task;
+	/** Optional, left 0/NULL the deadline is the period and misses are only counted */
+	uint16_t_					uint16_task_deadline;		/* ticks from the release to the job end	*/
+	enu_sos_overload_action_t_	enu_overload_action;
+	ptr_func_overload_t_		ptr_func_overload;			/* SOS_OVERLOAD_HANDLER only				*/
+	/** Owned by SOS, coroutine resume state (see sos_coroutine.h) */
+	uint16_t_			uint16_task_resume_point;
+	/** Owned by SOS, system tick of the next release */
+	uint32_t_			uint32_task_release_tick;
+}str_sos_task_t_;
+
+/* Deadline statistics of one task, kept per task ID */
+typedef struct
+{
+	uint16_t_	uint16_misses;				/* jobs late at dispatch or at completion, saturates	*/
+	uint16_t_	uint16_shed;				/* jobs dropped by SOS_OVERLOAD_SKIP_NEXT, saturates		*/
+	uint8_t_	uint8_degrade_shift;		/* SOS_OVERLOAD_DEGRADE, runs every period << shift		*/
+}str_sos_deadline_stats_t_;
+
+/*
+ * Background task, one short slice of work per call (a checksum block, a log
+ * line, one EEPROM byte), the function returns to let the next background
+ * task or a released periodic task run. Background tasks run in round-robin
+ * only while no periodic task is due and never block.
+ */
+typedef void(*ptr_func_bg_task_t_)(void);
+
+typedef struct str_sos_bg_task_t_
+{
+	ptr_func_bg_task_t_				ptr_func_task;
+	/** Owned by SOS */
+	struct str_sos_bg_task_t_ *		ptr_str_next;
+	uint32_t_						uint32_slices;		/* slices run since created			*/
+}str_sos_bg_task_t_;
+
+/*
+ * Background throughput, busy and slice times are measured on the TIMER_1
+ * 1 us counter started by timer_init
+ */
+typedef struct
+{
+	uint32_t_	uint32_slices;				/* slices run, all background tasks			*/
+	uint32_t_	uint32_busy_us;				/* time spent in background slices			*/
+	uint32_t_	uint32_cutoffs;				/* ticks the margin stopped background work	*/
+	uint16_t_	uint16_max_slice_us;		/* longest slice, keep it below the margin	*/
+}str_sos_bg_stats_t_;
+
+#define SOS_SYNC_NO_OWNER				0xFF
+
+/*
+ * Synchronization objects are owned by the caller (static or global), waiters
+ * are kept as task ID bit masks. A task that can not take an object is
+ * registered as a waiter and skipped by the scheduler until the object is
+ * given to it, use the sos_coroutine.h wait macros to retry from the same point.
+ */
+typedef struct
+{
+	/** Owned by SOS */
+	uint16_t_	uint16_waiters;
+	uint16_t_	uint16_granted;			/* waiters handed a unit by a give, their next take succeeds	*/
+	uint8_t_	uint8_count;
+	/** Set by sos_sem_init */
+	uint8_t_	uint8_max_count;
+}str_sos_sem_t_;
+
+typedef struct
+{
+	/** Owned by SOS */
+	uint16_t_	uint16_waiters;
+	uint8_t_	uint8_owner_id;			/* SOS_SYNC_NO_OWNER when free							*/
+	uint8_t_	uint8_owner_ceiling;	/* ceiling the owner had before locking, restored on unlock	*/
+	/** Set by sos_mutex_init */
+	uint8_t_	uint8_ceiling;			/* priority of the highest priority task using the mutex	*/
+}str_sos_mutex_t_;
+
+typedef struct
+{
+	/** Owned by SOS */
+	uint16_t_	uint16_waiters;
+	uint8_t_	uint8_flags;
+}str_sos_event_t_;
+
+
+/**
+ *	@syntax				:	sos_init(void);
+ *	@description		:	Initializes the sos module
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	None
+ *  @Parameters (out)	:	None
+ *  @Return value		:	SOS_STATUS_SUCCESS in case timers doesn't return an error
+ *							SOS_STATUS_INVALID_STATE in case timers return an error
+ */ 
+enu_sos_status_t_ sos_init(void);
+
+/**
+ *	@syntax				:	sos_deinit(void);
+ *	@description		:	deinitializes the sos module
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	None
+ *  @Parameters (out)	:	None
+ *
+ *
+ */
+enu_sos_status_t_ sos_deinit(void);
+
+/**
+ *	@syntax				:	sos_create_task(str_sos_task_t_* ptr_str_task);
+ *	@description		:	Creates tasks and add them to the database
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	*ptr_str_task
+ *  @Parameters (out)	:	*ptr_str_task
+ *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
+ *							SOS_STATUS_DATABASE_FULL in case of Database is full
+ */
+enu_sos_status_t_ sos_create_task(str_sos_task_t_* ptr_str_task);
+
+/**
+ *	@syntax				:	sos_delete_task(uint8_t_ uint8_task_id);
+ *	@description		:	delete tasks from Database
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	uint8_taskID
+ *  @Parameters (out)	:	None
+ *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
+ *							SOS_STATUS_TASK_NFOUND in case task is not found
+ */
+enu_sos_status_t_ sos_delete_task(uint8_t_ uint8_task_id);
+
+/**
+ *	@syntax				:	sos_modify_task(str_sos_task_t_ str_task);
+ *	@description		:	Modifies tasks and updates the  database
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	str_task
+ *  @Parameters (out)	:	None
+ *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
+ *							SOS_STATUS_TASK_NFOUND in case task is not found
+ */
+enu_sos_status_t_ sos_modify_task(uint8_t_ uint8_task_id);
+
+/**
+ *	@syntax				:	sos_run(void);
+ *	@description		:	Starts timer
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	None
+ *  @Parameters (out)	:	None
+ *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
+ *							SOS_STATUS_INVALID_STATE in case timers return an error
+ */
+void sos_run(void);
+
+/**
+ *	@syntax				:	sos_modify_task(str_sos_taskCreate_t_ str_task);
+ *	@description		:	Stops the timer
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	uint8_taskID
+ *  @Parameters (out)	:	None
+ *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
+ *							SOS_STATUS_INVALID_STATE in case timers return an error
+ */
+void sos_disable(void);
+
+/**
+ *	@brief		                            :	Waits for the next interrupt outside sos_run (e.g. for a start
+ *	                                            button), returns at once on the target. On a host build the
+ *	                                            simulator moves its clock to the next interrupt
+ */
+void sos_idle(void);
+
+/**
+ *	@brief		                            :	Adds a task to the task set of a given operating mode, the mode task set
+ *	                                            is kept sorted by priority so switching to it later costs no sorting
+ *  @param[in]      uint8_mode_id 	        :   Mode to add the task to (0 -> SOS_NUMBER_OF_MODES - 1)
+ *  @param[in,out]  ptr_str_task 	        :   Pointer to task structure, a task shared by several modes keeps one ID
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task added successfully
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_MODE_ID  :   Failed,     Mode ID out of range
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Invalid Arguments Given or task already in this mode
+ *              SOS_STATUS_DATABASE_FULL    :   Failed,     Mode task set is full
+ */
+enu_sos_status_t_ sos_mode_create_task(uint8_t_ uint8_mode_id, str_sos_task_t_* ptr_str_task);
+
+/**
+ *	@brief		                            :	Removes a task from the task set of a given operating mode
+ *  @param[in]      uint8_mode_id 	        :   Mode to remove the task from
+ *  @param[in]      uint8_task_id 	        :   Task ID to remove
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task removed successfully
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_MODE_ID  :   Failed,     Mode ID out of range
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in mode task set
+ */
+enu_sos_status_t_ sos_mode_delete_task(uint8_t_ uint8_mode_id, uint8_t_ uint8_task_id);
+
+/**
+ *	@brief		                            :	Requests switching the running task set to another prebuilt mode,
+ *	                                            the switch is a single pointer swap applied by the scheduler at the
+ *	                                            requested boundary, a newer request replaces a pending one.
+ *	                                            Can be called from task or interrupt context
+ *  @param[in]      uint8_mode_id 	        :   Mode to switch to
+ *  @param[in]      enu_switch_point 	    :   SOS_MODE_SWITCH_NEXT_TICK or SOS_MODE_SWITCH_HYPER_PERIOD
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Switch applied (SOS not running) or scheduled
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_MODE_ID  :   Failed,     Mode ID out of range
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Invalid switch point
+ */
+enu_sos_status_t_ sos_switch_mode(uint8_t_ uint8_mode_id, enu_sos_mode_switch_t_ enu_switch_point);
+
+/**
+ *	@brief		                            :	Gets the currently running mode
+ *  @param[out]     ptr_uint8_mode_id 	    :   Pointer to store the active mode ID
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_mode(uint8_t_* ptr_uint8_mode_id);
+
+/**
+ *	@brief		                            :	Gets a copy of the task set of an operating mode in priority order,
+ *	                                            slots past the task count are NULL_PTR. Task context
+ *  @param[in]      uint8_mode_id 	        :   Mode to read (0 -> SOS_NUMBER_OF_MODES - 1)
+ *  @param[out]     arr_ptr_str_tasks 	    :   Array of SOS_NUMBER_OF_TASKS task pointers to fill
+ *  @param[out]     ptr_uint8_count 	    :   Pointer to store the number of tasks in the mode
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_MODE_ID  :   Failed,     Mode ID out of range
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_mode_tasks(uint8_t_ uint8_mode_id, str_sos_task_t_ ** arr_ptr_str_tasks, uint8_t_ * ptr_uint8_count);
+
+/**
+ *	@brief		                            :	Gets the worst case mode switch latency measured since sos_init,
+ *	                                            counted in system ticks from the sos_switch_mode call until the
+ *	                                            new task set is in place
+ *  @param[out]     ptr_uint32_max_latency  :   Pointer to store the latency in ticks
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_mode_switch_latency(uint32_t_* ptr_uint32_max_latency);
+
+/**
+ *	@brief		                            :	Gets the worst case dispatch latency of the highest priority task
+ *	                                            measured since sos_init, from the system tick that released it
+ *	                                            until its first instruction, in both kernel modes, timed on
+ *	                                            TIMER_1 (1 us), the preemptive context switch included
+ *  @param[out]     ptr_uint32_max_latency_us:  Pointer to store the latency in microseconds
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_dispatch_latency(uint32_t_* ptr_uint32_max_latency_us);
+
+/**
+ *	@brief		                            :	Chains two tasks, the successor is no longer released by its own
+ *	                                            period, it runs in the same scheduler pass right after all of its
+ *	                                            predecessors finished (run to completion pipeline), a delay
+ *	                                            returned by a chained successor holds its next run back
+ *  @param[in]      uint8_predecessor_id    :   Task that releases the successor
+ *  @param[in]      uint8_successor_id      :   Task released when its predecessors finish
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Tasks chained
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in any mode
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Task chained to itself
+ *              SOS_STATUS_CHAIN_CYCLE      :   Failed,     The link would close a cycle, chains must be a DAG
+ */
+enu_sos_status_t_ sos_chain_tasks(uint8_t_ uint8_predecessor_id, uint8_t_ uint8_successor_id);
+
+/**
+ *	@brief		                            :	Removes a link added by sos_chain_tasks, a successor left without
+ *	                                            predecessors is released by its own period again
+ *  @param[in]      uint8_predecessor_id    :   Predecessor task ID
+ *  @param[in]      uint8_successor_id      :   Successor task ID
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Link removed
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Tasks are not chained
+ */
+enu_sos_status_t_ sos_unchain_tasks(uint8_t_ uint8_predecessor_id, uint8_t_ uint8_successor_id);
+
+/**
+ *	@brief		                            :	Gets the worst case end to end latency of a chain, from the system
+ *	                                            tick that released the chain until the given successor finished
+ *  @param[in]      uint8_task_id           :   Chained task ID (usually the last task of the pipeline)
+ *  @param[out]     ptr_uint32_max_latency_us:  Pointer to store the latency in microseconds
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID out of range
+ */
+enu_sos_status_t_ sos_get_chain_latency(uint8_t_ uint8_task_id, uint32_t_* ptr_uint32_max_latency_us);
+
+/**
+ *	@brief		                            :	Gets the deadline statistics of a task
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not used by any mode
+ */
+enu_sos_status_t_ sos_get_deadline_stats(uint8_t_ uint8_task_id, str_sos_deadline_stats_t_ * ptr_str_stats);
+
+/**
+ *	@brief		                            :	Adds a background task to the round-robin, it gets slices of the
+ *	                                            time left after the periodic tasks of every tick
+ *  @param[in,out]  ptr_str_bg_task         :   Caller owned background task
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or task already added
+ */
+enu_sos_status_t_ sos_create_bg_task(str_sos_bg_task_t_ * ptr_str_bg_task);
+
+/**
+ *	@brief		                            :	Removes a background task from the round-robin
+ *  @param[in,out]  ptr_str_bg_task         :   Background task to remove
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or task not added
+ */
+enu_sos_status_t_ sos_delete_bg_task(str_sos_bg_task_t_ * ptr_str_bg_task);
+
+/**
+ *	@brief		                            :	Gets the background throughput since sos_init
+ *  @param[out]     ptr_str_bg_stats        :   Pointer to store the statistics
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_bg_stats(str_sos_bg_stats_t_ * ptr_str_bg_stats);
+
+/**
+ *	@brief		                            :	Gets the task currently dispatched by the scheduler
+ *
+ *  @Return     Pointer to the running task, NULL_PTR when called outside of a task
+ */
+str_sos_task_t_ * sos_get_running_task(void);
+
+/**
+ *	@brief		                            :	Gets the free running system tick count, read twice until both
+ *	                                            reads match so a tick landing in the middle of the 4 byte read is
+ *	                                            not seen torn, interrupts are never disabled. Task or ISR context
+ *
+ *  @Return     Ticks since start, wraps around to 0 after 2^32 ticks
+ */
+uint32_t_ sos_get_ticks(void);
+
+/**
+ *	@brief		                            :	Gets the ticks elapsed since a sos_get_ticks value, correct across
+ *	                                            the counter wraparound for intervals shorter than 2^32 ticks
+ *  @param[in]      uint32_since_tick       :   Earlier sos_get_ticks value
+ *
+ *  @Return     Elapsed ticks
+ */
+uint32_t_ sos_ticks_elapsed(uint32_t_ uint32_since_tick);
+
+/**
+ *	@brief		                            :	Checks if a tick count has been reached, correct across the
+ *	                                            counter wraparound for ticks less than 2^31 ticks away
+ *  @param[in]      uint32_tick             :   Tick to check, e.g. sos_get_ticks() + SOS_MS_TO_TICKS(500)
+ *
+ *  @Return     TRUE when reached or passed, FALSE otherwise
+ */
+uint8_t_ sos_ticks_reached(uint32_t_ uint32_tick);
+
+/**
+ *	@brief		                            :	Initializes a counting semaphore
+ *  @param[out]     ptr_str_sem             :   Semaphore to initialize
+ *  @param[in]      uint8_initial_count     :   Units available at start
+ *  @param[in]      uint8_max_count         :   Units limit (1 for a binary semaphore)
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given, zero limit or initial count above it
+ */
+enu_sos_status_t_ sos_sem_init(str_sos_sem_t_ * ptr_str_sem, uint8_t_ uint8_initial_count, uint8_t_ uint8_max_count);
+
+/**
+ *	@brief		                            :	Takes one unit of a semaphore, when none is available the running
+ *	                                            task waits for it (not run again until a give hands it a unit)
+ *  @param[in,out]  ptr_str_sem             :   Semaphore to take
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Unit taken
+ *              SOS_STATUS_WOULD_BLOCK      :   Failed,     Task registered as a waiter, return from the task
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     No unit and not called from a task
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_sem_take(str_sos_sem_t_ * ptr_str_sem);
+
+/**
+ *	@brief		                            :	Gives one unit back, handed to the highest priority waiter if any
+ *  @param[in,out]  ptr_str_sem             :   Semaphore to give
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     Count already at its limit
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_sem_give(str_sos_sem_t_ * ptr_str_sem);
+
+/**
+ *	@brief		                            :	Same as sos_sem_give, for ISR context (interrupts stay disabled)
+ */
+enu_sos_status_t_ sos_sem_give_from_isr(str_sos_sem_t_ * ptr_str_sem);
+
+/**
+ *	@brief		                            :	Initializes a mutex with the immediate priority ceiling protocol,
+ *	                                            the owner runs at the ceiling priority so a task that may lock
+ *	                                            the mutex never preempts it (no unbounded priority inversion)
+ *  @param[out]     ptr_str_mutex           :   Mutex to initialize
+ *  @param[in]      uint8_ceiling           :   Priority of the highest priority task that locks it
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_mutex_init(str_sos_mutex_t_ * ptr_str_mutex, uint8_t_ uint8_ceiling);
+
+/**
+ *	@brief		                            :	Locks a mutex for the running task, not recursive, nested mutexes
+ *	                                            are unlocked in reverse order
+ *  @param[in,out]  ptr_str_mutex           :   Mutex to lock
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Running task owns the mutex
+ *              SOS_STATUS_WOULD_BLOCK      :   Failed,     Task registered as a waiter, return from the task
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     Not called from a task
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_mutex_lock(str_sos_mutex_t_ * ptr_str_mutex);
+
+/**
+ *	@brief		                            :	Unlocks a mutex, ownership goes to the highest priority waiter if any
+ *  @param[in,out]  ptr_str_mutex           :   Mutex to unlock
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_NOT_OWNER        :   Failed,     Running task does not own the mutex
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_mutex_unlock(str_sos_mutex_t_ * ptr_str_mutex);
+
+/**
+ *	@brief		                            :	Initializes an event flag group, all flags cleared
+ *  @param[out]     ptr_str_event           :   Event group to initialize
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_event_init(str_sos_event_t_ * ptr_str_event);
+
+/**
+ *	@brief		                            :	Waits for any of the given flags, the running task is not run again
+ *	                                            until one of them is set
+ *  @param[in,out]  ptr_str_event           :   Event group
+ *  @param[in]      uint8_mask              :   Flags to wait for
+ *  @param[in]      bool_clear              :   TRUE to clear the matched flags
+ *  @param[out]     ptr_uint8_flags         :   Matched flags (may be NULL_PTR)
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    At least one flag of the mask is set
+ *              SOS_STATUS_WOULD_BLOCK      :   Failed,     Task registered as a waiter, return from the task
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     No flag set and not called from a task
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or empty mask
+ */
+enu_sos_status_t_ sos_event_wait(str_sos_event_t_ * ptr_str_event, uint8_t_ uint8_mask, uint8_t_ bool_clear, uint8_t_ * ptr_uint8_flags);
+
+/**
+ *	@brief		                            :	Sets flags, every waiter waiting for one of them is released
+ *  @param[in,out]  ptr_str_event           :   Event group
+ *  @param[in]      uint8_flags             :   Flags to set
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_event_set(str_sos_event_t_ * ptr_str_event, uint8_t_ uint8_flags);
+
+/**
+ *	@brief		                            :	Same as sos_event_set, for ISR context (interrupts stay disabled)
+ */
+enu_sos_status_t_ sos_event_set_from_isr(str_sos_event_t_ * ptr_str_event, uint8_t_ uint8_flags);
+
+/**
+ *	@brief		                            :	Clears flags
+ *  @param[in,out]  ptr_str_event           :   Event group
+ *  @param[in]      uint8_flags             :   Flags to clear
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_event_clear(str_sos_event_t_ * ptr_str_event, uint8_t_ uint8_flags);
+
+/**
+ *	@brief		                            :	Gets the longest interrupts disabled section of the semaphore, mutex
+ *	                                            and event calls since sos_init (TIMER_1 1 us counter), sos_init
+ *	                                            clears every critical section site, see critical.h
+ *  @param[out]     ptr_uint16_max_us       :   Pointer to store the time in microseconds
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_sync_lock_time(uint16_t_ * ptr_uint16_max_us);
+
+
+
+#endif
+
+
@@ -0,0 +1,135 @@
+/**
+ * @fileName	:	sos_port.h
+ * @Created		: 	11:40 AM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Context switch port used by the Simple Operating System preemptive kernel
+ *
+ * Two ports are provided, sos_port_avr.c saves the call-saved registers and
+ * SREG on the task stack and swaps the stack pointer, sos_port_host.c uses
+ * ucontext so the same kernel can be stepped on a PC.
+ */
+
+
+#ifndef SOS_PORT_H_
+#define SOS_PORT_H_
+
+#include "std.h"
+
+#if defined(__AVR__)
+
+/* the whole context lives on the task stack, only the stack pointer is kept */
+typedef struct
+{
+	uint8_t_ *			ptr_uint8_stack_pointer;
+}str_sos_port_context_t_;
+
+#define SOS_PORT_MIN_STACK_SIZE			0
+
+#else
+
+#include <ucontext.h>
+
+typedef struct
+{
+	ucontext_t			str_ucontext;
+}str_sos_port_context_t_;
+
+/* host libc calls (printf, ...) need far more stack than an AVR task */
+#define SOS_PORT_MIN_STACK_SIZE			16384
+
+/*
+ * AVR cycles of a switch on the target, charged to the simulator clock by the
+ * host port: call 4, 19 push 38, SREG in/out 2, SP save/load 14, 19 pop 38,
+ * clr 1, ret 4 (sos_port_avr.c)
+ */
+#define SOS_PORT_SWITCH_CYCLES			101
+
+#endif
+
+/* Stack reserved per task, at least what the port itself needs */
+#define SOS_PORT_STACK_SIZE(SIZE)		(((SIZE) > SOS_PORT_MIN_STACK_SIZE) ? (SIZE) : SOS_PORT_MIN_STACK_SIZE)
+
+typedef void(*ptr_func_port_entry_t_)(void);
+
+/**
+ * @brief                               :   Prepares a fresh context that starts executing ptr_func_entry
+ *                                          on the given stack the first time it is switched to,
+ *                                          ptr_func_entry must never return
+ *
+ * @param[out]  ptr_str_context         :   Context to initialize
+ * @param[in]   ptr_uint8_stack         :   Lowest address of the task stack
+ * @param[in]   uint16_stack_size       :   Stack size in bytes
+ * @param[in]   ptr_func_entry          :   Context entry point
+ */
+void sos_port_init_context(str_sos_port_context_t_ * ptr_str_context, uint8_t_ * ptr_uint8_stack,
+                           uint16_t_ uint16_stack_size, ptr_func_port_entry_t_ ptr_func_entry);
+
+/**
+ * @brief                               :   Saves the running context in ptr_str_from and resumes ptr_str_to,
+ *                                          returns when ptr_str_from is switched back to.
+ *                                          Must be called with interrupts disabled
+ *
+ * @param[out]  ptr_str_from            :   Where the running context is saved
+ * @param[in]   ptr_str_to              :   Context to resume
+ */
+void sos_port_switch_context(str_sos_port_context_t_ * ptr_str_from, str_sos_port_context_t_ * ptr_str_to);
+
+/**
+ * @brief                               :   Called by the kernel when nothing is ready to run, returns after
+ *                                          an interrupt (or at once). The AVR port keeps polling, the host
+ *                                          port lets the simulator move its clock to the next interrupt, or
+ *                                          sleep until it in real time mode (sim_set_realtime)
+ */
+void sos_port_idle(void);
+
+/*
+ * Trace points of the kernel, compiled out on the target. The host port
+ * writes them to the simulator trace (SIM_TRACE), next to the interrupts
+ */
+#if defined(__AVR__)
+
+#define SOS_PORT_TRACE_JOB(TASK_ID, BOOL_BEGIN)
+#define SOS_PORT_TRACE_BACKGROUND(BOOL_BEGIN)
+#define SOS_PORT_TRACE_STATE(STATE)
+#define SOS_PORT_TRACE_EVENT(NAME)
+
+#else
+
+#define SOS_PORT_TRACE_JOB(TASK_ID, BOOL_BEGIN)		sos_port_trace_job((TASK_ID), (BOOL_BEGIN))
+#define SOS_PORT_TRACE_BACKGROUND(BOOL_BEGIN)		sos_port_trace_background(BOOL_BEGIN)
+#define SOS_PORT_TRACE_STATE(STATE)					sos_port_trace_state(#STATE, (uint8_t_)(STATE))
+#define SOS_PORT_TRACE_EVENT(NAME)					sos_port_trace_event(NAME)
+
+/**
+ * @brief                               :   Marks the start or the end of a job of a task
+ *
+ * @param[in]   uint8_task_id           :   Task ID, one trace row per ID
+ * @param[in]   bool_begin              :   TRUE job starts, FALSE job ends
+ */
+void sos_port_trace_job(uint8_t_ uint8_task_id, uint8_t_ bool_begin);
+
+/**
+ * @brief                               :   Marks the start or the end of a background task slice
+ *
+ * @param[in]   bool_begin              :   TRUE slice starts, FALSE slice ends
+ */
+void sos_port_trace_background(uint8_t_ bool_begin);
+
+/**
+ * @brief                               :   Records a scheduler state transition
+ *
+ * @param[in]   ptr_str_name            :   State name
+ * @param[in]   uint8_state             :   State value
+ */
+void sos_port_trace_state(const char * ptr_str_name, uint8_t_ uint8_state);
+
+/**
+ * @brief                               :   Records a kernel event (hyper-period restart, mode switch)
+ *
+ * @param[in]   ptr_str_name            :   Event name
+ */
+void sos_port_trace_event(const char * ptr_str_name);
+
+#endif
+
+#endif /* SOS_PORT_H_ */
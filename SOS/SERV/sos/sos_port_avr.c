@@ -0,0 +1,107 @@
+/**
+ * @fileName	:	sos_port_avr.c
+ * @Created		: 	11:40 AM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	AVR context switch port for the Simple Operating System preemptive kernel
+ */
+#include "sos_port.h"
+
+#if defined(__AVR__)
+
+/* r2-r17, r28, r29 and SREG */
+#define SOS_PORT_SAVED_REGISTERS		19
+
+void sos_port_init_context(str_sos_port_context_t_ * ptr_str_context, uint8_t_ * ptr_uint8_stack,
+                           uint16_t_ uint16_stack_size, ptr_func_port_entry_t_ ptr_func_entry)
+{
+	uint8_t_ * lo_ptr_uint8_top = ptr_uint8_stack + uint16_stack_size - 1;
+	uint16_t_ lo_uint16_entry = (uint16_t_)ptr_func_entry;
+	uint8_t_ lo_uint8_index;
+
+	/* return address as pushed by call, low byte at the higher address */
+	*lo_ptr_uint8_top-- = (uint8_t_)(lo_uint16_entry & 0xFF);
+	*lo_ptr_uint8_top-- = (uint8_t_)(lo_uint16_entry >> 8);
+
+	/* cleared registers, SREG = 0 so the entry starts with interrupts disabled */
+	for (lo_uint8_index = 0; lo_uint8_index < SOS_PORT_SAVED_REGISTERS; lo_uint8_index++)
+	{
+		*lo_ptr_uint8_top-- = 0;
+	}
+
+	ptr_str_context->ptr_uint8_stack_pointer = lo_ptr_uint8_top;
+}
+
+/*
+ * ptr_str_from in r25:r24, ptr_str_to in r23:r22, the call-clobbered registers
+ * are already saved by the caller (or by the ISR prologue)
+ */
+__attribute__((naked, noinline))
+void sos_port_switch_context(str_sos_port_context_t_ * ptr_str_from, str_sos_port_context_t_ * ptr_str_to)
+{
+	__asm__ __volatile__ (
+		"push r2				\n\t"
+		"push r3				\n\t"
+		"push r4				\n\t"
+		"push r5				\n\t"
+		"push r6				\n\t"
+		"push r7				\n\t"
+		"push r8				\n\t"
+		"push r9				\n\t"
+		"push r10				\n\t"
+		"push r11				\n\t"
+		"push r12				\n\t"
+		"push r13				\n\t"
+		"push r14				\n\t"
+		"push r15				\n\t"
+		"push r16				\n\t"
+		"push r17				\n\t"
+		"push r28				\n\t"
+		"push r29				\n\t"
+		"in   r0, __SREG__		\n\t"
+		"push r0				\n\t"
+
+		/* save SP in *ptr_str_from */
+		"movw r30, r24			\n\t"
+		"in   r0, __SP_L__		\n\t"
+		"st   Z, r0				\n\t"
+		"in   r0, __SP_H__		\n\t"
+		"std  Z+1, r0			\n\t"
+
+		/* load SP from *ptr_str_to */
+		"movw r30, r22			\n\t"
+		"ld   r0, Z				\n\t"
+		"ldd  r1, Z+1			\n\t"
+		"out  __SP_H__, r1		\n\t"
+		"out  __SP_L__, r0		\n\t"
+
+		"pop  r0				\n\t"
+		"out  __SREG__, r0		\n\t"
+		"pop  r29				\n\t"
+		"pop  r28				\n\t"
+		"pop  r17				\n\t"
+		"pop  r16				\n\t"
+		"pop  r15				\n\t"
+		"pop  r14				\n\t"
+		"pop  r13				\n\t"
+		"pop  r12				\n\t"
+		"pop  r11				\n\t"
+		"pop  r10				\n\t"
+		"pop  r9				\n\t"
+		"pop  r8				\n\t"
+		"pop  r7				\n\t"
+		"pop  r6				\n\t"
+		"pop  r5				\n\t"
+		"pop  r4				\n\t"
+		"pop  r3				\n\t"
+		"pop  r2				\n\t"
+		"clr  r1				\n\t"
+		"ret					\n\t"
+	);
+}
+
+void sos_port_idle(void)
+{
+	/* the kernel loop keeps polling, an interrupt is served right away */
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,70 @@
+/**
+ * @fileName	:	sos_port_host.c
+ * @Created		: 	11:40 AM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	ucontext context switch port, lets the preemptive kernel run on a PC
+ */
+#include "sos_port.h"
+
+#if !defined(__AVR__)
+
+#include "sim_interface.h"
+
+void sos_port_init_context(str_sos_port_context_t_ * ptr_str_context, uint8_t_ * ptr_uint8_stack,
+                           uint16_t_ uint16_stack_size, ptr_func_port_entry_t_ ptr_func_entry)
+{
+	getcontext(&ptr_str_context->str_ucontext);
+	ptr_str_context->str_ucontext.uc_stack.ss_sp	= ptr_uint8_stack;
+	ptr_str_context->str_ucontext.uc_stack.ss_size	= uint16_stack_size;
+	ptr_str_context->str_ucontext.uc_link			= NULL_PTR;
+	makecontext(&ptr_str_context->str_ucontext, ptr_func_entry, 0);
+}
+
+void sos_port_switch_context(str_sos_port_context_t_ * ptr_str_from, str_sos_port_context_t_ * ptr_str_to)
+{
+	sim_trace_switch();
+	sim_consume_cycles(SOS_PORT_SWITCH_CYCLES);
+	swapcontext(&ptr_str_from->str_ucontext, &ptr_str_to->str_ucontext);
+}
+
+void sos_port_idle(void)
+{
+	sim_idle();
+}
+
+void sos_port_trace_job(uint8_t_ uint8_task_id, uint8_t_ bool_begin)
+{
+	if(TRUE == bool_begin)
+	{
+		sim_trace_begin(SIM_TRACE_TRACK_TASKS + uint8_task_id, "job");
+	}
+	else
+	{
+		sim_trace_end(SIM_TRACE_TRACK_TASKS + uint8_task_id);
+	}
+}
+
+void sos_port_trace_background(uint8_t_ bool_begin)
+{
+	if(TRUE == bool_begin)
+	{
+		sim_trace_begin(SIM_TRACE_TRACK_BACKGROUND, "slice");
+	}
+	else
+	{
+		sim_trace_end(SIM_TRACE_TRACK_BACKGROUND);
+	}
+}
+
+void sos_port_trace_state(const char * ptr_str_name, uint8_t_ uint8_state)
+{
+	sim_trace_counter("scheduler state", uint8_state);
+	sim_trace_instant(SIM_TRACE_TRACK_KERNEL, ptr_str_name);
+}
+
+void sos_port_trace_event(const char * ptr_str_name)
+{
+	sim_trace_instant(SIM_TRACE_TRACK_KERNEL, ptr_str_name);
+}
+
+#endif /* !__AVR__ */
@@ -1,17 +1,56 @@
-/**
- * @fileName	:	sos_preconfig.h
- * @Created		: 	2:08 AM Tuesday, May 30, 2023
- * @Author		: 	Hamsters
- * @brief		: 	Pre-compiled configurations file for Simple Operating System 
- */
-
-
-#ifndef SOS_PRECONFIG_H_
-#define SOS_PRECONFIG_H_
-
-#define SOS_NUMBER_OF_TASKS				5
-#define SOS_SYS_TICK_TIME_MS			20		//Time in ms
-
-//#define SOS_MAX_ID_NUMBER               255
-
+/**
+ * @fileName	:	sos_preconfig.h
+ * @Created		: 	2:08 AM Tuesday, May 30, 2023
+ * @Author		: 	Hamsters
+ * @brief		: 	Pre-compiled configurations file for Simple Operating System 
+ */
+
+
+#ifndef SOS_PRECONFIG_H_
+#define SOS_PRECONFIG_H_
+
+/* sizes can be overridden by the build (the host bench runs bigger task sets) */
+#ifndef SOS_NUMBER_OF_TASKS
+#define SOS_NUMBER_OF_TASKS				5
+#endif
+#define SOS_SYS_TICK_TIME_MS			20		//Time in ms
+
+/* Operating modes, each mode owns a prebuilt task set, mode 0 is active after sos_init */
+#define SOS_NUMBER_OF_MODES				3
+#define SOS_DEFAULT_MODE_ID				0
+#ifndef SOS_NUMBER_OF_TASK_IDS
+#define SOS_NUMBER_OF_TASK_IDS			8		// distinct tasks across all modes
+#endif
+
+/* Kernel mode
+ * COOPERATIVE : tasks run to completion from sos_run, a task released by a tick
+ *               waits for the running one to return
+ * PREEMPTIVE  : every task has its own stack, the tick ISR switches to a released
+ *               task with a higher priority than the running one
+ */
+#define SOS_KERNEL_COOPERATIVE			0
+#define SOS_KERNEL_PREEMPTIVE			1
+#ifndef SOS_KERNEL_MODE
+#define SOS_KERNEL_MODE					SOS_KERNEL_COOPERATIVE
+#endif
+
+#define SOS_TASK_STACK_SIZE				128		// bytes per task, preemptive kernel only
+
+/* dispatch latency clock, must match the TIMER_1 entry of timer_cfg.c (8 -> 1 count per us @ 8 MHz) */
+#define SOS_LATENCY_TIMER_PRESCALER		8
+
+/* no background slice is started closer than this to the next tick, longer than the longest slice */
+#define SOS_BG_MARGIN_US				2000
+
+/* SOS_OVERLOAD_DEGRADE, longest period is period << max shift, one shift step is undone after that many jobs in time */
+#define SOS_DEADLINE_MAX_DEGRADE_SHIFT	3
+#define SOS_DEADLINE_RECOVER_JOBS		8
+
+/* TRUE to check every run against the schedule conformance monitor (SERV/scm), test firmware */
+#ifndef SOS_CONFORMANCE_MONITOR
+#define SOS_CONFORMANCE_MONITOR			FALSE
+#endif
+
+//#define SOS_MAX_ID_NUMBER               255
+
 #endif /* SOS_PRECONFIG_H_ */
\ No newline at end of file
@@ -1,35 +1,162 @@
-/**
- * @fileName	:	sos_private.h
- * @Created		: 	2:08 AM Tuesday, May 30, 2023
- * @Author		: 	Hamsters
- * @brief		: 	Private file for Simple Operating System 
- */ 
-
-
-#ifndef SOS_PRIVATE_H_
-#define SOS_PRIVATE_H_
-#include "sos_interface.h"
-#include "sos_preconfig.h"
-#include "timer_interface.h"
-
-typedef enum
-{
-    SOS_SCHEDULER_UNINITIALIZED		= 0 ,
-    SOS_SCHEDULER_INITIALIZED		    ,
-    SOS_SCHEDULER_BLOCKED		        ,
-    SOS_SCHEDULER_READY
-}enu_sos_scheduler_state_t_;
-
-
-static enu_sos_status_t_	sos_find_task		(uint8_t_ uint8_task_id, str_sos_task_t_ ** ptr_ptr_str_sos_task, uint8_t_ * uint8_task_index_in_db);
-static void					sos_sort_database	(uint8_t_ uint8_task_db_index);
-static void					sos_system_scheduler(void);
-static void					sos_sys_tick_task	(void);
-static enu_sos_status_t_    sos_generate_task_id(uint8_t_ * uint8_new_task_id);
-
-/* Hyper-period Calculations */
-static uint32_t_			gcd						(uint32_t_ uint32_first_var, uint32_t_ uint32_second_variable);
-static uint32_t_			lcm						(uint32_t_ uint32_first_var, uint32_t_ uint32_second_variable);
-static void					calculate_hyper_period	(uint32_t_* ptr_uint32_hyper_period);
-
+/**
+ * @fileName	:	sos_private.h
+ * @Created		: 	2:08 AM Tuesday, May 30, 2023
+ * @Author		: 	Hamsters
+ * @brief		: 	Private file for Simple Operating System 
+ */ 
+
+
+#ifndef SOS_PRIVATE_H_
+#define SOS_PRIVATE_H_
+#include "sos_interface.h"
+#include "sos_preconfig.h"
+#include "timer_interface.h"
+#include "timer_cfg.h"
+#include "swt_interface.h"
+#include "dwq_interface.h"
+#include "critical.h"
+
+typedef enum
+{
+    SOS_SCHEDULER_UNINITIALIZED		= 0 ,
+    SOS_SCHEDULER_INITIALIZED		    ,
+    SOS_SCHEDULER_BLOCKED		        ,
+    SOS_SCHEDULER_READY
+}enu_sos_scheduler_state_t_;
+
+/* Task set of one operating mode, sorted by priority */
+typedef struct
+{
+    str_sos_task_t_*    arr_ptr_str_task[SOS_NUMBER_OF_TASKS];
+    uint8_t_            uint8_number_of_tasks_added;
+    uint32_t_           uint32_hyper_period;
+    /* equal priority tasks, offset in the group of the task served first, indexed by the group first index */
+    uint8_t_            arr_uint8_rr_first[SOS_NUMBER_OF_TASKS];
+}str_sos_task_db_t_;
+
+#define SOS_MODE_ID_NONE                0xFF
+
+/* Task chains, one bit per task ID */
+#if (SOS_NUMBER_OF_TASK_IDS > 16)
+#error "Task chain masks hold 16 task IDs at most"
+#endif
+#define SOS_TASK_ID_BIT(ID)             ((uint16_t_)1 << (ID))
+
+/* TRUE once the free running tick NOW reached TICK, wraparound safe */
+#define SOS_TICK_REACHED(NOW, TICK)     ((sint32_t_)((NOW) - (TICK)) >= 0)
+
+/* Wait state of a task on the sync objects */
+#define SOS_SYNC_RUNNABLE               0       /* scheduled by its release tick                */
+#define SOS_SYNC_BLOCKED                1       /* waiting on an object, skipped                */
+#define SOS_SYNC_WOKEN                  2       /* object given, runs on the next pass/tick     */
+
+#define SOS_SYNC_NO_CEILING             0xFF    /* lowest priority, task runs at its own one    */
+
+/* Deadline state of a task, indexed by task ID */
+typedef struct
+{
+    str_sos_deadline_stats_t_   str_stats;
+    uint8_t_                    uint8_skip_next;        /* SOS_OVERLOAD_SKIP_NEXT, drop the next job    */
+    uint8_t_                    uint8_job_missed;       /* running job already counted at dispatch      */
+    uint8_t_                    uint8_met_streak;       /* jobs in time since the last degrade step     */
+}str_sos_deadline_state_t_;
+
+#include "sos_port.h"
+
+/* Schedule conformance monitor hooks, compiled out unless enabled */
+#if (TRUE == SOS_CONFORMANCE_MONITOR)
+#include "scm_interface.h"
+#define SOS_SCM(CALL)                   CALL
+#else
+#define SOS_SCM(CALL)
+#endif
+
+/* Every scheduler state transition goes through here so it can be traced */
+#define SOS_SET_SCHEDULER_STATE(STATE)  do { gl_enu_sos_scheduler_state = (STATE); SOS_PORT_TRACE_STATE(STATE); } while(0)
+
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+
+typedef enum
+{
+    SOS_TCB_IDLE                    = 0 ,   /* no job pending                               */
+    SOS_TCB_RUNNING                     ,   /* job started, running or preempted            */
+}enu_sos_tcb_state_t_;
+
+/* Task control block, indexed by task ID */
+typedef struct
+{
+    str_sos_port_context_t_ str_context;
+    str_sos_task_t_ *       ptr_str_task;
+    enu_sos_tcb_state_t_    enu_state;
+    uint8_t_                uint8_pending;          /* released and not started yet                 */
+    uint8_t_                uint8_preempted_id;     /* task to resume when this job ends            */
+    uint32_t_               uint32_job_release_tick;/* tick that released the pending/running job   */
+}str_sos_tcb_t_;
+
+#define SOS_TASK_ID_IDLE                0xFF
+#endif
+
+
+static enu_sos_status_t_	sos_find_task		(str_sos_task_db_t_ * ptr_str_db, uint8_t_ uint8_task_id, str_sos_task_t_ ** ptr_ptr_str_sos_task, uint8_t_ * uint8_task_index_in_db);
+static void					sos_sort_database	(str_sos_task_db_t_ * ptr_str_db, uint8_t_ uint8_task_db_index);
+static void					sos_system_scheduler(void);
+static void                 sos_run_job         (str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_now);
+static void					sos_sys_tick_task	(void);
+static enu_sos_status_t_    sos_generate_task_id(str_sos_task_t_ * ptr_str_task, uint8_t_ * uint8_new_task_id);
+static void                 sos_apply_mode_switch(void);
+static void                 sos_handle_tick_boundary(void);
+static void                 sos_record_dispatch_latency(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_release);
+static void                 sos_phase_task      (str_sos_task_t_ * ptr_str_task);
+static void                 sos_advance_release (str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_now, uint16_t_ uint16_delay);
+
+/* Equal priority round-robin */
+static uint8_t_             sos_rr_group_end        (str_sos_task_db_t_ * ptr_str_db, uint8_t_ uint8_group_start);
+static void                 sos_rr_rotate           (str_sos_task_db_t_ * ptr_str_db, uint32_t_ uint32_now);
+
+/* Task chains */
+static uint8_t_             sos_task_registered     (uint8_t_ uint8_task_id);
+static uint8_t_             sos_chain_reaches       (uint8_t_ uint8_from_task_id, uint8_t_ uint8_to_task_id);
+static void                 sos_chain_remove_task   (uint8_t_ uint8_task_id);
+static void                 sos_chain_phase_task    (uint8_t_ uint8_task_id);
+static void                 sos_chain_complete      (str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_release);
+static void                 sos_chain_run_ready     (uint32_t_ uint32_now);
+
+/* Semaphores, mutexes and event groups */
+static enu_sos_status_t_    sos_sync_block          (uint16_t_ * ptr_uint16_waiters);
+static void                 sos_sync_wake           (uint8_t_ uint8_task_id);
+static uint8_t_             sos_sync_pick_waiter    (uint16_t_ * ptr_uint16_waiters);
+static void                 sos_mutex_take_ownership(str_sos_mutex_t_ * ptr_str_mutex, uint8_t_ uint8_task_id);
+static void                 sos_sync_forget_task    (uint8_t_ uint8_task_id);
+static uint8_t_             sos_task_due            (str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_now);
+static uint8_t_             sos_job_release         (str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_now, uint32_t_ * ptr_uint32_release);
+
+/* Deadlines */
+static uint8_t_             sos_deadline_dispatch   (str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_release, uint32_t_ uint32_now);
+static void                 sos_deadline_complete   (str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_release, uint32_t_ uint32_now);
+static void                 sos_deadline_miss       (str_sos_task_t_ * ptr_str_task);
+static void                 sos_deadline_forget_task(uint8_t_ uint8_task_id);
+
+#if (TRUE == SOS_CONFORMANCE_MONITOR)
+/* Schedule conformance monitor */
+static void                 sos_scm_track           (uint8_t_ uint8_task_id);
+#endif
+
+/* Background tasks */
+static uint8_t_              sos_run_background      (void);
+
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+/* Preemptive kernel */
+static void                 sos_kernel_reset        (void);
+static void                 sos_kernel_tick         (void);
+static void                 sos_kernel_release      (str_sos_task_t_ * ptr_str_task);
+static uint8_t_             sos_kernel_pick         (uint8_t_ uint8_running_task_id);
+static void                 sos_kernel_start_task   (uint8_t_ uint8_task_id, uint8_t_ uint8_preempted_id, str_sos_port_context_t_ * ptr_str_from);
+static void                 sos_kernel_task_entry   (void);
+#endif
+
+/* Hyper-period Calculations */
+static uint32_t_			gcd						(uint32_t_ uint32_first_var, uint32_t_ uint32_second_variable);
+static uint32_t_			lcm						(uint32_t_ uint32_first_var, uint32_t_ uint32_second_variable);
+static void					calculate_hyper_period	(str_sos_task_db_t_ * ptr_str_db);
+
 #endif /* SOS_PRIVATE_H_ */
\ No newline at end of file
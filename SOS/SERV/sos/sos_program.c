@@ -1,666 +1,3306 @@
-/**
- * @fileName	:	sos_program.c
- * @Created		: 	2:08 AM Tuesday, May 30, 2023
- * @Author		: 	Hamsters
- * @brief		: 	Program file for Simple Operating System
- */
-#include "sos_interface.h"
-#include "sos_private.h"
-static str_sos_task_t_*	gl_arr_ptr_str_task[SOS_NUMBER_OF_TASKS] = {NULL_PTR};
-uint32_t_ gl_uint32_tick_counter = 0; uint8_t_ gl_uint8_number_of_tasks_added = 0;
-enu_sos_scheduler_state_t_	gl_enu_sos_scheduler_state = SOS_SCHEDULER_UNINITIALIZED;
-/**
-*	@syntax				:	sos_init(void);
-*	@description		:	Initializes the sos module
-*	@Sync\Async      	:	Synchronous
-*  @Reentrancy      	:	Reentrant
-*  @Parameters (in) 	:	None
-*  @Parameters (out)	:	None
-*  @Return value		:	SOS_STATUS_SUCCESS in case timers doesn't return an error
-*							SOS_STATUS_INVALID_STATE in case timers return an error
-*/
-enu_sos_status_t_ sos_init(void)
-{
-    if (timer_init(  )==TIMER_NOK)
-    {
-		return SOS_STATUS_FAILED;
-    }
-    else
-    {
-		//SUCCESS
-    }
-
-    if (timer_set_time(TIMER_0, SOS_SYS_TICK_TIME_MS)==TIMER_NOK)
-    {
-        return SOS_STATUS_FAILED;
-    }
-    else
-    {
-		//SUCCESS
-    }
-
-    if (timer_enable_interrupt(TIMER_0)==TIMER_NOK)
-    {
-		return SOS_STATUS_FAILED;
-    }
-    else
-    {
-		//SUCCESS
-    }
-	
-    if (timer_set_callback(TIMER_0,sos_sys_tick_task)== TIMER_NOK)
-    {
-		return SOS_STATUS_FAILED;
-    }
-    else
-    {
-		//SUCCESS
-    }
-
-    gl_enu_sos_scheduler_state = SOS_SCHEDULER_INITIALIZED;
-
-    return SOS_STATUS_SUCCESS;
-}
-
-/**
- *
- *	@description		:	deinitializes the sos module
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	None
- *  @Parameters (out)	:	None
- *
- *
- */
-enu_sos_status_t_ sos_deinit(void)
-{
-    if (
-            (timer_pause(TIMER_0) == TIMER_NOK) ||
-            (timer_disable_interrupt(TIMER_0) == TIMER_NOK)
-        )
-    {
-        return SOS_STATUS_FAILED;
-    }
-
-    else if(0 != gl_uint8_number_of_tasks_added)
-    {
-        for (int i = 0; i < gl_uint8_number_of_tasks_added; ++i) {
-            gl_arr_ptr_str_task[i] = NULL_PTR;
-        }
-    }
-    gl_enu_sos_scheduler_state = SOS_SCHEDULER_UNINITIALIZED;
-
-    return SOS_STATUS_SUCCESS;
-
-}
-
-/**
- *	@author				                    :	Hossam Elwahsh - https://github.com/HossamElwahsh
- *
- *	@brief		                            :	Generates a new task ID, add the requested task parameters to the database
- *  @param[in,out]  ptr_str_task 	        :   Pointer to task structure
- *
- *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task created successfully
- *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
- *              SOS_STATUS_INVALID_ARGS     :   Failed,     Invalid Arguments Given
- *              SOS_STATUS_DATABASE_FULL    :   Failed,     Database is full
- */
-enu_sos_status_t_ sos_create_task(str_sos_task_t_* ptr_str_task)
-{//Line 264
-    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
-
-    // SOS System State Check
-    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
-    {
-        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
-    }
-        // Arguments check
-    else if(
-            NULL_PTR == ptr_str_task                    ||  // task ptr is null
-            ptr_str_task->uint16_task_periodicity == 0  ||  // task periodicity is 0 (infinite)
-            NULL_PTR == ptr_str_task->ptr_func_task         // task function ptr is null
-            )
-    {
-        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
-    }
-    else
-    {
-        /* Task Creation */
-        if(SOS_NUMBER_OF_TASKS == gl_uint8_number_of_tasks_added)
-        {
-            /* DB FULL */
-            enu_sos_status_retval = SOS_STATUS_DATABASE_FULL;
-        }
-        else
-        {
-            // generate a new task ID
-            uint8_t_ uint8_generated_task_id = 0;
-            enu_sos_status_retval = sos_generate_task_id(&uint8_generated_task_id);
-            if(enu_sos_status_retval == SOS_STATUS_SUCCESS)
-            {
-                // task ID generated successfully
-                // update task structure
-                ptr_str_task->uint8_task_id = uint8_generated_task_id;
-
-                // save task in DB
-                uint8_t_ uint8_new_task_db_index = gl_uint8_number_of_tasks_added;
-                gl_arr_ptr_str_task[uint8_new_task_db_index] = ptr_str_task;
-                gl_uint8_number_of_tasks_added++;
-                // sort DB tasks according to task priority
-                sos_sort_database(uint8_new_task_db_index);
-
-                enu_sos_status_retval = SOS_STATUS_SUCCESS;
-            }
-            else
-            {
-                /* Do Nothing */
-            }
-        }
-    }
-
-    return enu_sos_status_retval;
-}//Line 365
-
-/**
- *	@author				                    :	Hossam Elwahsh - https://github.com/HossamElwahsh
- *
- *	@brief		                            :	Deletes a task from DB
- *  @param[in,out]  uint8_task_id 	        :   Task ID to delete from DB
- *
- *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task deleted successfully
- *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
- *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in DB
- */
-enu_sos_status_t_ sos_delete_task(uint8_t_ uint8_task_id)
-{//Line 378
-
-    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
-
-    // SOS System State Check
-    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
-    {
-        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
-    }
-    else
-    {
-        // search for task ID in DB
-        str_sos_task_t_ *ptr_str_sos_task_to_delete = NULL;
-        uint8_t_ uint8_task_index_in_db = 0;
-        enu_sos_status_retval = sos_find_task(uint8_task_id, &ptr_str_sos_task_to_delete, &uint8_task_index_in_db);
-
-        if(
-                SOS_STATUS_SUCCESS == enu_sos_status_retval      &&
-                NULL_PTR != ptr_str_sos_task_to_delete
-        ) // task found
-        {
-            /* Task Found - Delete it */
-            //ptr_str_sos_task_to_delete = NULL_PTR;
-			gl_arr_ptr_str_task[uint8_task_index_in_db] = NULL_PTR;
-            sos_sort_database(uint8_task_index_in_db);
-            enu_sos_status_retval = SOS_STATUS_SUCCESS;
-        }
-        else
-        {
-            /* Task not found */
-            enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
-        }
-    }
-
-    return enu_sos_status_retval;
-}//Line 500
-
-/**
- *	@author				                    :	Hossam Elwahsh - https://github.com/HossamElwahsh
- *
- *	@brief		                            :	Modifies a task
- *  @param[in,out]  uint8_task_id 	        :   Task ID to delete from DB
- *
- *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task deleted successfully
- *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
- *              SOS_STATUS_INVALID_ARGS     :   Failed,     Invalid Arguments Given
- *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in DB
- */
-enu_sos_status_t_ sos_modify_task(uint8_t_ uint8_task_id)
-{
-    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
-
-    // SOS System State Check
-    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
-    {
-        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
-    }
-    else
-    {
-        // search for task ID in DB
-        str_sos_task_t_ * ptr_str_sos_task_to_modify = NULL;
-        uint8_t_ uint8_task_index_in_db = 0;
-        enu_sos_status_retval = sos_find_task(uint8_task_id, &ptr_str_sos_task_to_modify, &uint8_task_index_in_db);
-
-        if(SOS_STATUS_SUCCESS == enu_sos_status_retval) // task found
-        {
-            sos_sort_database(uint8_task_index_in_db); // sort modified task
-            enu_sos_status_retval = SOS_STATUS_SUCCESS;
-        }
-        else
-        {
-            /* Task not found */
-            enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
-        }
-    }
-
-    return enu_sos_status_retval;
-}
-
-/**
- *	@author				                    :	Hossam Elwahsh - https://github.com/HossamElwahsh
- *
- *	@brief		                            :	Finds a task in DB using it's ID
- *  @param[in]      uint8_task_id 	        :   Task ID to search for
- *  @param[out]     ptr_ptr_str_sos_task 	:   Pointer to pointer store found task address
- *  @param[out]     uint8_task_index_in_db 	:   (optional) Pointer to store found task index in DB
- *
- *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task found
- *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
- *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in DB
- */
-static enu_sos_status_t_	sos_find_task		(uint8_t_ uint8_task_id, str_sos_task_t_ ** ptr_ptr_str_sos_task, uint8_t_ * ptr_uint8_task_index_in_db)
-{
-    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
-
-    // SOS System State Check
-    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
-    {
-        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
-    }
-        // Arguments check
-    else if(NULL_PTR == ptr_ptr_str_sos_task)
-    {
-        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
-    }
-    else
-    {
-        /* search for task ID in DB */
-
-        uint8_t_ bool_found = FALSE;        // task found flag
-
-        for (uint8_t_ i = 0; i < gl_uint8_number_of_tasks_added; ++i) {
-            if(uint8_task_id == gl_arr_ptr_str_task[i]->uint8_task_id)
-            {
-                bool_found = TRUE;
-                *ptr_ptr_str_sos_task = gl_arr_ptr_str_task[i]; // save found task pointer
-                if(NULL_PTR != ptr_uint8_task_index_in_db)
-                {
-                    // store DB index
-                    *ptr_uint8_task_index_in_db = i;
-                }
-                else
-                {
-                    /* Do Nothing */
-                }
-                break;
-            }
-            else
-            {
-                /* Do Nothing */
-            }
-        }
-
-        if(TRUE == bool_found)
-        {
-            /* Task Found */
-            enu_sos_status_retval = SOS_STATUS_SUCCESS;
-        }
-        else
-        {
-            /* Task not found */
-            enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
-        }
-
-    }
-
-    return enu_sos_status_retval;
-}
-
-
-/**
- * @brief a private function to sort the task data base according to task
- *		  priority after each modification to the Data base 
- *
- * @param uint8_task_db_index : the index of the add/deleted/modified task
- *								in the task DB
- *
- * @return
- */
-static void	sos_sort_database (uint8_t_ uint8_task_db_index)
-{
-	str_sos_task_t_* lo_ptr_str_temp_task;
-
-	/* Check if a task was deleted */
-	if(NULL_PTR == gl_arr_ptr_str_task[uint8_task_db_index])
-	{
-		/* swap the deleted task with the last active task */
-		while(uint8_task_db_index < gl_uint8_number_of_tasks_added-1)
-		{
-			gl_arr_ptr_str_task[uint8_task_db_index] = gl_arr_ptr_str_task[uint8_task_db_index+1];
-			gl_arr_ptr_str_task[uint8_task_db_index+1] = NULL_PTR;
-			uint8_task_db_index++;
-		}
-	}
-	/* Check if a task was added (any new task is added after the last task in the array) */
-	else if(gl_uint8_number_of_tasks_added-1 == uint8_task_db_index)
-	{
-		/* return if in case this is the first task in the DB */
-		if (!uint8_task_db_index) return;
-		
-		/* loop on previous tasks to insert new task in the right index according to priority */
-		while(gl_arr_ptr_str_task[uint8_task_db_index]->uint8_task_priority 
-			< gl_arr_ptr_str_task[uint8_task_db_index-1]->uint8_task_priority)
-			{
-				/* Swap the tasks */
-				lo_ptr_str_temp_task = gl_arr_ptr_str_task[uint8_task_db_index];
-				gl_arr_ptr_str_task[uint8_task_db_index] = gl_arr_ptr_str_task[uint8_task_db_index-1];
-				gl_arr_ptr_str_task[uint8_task_db_index-1] = lo_ptr_str_temp_task;
-				uint8_task_db_index --;
-				
-				/* Break out of loop if we reach the first index in DB */
-				if(0 == uint8_task_db_index) break;
-			}
-	}
-	else /* A task was modified */
-	{
-		uint8_t_ lo_uint8_temp_index = uint8_task_db_index;
-		
-		/* Check that the modified task is not the first in the DB */
-		if(uint8_task_db_index)
-		{
-			/* 
-			Check whether the priority of the task of the given index is smaller than
-			that of the task at the previous index, if so, loop on the previous tasks
-			to insert the modified task at the right index according to task priority
-			*/
-			
-			while(gl_arr_ptr_str_task[lo_uint8_temp_index]->uint8_task_priority
-			< gl_arr_ptr_str_task[lo_uint8_temp_index-1]->uint8_task_priority)
-			{
-				/* Swap the tasks */
-				lo_ptr_str_temp_task = gl_arr_ptr_str_task[lo_uint8_temp_index];
-				gl_arr_ptr_str_task[lo_uint8_temp_index] = gl_arr_ptr_str_task[lo_uint8_temp_index-1];
-				gl_arr_ptr_str_task[lo_uint8_temp_index-1] = lo_ptr_str_temp_task;
-				lo_uint8_temp_index --;
-				if(0 == lo_uint8_temp_index) break;
-			}
-		}		
-		
-		/* 
-		Check whether the priority of the task of the given index is bigger than
-		that of the task at the next index, if so, loop on the previous tasks
-		to insert the modified task at the right index according to task priority
-		*/
-		while(gl_arr_ptr_str_task[uint8_task_db_index]->uint8_task_priority
-		> gl_arr_ptr_str_task[uint8_task_db_index+1]->uint8_task_priority)
-		{
-			/* Break out of loop if we reach the last task index */
-			if(uint8_task_db_index == gl_uint8_number_of_tasks_added-1) break;
-			
-			/* Swap the tasks */
-			lo_ptr_str_temp_task = gl_arr_ptr_str_task[uint8_task_db_index];
-			gl_arr_ptr_str_task[uint8_task_db_index] = gl_arr_ptr_str_task[uint8_task_db_index+1];
-			gl_arr_ptr_str_task[uint8_task_db_index+1] = lo_ptr_str_temp_task;
-			uint8_task_db_index ++;			
-		}
-	}
-}
-
-/**
- *	@syntax				:	sos_run(void);
- *	@description		:	Starts timer
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	None
- *  @Parameters (out)	:	None
- *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
- *							SOS_STATUS_INVALID_STATE in case timers return an error
- */
-void sos_run(void)
-{
-    if(
-            (gl_enu_sos_scheduler_state != SOS_SCHEDULER_INITIALIZED) ||
-            (TIMER_NOK == timer_resume(TIMER_0))
-    )
-    {
-        return;
-    }
-    else
-    {
-        gl_enu_sos_scheduler_state = SOS_SCHEDULER_BLOCKED;
-        while((gl_enu_sos_scheduler_state == SOS_SCHEDULER_BLOCKED)
-              || (gl_enu_sos_scheduler_state == SOS_SCHEDULER_READY))
-        {
-            if (SOS_SCHEDULER_READY == gl_enu_sos_scheduler_state)
-            {
-                sos_system_scheduler();
-            }
-        }
-    }
-
-
-}
-
-/**
- *	@syntax				:	sos_disable(void);
- *	@description		:	Stops the timer
- *	@Sync\Async      	:	Synchronous
- *  @Reentrancy      	:	Reentrant
- *  @Parameters (in) 	:	uint8_taskID
- *  @Parameters (out)	:	None
- *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
- *							SOS_STATUS_INVALID_STATE in case timers return an error
- */
-void sos_disable(void)
-{
-    if(
-            (gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED) ||
-            (TIMER_NOK == timer_pause(TIMER_0))
-    )
-    {
-        return;
-    }
-    else
-    {
-        /* Success */
-		gl_enu_sos_scheduler_state = SOS_SCHEDULER_INITIALIZED;
-    }
-
-}
-
-static void	sos_system_scheduler(void)
-{
-    uint32_t_ uint32_hyper_period = 0;
-    uint8_t_ uint8_looping_variable;
-
-    if (0 != gl_uint8_number_of_tasks_added)
-    {
-        calculate_hyper_period(&uint32_hyper_period);
-
-        for (uint8_looping_variable = 0; uint8_looping_variable < gl_uint8_number_of_tasks_added; uint8_looping_variable++)
-        {
-            if (0 == (gl_uint32_tick_counter % gl_arr_ptr_str_task[uint8_looping_variable]->uint16_task_periodicity))
-            {
-                if (NULL_PTR != gl_arr_ptr_str_task[uint8_looping_variable]->ptr_func_task)
-                {
-                    gl_arr_ptr_str_task[uint8_looping_variable]->ptr_func_task();
-                }
-                else
-                {
-                    /*FUNCTION DOES NOT EXIST*/
-                }
-            }
-            else
-            {
-                /*TASK IS NOT READY*/
-            }
-        }
-		
-		if(SOS_SCHEDULER_READY == gl_enu_sos_scheduler_state)
-		{
-			gl_enu_sos_scheduler_state = SOS_SCHEDULER_BLOCKED;
-		}
-
-        if (uint32_hyper_period == gl_uint32_tick_counter)
-        {
-            gl_uint32_tick_counter = 0;
-        }
-        else
-        {
-            /*SCHEDULER HAVEN'T REACH TO HYPER PERIOD YET*/
-        }
-    }
-    else
-    {
-        /*DATABASE IS EMPTY*/
-    }
-}
-
-static void	sos_sys_tick_task	(void)
-{
-    gl_uint32_tick_counter++;
-    gl_enu_sos_scheduler_state = SOS_SCHEDULER_READY;
-}
-
-
-/**
- * @author                              :   Hossam Elwahsh
- *
- * @brief                               :   Generates a new unique ID for SOS task
- *
- * @param[out]  uint8_new_task_id       :   Generated task ID
- *
- * @return  SOS_STATUS_SUCCESS          :   Success,    Task ID generated successfully
- *          SOS_STATUS_DATABASE_FULL    :   Failed,     DB full, all unique IDs are in-use
- *          SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
- */
-static enu_sos_status_t_    sos_generate_task_id(uint8_t_ * uint8_new_task_id)
-{
-    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
-
-    // SOS System State Check
-    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
-    {
-        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
-    }
-    else
-    {
-        /* generate a new task ID */
-
-        uint8_t_ uint8_generated = FALSE;       // generated flag
-
-        // IDs Maps
-        // 0(false): unused, 1(true): used
-        uint8_t_ uint8_ids_map[SOS_NUMBER_OF_TASKS] = {FALSE};
-
-        // Calculate ids map DB O(n)
-        for (uint8_t_ i = 0; i < gl_uint8_number_of_tasks_added; ++i) {
-            uint8_ids_map[gl_arr_ptr_str_task[i]->uint8_task_id] = TRUE;
-        }
-
-        // Get first unused ID, worst case: O(n)
-        for (uint8_t_ id = 0; id < SOS_NUMBER_OF_TASKS; ++id) {
-            if(FALSE == uint8_ids_map[id])
-            {
-                *uint8_new_task_id = id;
-                uint8_generated = TRUE;
-                break;
-            }
-        }
-
-        if(FALSE == uint8_generated) // all possible ID numbers are in use == database is full
-        {
-            // DB Full
-            enu_sos_status_retval = SOS_STATUS_DATABASE_FULL;
-        }
-        else
-        {
-            /* Do Nothing */
-        }
-    }
-
-    return enu_sos_status_retval;
-}
-
-
-static uint32_t_ gcd(uint32_t_ uint32_first_var, uint32_t_ uint32_second_variable)
-{
-    // Declare and initialize a uint32_t variable named uint32_gcd_value to 0.
-    uint32_t_ uint32_gcd_value = 0;
-    // Declare a uint32_t variable named uint32_temp.
-    uint32_t_ uint32_temp;
-
-    // Start a while loop that continues until uint32_second_variable is not equal to 0.
-    while (uint32_second_variable != 0)
-    {
-        // Store the value of uint32_second_variable in uint32_temp.
-        uint32_temp = uint32_second_variable;
-        // Calculate the remainder of uint32_first_var
-        //  divided by uint32_second_variable and assign it to uint32_second_variable.
-        uint32_second_variable = uint32_first_var % uint32_second_variable;
-        // Assign the value of uint32_temp to uint32_first_var.
-        uint32_first_var = uint32_temp;
-    }
-
-    // Assign the value of uint32_first_var to uint32_gcd_value.
-    uint32_gcd_value = uint32_first_var;
-
-    // Return the calculated gcd value.
-    return uint32_gcd_value;
-}
-
-
-static uint32_t_ lcm(uint32_t_ uint32_first_var, uint32_t_ uint32_second_variable)
-{
-    // Declare and initialize a uint32_t variable named uint32_lcm_return_value to 0.
-    uint32_t_ uint32_lcm_return_value = 0;
-
-    // Declare and initialize an uint32_t variable named uint32_gcd_value to 0.
-    uint32_t_ uint32_gcd_value = 0;
-
-    // Call the gcd (Greatest Common Divisor) function
-    //  with uint32_first_var and uint32_second_variable as arguments
-    //  and assign the returned value to uint32_gcd_value.
-    uint32_gcd_value = gcd(uint32_first_var, uint32_second_variable);
-
-    // Calculate the least common multiple (lcm)
-    // by multiplying uint32_first_var and uint32_second_variable
-    // and then dividing the result by uint32_gcd_value.
-    // Assign the calculated value to uint32_lcm_return_value.
-    uint32_lcm_return_value = (uint32_first_var * uint32_second_variable) / uint32_gcd_value;
-
-    // Return the calculated lcm value.
-    return uint32_lcm_return_value;
-}
-
-
-static void calculate_hyper_period(uint32_t_* ptr_uint32_hyper_period)
-{
-    // Declare and initialize an uint8_t variable named uint8_looping_variable to 0.
-    uint8_t_ uint8_looping_variable = 0;
-
-    // Assign the value of uint16_task_periodicity from the first element of the
-    // gl_arr_ptr_str_task array to the memory location pointed to by ptr_uint32_hyper_period.
-    *ptr_uint32_hyper_period = gl_arr_ptr_str_task[0]->uint16_task_periodicity;
-
-    // Start a for loop that iterates until uint8_looping_variable
-    // is less than gl_uint8_number_of_tasks_added,
-    // incrementing uint8_looping_variable after each iteration.
-    for (; uint8_looping_variable < gl_uint8_number_of_tasks_added; uint8_looping_variable++)
-    {
-        // Update the value of *ptr_uint32_hyper_period
-        // by finding the least common multiple (lcm)
-        // between the current value of *ptr_uint32_hyper_period
-        // and the uint16_task_periodicity of the task
-        // pointed to by the gl_arr_ptr_str_task[uint8_looping_variable].
-        // This basically calculates the hyper period of the first two tasks periodicity,
-        // then incrementally re-calculate the hyper period for the last result with the next task periodicity
-        // until all the tasks have been processed we get the final total least hyper-period for all tasks
-        *ptr_uint32_hyper_period = lcm(*ptr_uint32_hyper_period, gl_arr_ptr_str_task[uint8_looping_variable]->uint16_task_periodicity);
-    }
-}
+/**
+ * @fileName	:	sos_program.c
+ * @Created		: 	2:08 AM Tuesday, May 30, 2023
+ * @Author		: 	Hamsters
+ * @brief		: 	Program file for Simple Operating System
+ */
+#include "sos_interface.h"
+#include "sos_private.h"
+static INSTANCE str_sos_task_db_t_	gl_arr_str_task_db[SOS_NUMBER_OF_MODES];
+static INSTANCE str_sos_task_db_t_*	gl_ptr_str_active_db = NULL_PTR;		/* set by sos_init */
+static INSTANCE uint8_t_				gl_uint8_active_mode_id = SOS_DEFAULT_MODE_ID;
+static INSTANCE str_sos_task_t_*		gl_ptr_str_running_task = NULL_PTR;
+static INSTANCE volatile uint32_t_ gl_uint32_tick_counter = 0;	/* phase in the hyper-period */
+static INSTANCE volatile uint32_t_ gl_uint32_sys_ticks = 0;	/* free running, task release times */
+INSTANCE enu_sos_scheduler_state_t_	gl_enu_sos_scheduler_state = SOS_SCHEDULER_UNINITIALIZED;
+
+/* Pending mode switch, written from task/ISR context and consumed by the scheduler */
+static INSTANCE volatile uint8_t_				gl_uint8_pending_mode_id = SOS_MODE_ID_NONE;
+static INSTANCE volatile enu_sos_mode_switch_t_	gl_enu_pending_mode_switch_point = SOS_MODE_SWITCH_NEXT_TICK;
+static INSTANCE volatile uint32_t_				gl_uint32_mode_switch_wait_ticks = 0;
+static INSTANCE uint32_t_						gl_uint32_mode_switch_max_latency = 0;
+static INSTANCE uint32_t_						gl_uint32_dispatch_max_latency_us = 0;
+static INSTANCE volatile uint16_t_				gl_uint16_tick_stamp = 0;		/* TIMER_1 count at the last system tick */
+
+/* Task chains (precedence DAG), one bit per task ID */
+static INSTANCE uint16_t_				gl_arr_uint16_chain_successors[SOS_NUMBER_OF_TASK_IDS];
+static INSTANCE uint16_t_				gl_arr_uint16_chain_predecessors[SOS_NUMBER_OF_TASK_IDS];
+static INSTANCE uint16_t_				gl_arr_uint16_chain_arrived[SOS_NUMBER_OF_TASK_IDS];	/* predecessors done for the next run */
+static INSTANCE uint32_t_				gl_arr_uint32_chain_max_latency_us[SOS_NUMBER_OF_TASK_IDS];
+static INSTANCE uint32_t_				gl_arr_uint32_chain_release[SOS_NUMBER_OF_TASK_IDS];	/* release tick of the chain run that released the successor */
+static INSTANCE uint16_t_				gl_uint16_chain_ready = 0;								/* successors released by their predecessors, not started yet */
+
+/* Semaphores, mutexes and event groups, indexed by task ID */
+static INSTANCE volatile uint8_t_		gl_arr_uint8_sync_state[SOS_NUMBER_OF_TASK_IDS];		/* SOS_SYNC_RUNNABLE/BLOCKED/WOKEN, byte access only */
+static INSTANCE str_sos_task_t_ *		gl_arr_ptr_str_sync_task[SOS_NUMBER_OF_TASK_IDS];		/* task of each waiter, for its priority */
+static INSTANCE uint8_t_					gl_arr_uint8_sync_event_mask[SOS_NUMBER_OF_TASK_IDS];	/* flags an event waiter waits for */
+static INSTANCE uint8_t_					gl_arr_uint8_sync_ceiling[SOS_NUMBER_OF_TASK_IDS];		/* mutex ceiling in effect, SOS_SYNC_NO_CEILING */
+
+/* Deadlines */
+static INSTANCE str_sos_deadline_state_t_	gl_arr_str_deadline[SOS_NUMBER_OF_TASK_IDS];
+
+/* Background tasks, round-robin over a NULL terminated list */
+static INSTANCE str_sos_bg_task_t_ *		gl_ptr_str_bg_head = NULL_PTR;
+static INSTANCE str_sos_bg_task_t_ *		gl_ptr_str_bg_next = NULL_PTR;							/* next to get a slice */
+static INSTANCE str_sos_bg_stats_t_		gl_str_bg_stats;
+static INSTANCE uint32_t_				gl_uint32_bg_cutoff_tick = 0;
+
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+static INSTANCE str_sos_tcb_t_			gl_arr_str_tcb[SOS_NUMBER_OF_TASK_IDS];
+static INSTANCE uint8_t_					gl_arr_uint8_task_stack[SOS_NUMBER_OF_TASK_IDS][SOS_PORT_STACK_SIZE(SOS_TASK_STACK_SIZE)];
+static INSTANCE str_sos_port_context_t_	gl_str_idle_context;		/* sos_run loop, preempted by the first task */
+static INSTANCE str_sos_port_context_t_	gl_str_exit_context;		/* dump for the context of a finished job */
+static INSTANCE volatile uint8_t_		gl_uint8_current_task_id = SOS_TASK_ID_IDLE;
+#endif
+/**
+*	@syntax				:	sos_init(void);
+*	@description		:	Initializes the sos module
+*	@Sync\Async      	:	Synchronous
+*  @Reentrancy      	:	Reentrant
+*  @Parameters (in) 	:	None
+*  @Parameters (out)	:	None
+*  @Return value		:	SOS_STATUS_SUCCESS in case timers doesn't return an error
+*							SOS_STATUS_INVALID_STATE in case timers return an error
+*/
+enu_sos_status_t_ sos_init(void)
+{
+    if (timer_init(  )==TIMER_NOK)
+    {
+		return SOS_STATUS_FAILED;
+    }
+    else
+    {
+		//SUCCESS
+    }
+
+    if (timer_set_time(TIMER_0, SOS_SYS_TICK_TIME_MS)==TIMER_NOK)
+    {
+        return SOS_STATUS_FAILED;
+    }
+    else
+    {
+		//SUCCESS
+    }
+
+    if (timer_enable_interrupt(TIMER_0)==TIMER_NOK)
+    {
+		return SOS_STATUS_FAILED;
+    }
+    else
+    {
+		//SUCCESS
+    }
+	
+    if (timer_set_callback(TIMER_0,sos_sys_tick_task)== TIMER_NOK)
+    {
+		return SOS_STATUS_FAILED;
+    }
+    else
+    {
+		//SUCCESS
+    }
+
+    gl_ptr_str_active_db                = &gl_arr_str_task_db[SOS_DEFAULT_MODE_ID];
+    gl_uint8_active_mode_id             = SOS_DEFAULT_MODE_ID;
+    gl_uint8_pending_mode_id            = SOS_MODE_ID_NONE;
+    gl_uint32_mode_switch_wait_ticks    = 0;
+    gl_uint32_mode_switch_max_latency   = 0;
+    gl_uint32_tick_counter              = 0;    /* new task set, new hyper-period phase */
+    gl_uint32_dispatch_max_latency_us   = 0;
+    gl_ptr_str_bg_head                  = NULL_PTR;
+    gl_ptr_str_bg_next                  = NULL_PTR;
+    gl_str_bg_stats.uint32_slices       = 0;
+    gl_str_bg_stats.uint32_busy_us      = 0;
+    gl_str_bg_stats.uint32_cutoffs      = 0;
+    gl_str_bg_stats.uint16_max_slice_us = 0;
+    gl_uint32_bg_cutoff_tick            = sos_get_ticks() - 1;
+    critical_reset_stats();
+
+    for (uint8_t_ uint8_task_id = 0; uint8_task_id < SOS_NUMBER_OF_TASK_IDS; ++uint8_task_id)
+    {
+        sos_sync_forget_task(uint8_task_id);
+        sos_deadline_forget_task(uint8_task_id);
+    }
+
+    swt_init();
+    dwq_init();
+    SOS_SCM(scm_init());
+
+    SOS_SET_SCHEDULER_STATE(SOS_SCHEDULER_INITIALIZED);
+
+    return SOS_STATUS_SUCCESS;
+}
+
+/**
+ *
+ *	@description		:	deinitializes the sos module
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	None
+ *  @Parameters (out)	:	None
+ *
+ *
+ */
+enu_sos_status_t_ sos_deinit(void)
+{
+    if (
+            (timer_pause(TIMER_0) == TIMER_NOK) ||
+            (timer_disable_interrupt(TIMER_0) == TIMER_NOK)
+        )
+    {
+        return SOS_STATUS_FAILED;
+    }
+
+    else
+    {
+        for (uint8_t_ uint8_mode_id = 0; uint8_mode_id < SOS_NUMBER_OF_MODES; ++uint8_mode_id) {
+            for (uint8_t_ i = 0; i < gl_arr_str_task_db[uint8_mode_id].uint8_number_of_tasks_added; ++i) {
+                gl_arr_str_task_db[uint8_mode_id].arr_ptr_str_task[i] = NULL_PTR;
+            }
+            gl_arr_str_task_db[uint8_mode_id].uint8_number_of_tasks_added   = 0;
+            gl_arr_str_task_db[uint8_mode_id].uint32_hyper_period           = 0;
+        }
+        for (uint8_t_ uint8_task_id = 0; uint8_task_id < SOS_NUMBER_OF_TASK_IDS; ++uint8_task_id) {
+            sos_chain_remove_task(uint8_task_id);
+            sos_sync_forget_task(uint8_task_id);
+        }
+        gl_uint8_pending_mode_id = SOS_MODE_ID_NONE;
+        SOS_SCM(scm_forget_all());
+    }
+    SOS_SET_SCHEDULER_STATE(SOS_SCHEDULER_UNINITIALIZED);
+
+    return SOS_STATUS_SUCCESS;
+
+}
+
+/**
+ *	@author				                    :	Hossam Elwahsh - https://github.com/HossamElwahsh
+ *
+ *	@brief		                            :	Generates a new task ID, add the requested task parameters to the database
+ *	                                            of the active mode
+ *  @param[in,out]  ptr_str_task 	        :   Pointer to task structure
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task created successfully
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Invalid Arguments Given
+ *              SOS_STATUS_DATABASE_FULL    :   Failed,     Database is full
+ */
+enu_sos_status_t_ sos_create_task(str_sos_task_t_* ptr_str_task)
+{
+    return sos_mode_create_task(gl_uint8_active_mode_id, ptr_str_task);
+}
+
+/**
+ *	@brief		                            :	Adds a task to the task set of a given operating mode, the mode task set
+ *	                                            is kept sorted by priority so switching to it later costs no sorting
+ *  @param[in]      uint8_mode_id 	        :   Mode to add the task to (0 -> SOS_NUMBER_OF_MODES - 1)
+ *  @param[in,out]  ptr_str_task 	        :   Pointer to task structure, a task shared by several modes keeps one ID
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task added successfully
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_MODE_ID  :   Failed,     Mode ID out of range
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Invalid Arguments Given or task already in this mode
+ *              SOS_STATUS_DATABASE_FULL    :   Failed,     Mode task set is full
+ */
+enu_sos_status_t_ sos_mode_create_task(uint8_t_ uint8_mode_id, str_sos_task_t_* ptr_str_task)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_sos_task_db_t_ * ptr_str_db = NULL_PTR;
+    str_critical_t_ lo_str_critical;
+
+    // SOS System State Check
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else if(SOS_NUMBER_OF_MODES <= uint8_mode_id)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_MODE_ID;
+    }
+        // Arguments check
+    else if(
+            NULL_PTR == ptr_str_task                    ||  // task ptr is null
+            ptr_str_task->uint16_task_periodicity == 0  ||  // task periodicity is 0 (infinite)
+            NULL_PTR == ptr_str_task->ptr_func_task     ||  // task function ptr is null
+            SOS_OVERLOAD_TOTAL <= ptr_str_task->enu_overload_action ||
+            (
+                    SOS_OVERLOAD_HANDLER == ptr_str_task->enu_overload_action &&
+                    NULL_PTR == ptr_str_task->ptr_func_overload         // handler action without a handler
+            )
+            )
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        ptr_str_db = &gl_arr_str_task_db[uint8_mode_id];
+
+        /* Task Creation */
+        if(SOS_NUMBER_OF_TASKS == ptr_str_db->uint8_number_of_tasks_added)
+        {
+            /* DB FULL */
+            enu_sos_status_retval = SOS_STATUS_DATABASE_FULL;
+        }
+        else
+        {
+            // generate a new task ID (or reuse the ID of a task shared with another mode)
+            uint8_t_ uint8_generated_task_id = 0;
+            enu_sos_status_retval = sos_generate_task_id(ptr_str_task, &uint8_generated_task_id);
+
+            // reject adding the same task twice to one mode
+            for (uint8_t_ i = 0; i < ptr_str_db->uint8_number_of_tasks_added; ++i) {
+                if(ptr_str_task == ptr_str_db->arr_ptr_str_task[i])
+                {
+                    enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+                    break;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+
+            if(enu_sos_status_retval == SOS_STATUS_SUCCESS)
+            {
+                // task ID generated successfully
+                // update task structure
+                // the preemptive tick ISR walks the active DB, the phase needs both tick counters
+                enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+                if(FALSE == sos_task_registered(uint8_generated_task_id))
+                {
+                    ptr_str_task->uint8_task_id = uint8_generated_task_id;
+                    ptr_str_task->uint16_task_resume_point  = 0;
+                    sos_phase_task(ptr_str_task);
+                }
+                else
+                {
+                    /* already in another mode, its job and release tick go on unchanged */
+                }
+
+                // save task in DB
+                uint8_t_ uint8_new_task_db_index = ptr_str_db->uint8_number_of_tasks_added;
+                ptr_str_db->arr_ptr_str_task[uint8_new_task_db_index] = ptr_str_task;
+                ptr_str_db->uint8_number_of_tasks_added++;
+                // sort DB tasks according to task priority
+                sos_sort_database(ptr_str_db, uint8_new_task_db_index);
+                calculate_hyper_period(ptr_str_db);
+                SOS_SCM(sos_scm_track(uint8_generated_task_id));
+                exit_critical(&lo_str_critical);
+
+                enu_sos_status_retval = SOS_STATUS_SUCCESS;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@author				                    :	Hossam Elwahsh - https://github.com/HossamElwahsh
+ *
+ *	@brief		                            :	Deletes a task from the DB of the active mode
+ *  @param[in,out]  uint8_task_id 	        :   Task ID to delete from DB
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task deleted successfully
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in DB
+ */
+enu_sos_status_t_ sos_delete_task(uint8_t_ uint8_task_id)
+{
+    return sos_mode_delete_task(gl_uint8_active_mode_id, uint8_task_id);
+}
+
+/**
+ *	@brief		                            :	Removes a task from the task set of a given operating mode
+ *  @param[in]      uint8_mode_id 	        :   Mode to remove the task from
+ *  @param[in]      uint8_task_id 	        :   Task ID to remove
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task removed successfully
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_MODE_ID  :   Failed,     Mode ID out of range
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in mode task set
+ */
+enu_sos_status_t_ sos_mode_delete_task(uint8_t_ uint8_mode_id, uint8_t_ uint8_task_id)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    // SOS System State Check
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else if(SOS_NUMBER_OF_MODES <= uint8_mode_id)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_MODE_ID;
+    }
+    else
+    {
+        // search for task ID in DB
+        str_sos_task_db_t_ * ptr_str_db = &gl_arr_str_task_db[uint8_mode_id];
+        str_sos_task_t_ *ptr_str_sos_task_to_delete = NULL;
+        uint8_t_ uint8_task_index_in_db = 0;
+
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        enu_sos_status_retval = sos_find_task(ptr_str_db, uint8_task_id, &ptr_str_sos_task_to_delete, &uint8_task_index_in_db);
+
+        if(
+                SOS_STATUS_SUCCESS == enu_sos_status_retval      &&
+                NULL_PTR != ptr_str_sos_task_to_delete
+        ) // task found
+        {
+            /* Task Found - Delete it */
+            ptr_str_db->arr_ptr_str_task[uint8_task_index_in_db] = NULL_PTR;
+            sos_sort_database(ptr_str_db, uint8_task_index_in_db);
+            ptr_str_db->uint8_number_of_tasks_added--;
+            calculate_hyper_period(ptr_str_db);
+            SOS_SCM(sos_scm_track(uint8_task_id));
+
+            // ID is free again once the task left every mode, drop its chain links and wait state
+            if(FALSE == sos_task_registered(uint8_task_id))
+            {
+                sos_chain_remove_task(uint8_task_id);
+                sos_sync_forget_task(uint8_task_id);
+                sos_deadline_forget_task(uint8_task_id);
+            }
+            else
+            {
+                /* Still used by another mode */
+            }
+            enu_sos_status_retval = SOS_STATUS_SUCCESS;
+        }
+        else
+        {
+            /* Task not found */
+            enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@author				                    :	Hossam Elwahsh - https://github.com/HossamElwahsh
+ *
+ *	@brief		                            :	Modifies a task, the task is re-sorted in every mode it belongs to
+ *  @param[in,out]  uint8_task_id 	        :   Task ID to delete from DB
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task deleted successfully
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Invalid Arguments Given
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in DB
+ */
+enu_sos_status_t_ sos_modify_task(uint8_t_ uint8_task_id)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    // SOS System State Check
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else
+    {
+        uint8_t_ bool_found = FALSE;        // task found in at least one mode
+
+        for (uint8_t_ uint8_mode_id = 0; uint8_mode_id < SOS_NUMBER_OF_MODES; ++uint8_mode_id)
+        {
+            // search for task ID in mode DB
+            str_sos_task_db_t_ * ptr_str_db = &gl_arr_str_task_db[uint8_mode_id];
+            str_sos_task_t_ * ptr_str_sos_task_to_modify = NULL;
+            uint8_t_ uint8_task_index_in_db = 0;
+
+            enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+            if(SOS_STATUS_SUCCESS == sos_find_task(ptr_str_db, uint8_task_id, &ptr_str_sos_task_to_modify, &uint8_task_index_in_db)) // task found
+            {
+                sos_phase_task(ptr_str_sos_task_to_modify);            // periodicity may have changed
+                sos_sort_database(ptr_str_db, uint8_task_index_in_db); // sort modified task
+                calculate_hyper_period(ptr_str_db);
+                SOS_SCM(sos_scm_track(uint8_task_id));
+                bool_found = TRUE;
+            }
+            else
+            {
+                /* Task not in this mode */
+            }
+            exit_critical(&lo_str_critical);
+        }
+
+        if(TRUE == bool_found)
+        {
+            enu_sos_status_retval = SOS_STATUS_SUCCESS;
+        }
+        else
+        {
+            /* Task not found */
+            enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
+        }
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Requests switching the running task set to another prebuilt mode,
+ *	                                            the switch is a single pointer swap applied by the scheduler at the
+ *	                                            requested boundary, a newer request replaces a pending one.
+ *	                                            Can be called from task or interrupt context
+ *  @param[in]      uint8_mode_id 	        :   Mode to switch to
+ *  @param[in]      enu_switch_point 	    :   SOS_MODE_SWITCH_NEXT_TICK or SOS_MODE_SWITCH_HYPER_PERIOD
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Switch applied (SOS not running) or scheduled
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_MODE_ID  :   Failed,     Mode ID out of range
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Invalid switch point
+ */
+enu_sos_status_t_ sos_switch_mode(uint8_t_ uint8_mode_id, enu_sos_mode_switch_t_ enu_switch_point)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    // SOS System State Check
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else if(SOS_NUMBER_OF_MODES <= uint8_mode_id)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_MODE_ID;
+    }
+    else if(SOS_MODE_SWITCH_TOTAL <= enu_switch_point)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        /* switch point is written first, the mode ID (single byte) publishes the request */
+        gl_enu_pending_mode_switch_point    = enu_switch_point;
+        gl_uint32_mode_switch_wait_ticks    = 0;
+        gl_uint8_pending_mode_id            = uint8_mode_id;
+
+        if(SOS_SCHEDULER_INITIALIZED == gl_enu_sos_scheduler_state)
+        {
+            /* SOS is not running, no boundary to wait for */
+            gl_uint32_tick_counter = 0;
+            sos_apply_mode_switch();
+        }
+        else
+        {
+            /* Applied by the scheduler at the requested boundary */
+        }
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the currently running mode
+ *  @param[out]     ptr_uint8_mode_id 	    :   Pointer to store the active mode ID
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_mode(uint8_t_* ptr_uint8_mode_id)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    if(NULL_PTR == ptr_uint8_mode_id)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        *ptr_uint8_mode_id = gl_uint8_active_mode_id;
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets a copy of the task set of an operating mode in priority order,
+ *	                                            slots past the task count are NULL_PTR. Task context
+ *  @param[in]      uint8_mode_id 	        :   Mode to read (0 -> SOS_NUMBER_OF_MODES - 1)
+ *  @param[out]     arr_ptr_str_tasks 	    :   Array of SOS_NUMBER_OF_TASKS task pointers to fill
+ *  @param[out]     ptr_uint8_count 	    :   Pointer to store the number of tasks in the mode
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_MODE_ID  :   Failed,     Mode ID out of range
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_mode_tasks(uint8_t_ uint8_mode_id, str_sos_task_t_ ** arr_ptr_str_tasks, uint8_t_ * ptr_uint8_count)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_sos_task_db_t_ * ptr_str_db = NULL_PTR;
+    str_critical_t_ lo_str_critical;
+
+    // SOS System State Check
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else if(SOS_NUMBER_OF_MODES <= uint8_mode_id)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_MODE_ID;
+    }
+    else if(
+            NULL_PTR == arr_ptr_str_tasks   ||
+            NULL_PTR == ptr_uint8_count
+            )
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        ptr_str_db = &gl_arr_str_task_db[uint8_mode_id];
+
+        // copy the task set and its count in one piece
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        for (uint8_t_ i = 0; i < SOS_NUMBER_OF_TASKS; ++i)
+        {
+            arr_ptr_str_tasks[i] = ptr_str_db->arr_ptr_str_task[i];
+        }
+        *ptr_uint8_count = ptr_str_db->uint8_number_of_tasks_added;
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the worst case mode switch latency measured since sos_init,
+ *	                                            counted in system ticks from the sos_switch_mode call until the
+ *	                                            new task set is in place
+ *  @param[out]     ptr_uint32_max_latency  :   Pointer to store the latency in ticks
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_mode_switch_latency(uint32_t_* ptr_uint32_max_latency)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    if(NULL_PTR == ptr_uint32_max_latency)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        *ptr_uint32_max_latency = gl_uint32_mode_switch_max_latency;
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the worst case dispatch latency of the highest priority task
+ *	                                            measured since sos_init, from the system tick that released it
+ *	                                            until its first instruction, in both kernel modes
+ *  @param[out]     ptr_uint32_max_latency_us:  Pointer to store the latency in microseconds
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_dispatch_latency(uint32_t_* ptr_uint32_max_latency_us)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    if(NULL_PTR == ptr_uint32_max_latency_us)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        *ptr_uint32_max_latency_us = gl_uint32_dispatch_max_latency_us;
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Chains two tasks, the successor is no longer released by its own
+ *	                                            period, it runs in the same scheduler pass right after all of its
+ *	                                            predecessors finished (run to completion pipeline), a delay
+ *	                                            returned by a chained successor holds its next run back
+ *  @param[in]      uint8_predecessor_id    :   Task that releases the successor
+ *  @param[in]      uint8_successor_id      :   Task released when its predecessors finish
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Tasks chained
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in any mode
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Task chained to itself
+ *              SOS_STATUS_CHAIN_CYCLE      :   Failed,     The link would close a cycle, chains must be a DAG
+ */
+enu_sos_status_t_ sos_chain_tasks(uint8_t_ uint8_predecessor_id, uint8_t_ uint8_successor_id)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else if(
+            (FALSE == sos_task_registered(uint8_predecessor_id)) ||
+            (FALSE == sos_task_registered(uint8_successor_id))
+            )
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
+    }
+    else if(uint8_predecessor_id == uint8_successor_id)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else if(TRUE == sos_chain_reaches(uint8_successor_id, uint8_predecessor_id))
+    {
+        /* successor already leads back to the predecessor */
+        enu_sos_status_retval = SOS_STATUS_CHAIN_CYCLE;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        gl_arr_uint16_chain_successors[uint8_predecessor_id]    |= SOS_TASK_ID_BIT(uint8_successor_id);
+        gl_arr_uint16_chain_predecessors[uint8_successor_id]    |= SOS_TASK_ID_BIT(uint8_predecessor_id);
+        gl_arr_uint16_chain_arrived[uint8_successor_id]         = 0;
+        sos_chain_phase_task(uint8_successor_id);
+        SOS_SCM(sos_scm_track(uint8_successor_id));
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Removes a link added by sos_chain_tasks, a successor left without
+ *	                                            predecessors is released by its own period again
+ *  @param[in]      uint8_predecessor_id    :   Predecessor task ID
+ *  @param[in]      uint8_successor_id      :   Successor task ID
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Link removed
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Tasks are not chained
+ */
+enu_sos_status_t_ sos_unchain_tasks(uint8_t_ uint8_predecessor_id, uint8_t_ uint8_successor_id)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else if(
+            (SOS_NUMBER_OF_TASK_IDS <= uint8_predecessor_id) ||
+            (SOS_NUMBER_OF_TASK_IDS <= uint8_successor_id) ||
+            (0 == (gl_arr_uint16_chain_successors[uint8_predecessor_id] & SOS_TASK_ID_BIT(uint8_successor_id)))
+            )
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        gl_arr_uint16_chain_successors[uint8_predecessor_id]    &= ~SOS_TASK_ID_BIT(uint8_successor_id);
+        gl_arr_uint16_chain_predecessors[uint8_successor_id]    &= ~SOS_TASK_ID_BIT(uint8_predecessor_id);
+        gl_arr_uint16_chain_arrived[uint8_successor_id]         &= ~SOS_TASK_ID_BIT(uint8_predecessor_id);
+
+        if(0 == gl_arr_uint16_chain_predecessors[uint8_successor_id])
+        {
+            /* back to periodic releases */
+            gl_uint16_chain_ready &= ~SOS_TASK_ID_BIT(uint8_successor_id);
+            sos_chain_phase_task(uint8_successor_id);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        SOS_SCM(sos_scm_track(uint8_successor_id));
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the worst case end to end latency of a chain, from the system
+ *	                                            tick that released the chain until the given successor finished
+ *  @param[in]      uint8_task_id           :   Chained task ID (usually the last task of the pipeline)
+ *  @param[out]     ptr_uint32_max_latency_us:  Pointer to store the latency in microseconds
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID out of range
+ */
+enu_sos_status_t_ sos_get_chain_latency(uint8_t_ uint8_task_id, uint32_t_* ptr_uint32_max_latency_us)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    if(NULL_PTR == ptr_uint32_max_latency_us)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else if(SOS_NUMBER_OF_TASK_IDS <= uint8_task_id)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
+    }
+    else
+    {
+        *ptr_uint32_max_latency_us = gl_arr_uint32_chain_max_latency_us[uint8_task_id];
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Initializes a counting semaphore
+ *  @param[out]     ptr_str_sem             :   Semaphore to initialize
+ *  @param[in]      uint8_initial_count     :   Units available at start
+ *  @param[in]      uint8_max_count         :   Units limit (1 for a binary semaphore)
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given, zero limit or initial count above it
+ */
+enu_sos_status_t_ sos_sem_init(str_sos_sem_t_ * ptr_str_sem, uint8_t_ uint8_initial_count, uint8_t_ uint8_max_count)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    if(
+            (NULL_PTR == ptr_str_sem)   ||
+            (0 == uint8_max_count)      ||
+            (uint8_initial_count > uint8_max_count)
+            )
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        ptr_str_sem->uint16_waiters     = 0;
+        ptr_str_sem->uint16_granted     = 0;
+        ptr_str_sem->uint8_count        = uint8_initial_count;
+        ptr_str_sem->uint8_max_count    = uint8_max_count;
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Takes one unit of a semaphore, when none is available the running
+ *	                                            task waits for it (not run again until a give hands it a unit)
+ *  @param[in,out]  ptr_str_sem             :   Semaphore to take
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Unit taken
+ *              SOS_STATUS_WOULD_BLOCK      :   Failed,     Task registered as a waiter, return from the task
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     No unit and not called from a task
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_sem_take(str_sos_sem_t_ * ptr_str_sem)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_sos_task_t_ * ptr_str_task = gl_ptr_str_running_task;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_sem)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_SYNC);
+        if(
+                (NULL_PTR != ptr_str_task) &&
+                (0 != (ptr_str_sem->uint16_granted & SOS_TASK_ID_BIT(ptr_str_task->uint8_task_id)))
+                )
+        {
+            /* unit handed over by a give while waiting */
+            ptr_str_sem->uint16_granted &= ~SOS_TASK_ID_BIT(ptr_str_task->uint8_task_id);
+        }
+        else if(0 != ptr_str_sem->uint8_count)
+        {
+            ptr_str_sem->uint8_count--;
+        }
+        else
+        {
+            enu_sos_status_retval = sos_sync_block(&ptr_str_sem->uint16_waiters);
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gives one unit back, handed to the highest priority waiter if any
+ *  @param[in,out]  ptr_str_sem             :   Semaphore to give
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     Count already at its limit
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_sem_give(str_sos_sem_t_ * ptr_str_sem)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    uint8_t_ uint8_waiter_id;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_sem)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_SYNC);
+        uint8_waiter_id = sos_sync_pick_waiter(&ptr_str_sem->uint16_waiters);
+        if(SOS_SYNC_NO_OWNER != uint8_waiter_id)
+        {
+            /* hand the unit over, no other task can take it meanwhile */
+            ptr_str_sem->uint16_granted |= SOS_TASK_ID_BIT(uint8_waiter_id);
+            sos_sync_wake(uint8_waiter_id);
+        }
+        else if(ptr_str_sem->uint8_count < ptr_str_sem->uint8_max_count)
+        {
+            ptr_str_sem->uint8_count++;
+        }
+        else
+        {
+            enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Same as sos_sem_give, kept for ISR code (the section saves SREG so
+ *	                                            interrupts stay disabled)
+ */
+enu_sos_status_t_ sos_sem_give_from_isr(str_sos_sem_t_ * ptr_str_sem)
+{
+    return sos_sem_give(ptr_str_sem);
+}
+
+/**
+ *	@brief		                            :	Initializes a mutex with the immediate priority ceiling protocol,
+ *	                                            the owner runs at the ceiling priority so a task that may lock
+ *	                                            the mutex never preempts it (no unbounded priority inversion)
+ *  @param[out]     ptr_str_mutex           :   Mutex to initialize
+ *  @param[in]      uint8_ceiling           :   Priority of the highest priority task that locks it
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_mutex_init(str_sos_mutex_t_ * ptr_str_mutex, uint8_t_ uint8_ceiling)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    if(NULL_PTR == ptr_str_mutex)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        ptr_str_mutex->uint16_waiters       = 0;
+        ptr_str_mutex->uint8_owner_id       = SOS_SYNC_NO_OWNER;
+        ptr_str_mutex->uint8_owner_ceiling  = SOS_SYNC_NO_CEILING;
+        ptr_str_mutex->uint8_ceiling        = uint8_ceiling;
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Locks a mutex for the running task, not recursive, nested mutexes
+ *	                                            are unlocked in reverse order
+ *  @param[in,out]  ptr_str_mutex           :   Mutex to lock
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Running task owns the mutex
+ *              SOS_STATUS_WOULD_BLOCK      :   Failed,     Task registered as a waiter, return from the task
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     Not called from a task
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_mutex_lock(str_sos_mutex_t_ * ptr_str_mutex)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_sos_task_t_ * ptr_str_task = gl_ptr_str_running_task;
+    uint8_t_ uint8_task_id;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_mutex)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else if(NULL_PTR == ptr_str_task)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else
+    {
+        uint8_task_id = ptr_str_task->uint8_task_id;
+
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_SYNC);
+        if(uint8_task_id == ptr_str_mutex->uint8_owner_id)
+        {
+            /* ownership handed over by an unlock while waiting */
+        }
+        else if(SOS_SYNC_NO_OWNER == ptr_str_mutex->uint8_owner_id)
+        {
+            sos_mutex_take_ownership(ptr_str_mutex, uint8_task_id);
+        }
+        else
+        {
+            enu_sos_status_retval = sos_sync_block(&ptr_str_mutex->uint16_waiters);
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Unlocks a mutex, ownership goes to the highest priority waiter if any
+ *  @param[in,out]  ptr_str_mutex           :   Mutex to unlock
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_NOT_OWNER        :   Failed,     Running task does not own the mutex
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_mutex_unlock(str_sos_mutex_t_ * ptr_str_mutex)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_sos_task_t_ * ptr_str_task = gl_ptr_str_running_task;
+    uint8_t_ uint8_waiter_id;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_mutex)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else if(
+            (NULL_PTR == ptr_str_task) ||
+            (ptr_str_task->uint8_task_id != ptr_str_mutex->uint8_owner_id)
+            )
+    {
+        enu_sos_status_retval = SOS_STATUS_NOT_OWNER;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_SYNC);
+        gl_arr_uint8_sync_ceiling[ptr_str_mutex->uint8_owner_id] = ptr_str_mutex->uint8_owner_ceiling;
+
+        uint8_waiter_id = sos_sync_pick_waiter(&ptr_str_mutex->uint16_waiters);
+        if(SOS_SYNC_NO_OWNER != uint8_waiter_id)
+        {
+            sos_mutex_take_ownership(ptr_str_mutex, uint8_waiter_id);
+            sos_sync_wake(uint8_waiter_id);
+        }
+        else
+        {
+            ptr_str_mutex->uint8_owner_id = SOS_SYNC_NO_OWNER;
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Initializes an event flag group, all flags cleared
+ *  @param[out]     ptr_str_event           :   Event group to initialize
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_event_init(str_sos_event_t_ * ptr_str_event)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    if(NULL_PTR == ptr_str_event)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        ptr_str_event->uint16_waiters   = 0;
+        ptr_str_event->uint8_flags      = 0;
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Waits for any of the given flags, the running task is not run again
+ *	                                            until one of them is set
+ *  @param[in,out]  ptr_str_event           :   Event group
+ *  @param[in]      uint8_mask              :   Flags to wait for
+ *  @param[in]      bool_clear              :   TRUE to clear the matched flags
+ *  @param[out]     ptr_uint8_flags         :   Matched flags (may be NULL_PTR)
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    At least one flag of the mask is set
+ *              SOS_STATUS_WOULD_BLOCK      :   Failed,     Task registered as a waiter, return from the task
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     No flag set and not called from a task
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or empty mask
+ */
+enu_sos_status_t_ sos_event_wait(str_sos_event_t_ * ptr_str_event, uint8_t_ uint8_mask, uint8_t_ bool_clear, uint8_t_ * ptr_uint8_flags)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    uint8_t_ uint8_matched;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_event) ||
+            (0 == uint8_mask)
+            )
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_SYNC);
+        uint8_matched = ptr_str_event->uint8_flags & uint8_mask;
+        if(0 != uint8_matched)
+        {
+            if(TRUE == bool_clear)
+            {
+                ptr_str_event->uint8_flags &= ~uint8_matched;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            enu_sos_status_retval = sos_sync_block(&ptr_str_event->uint16_waiters);
+            if(SOS_STATUS_WOULD_BLOCK == enu_sos_status_retval)
+            {
+                gl_arr_uint8_sync_event_mask[gl_ptr_str_running_task->uint8_task_id] = uint8_mask;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        exit_critical(&lo_str_critical);
+
+        if(NULL_PTR != ptr_uint8_flags)
+        {
+            *ptr_uint8_flags = uint8_matched;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Sets flags, every waiter waiting for one of them is released
+ *  @param[in,out]  ptr_str_event           :   Event group
+ *  @param[in]      uint8_flags             :   Flags to set
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_event_set(str_sos_event_t_ * ptr_str_event, uint8_t_ uint8_flags)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_event)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_SYNC);
+        ptr_str_event->uint8_flags |= uint8_flags;
+
+        for (uint8_t_ uint8_task_id = 0; (0 != ptr_str_event->uint16_waiters) && (uint8_task_id < SOS_NUMBER_OF_TASK_IDS); ++uint8_task_id)
+        {
+            if(0 == (ptr_str_event->uint16_waiters & SOS_TASK_ID_BIT(uint8_task_id)))
+            {
+                /* Do Nothing */
+            }
+            else if(SOS_SYNC_BLOCKED != gl_arr_uint8_sync_state[uint8_task_id])
+            {
+                /* stale waiter */
+                ptr_str_event->uint16_waiters &= ~SOS_TASK_ID_BIT(uint8_task_id);
+            }
+            else if(0 != (ptr_str_event->uint8_flags & gl_arr_uint8_sync_event_mask[uint8_task_id]))
+            {
+                ptr_str_event->uint16_waiters &= ~SOS_TASK_ID_BIT(uint8_task_id);
+                sos_sync_wake(uint8_task_id);
+            }
+            else
+            {
+                /* waits for other flags */
+            }
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Same as sos_event_set, kept for ISR code (the section saves SREG so
+ *	                                            interrupts stay disabled)
+ */
+enu_sos_status_t_ sos_event_set_from_isr(str_sos_event_t_ * ptr_str_event, uint8_t_ uint8_flags)
+{
+    return sos_event_set(ptr_str_event, uint8_flags);
+}
+
+/**
+ *	@brief		                            :	Clears flags
+ *  @param[in,out]  ptr_str_event           :   Event group
+ *  @param[in]      uint8_flags             :   Flags to clear
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_event_clear(str_sos_event_t_ * ptr_str_event, uint8_t_ uint8_flags)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_event)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_SYNC);
+        ptr_str_event->uint8_flags &= ~uint8_flags;
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the longest interrupts disabled section of the semaphore, mutex
+ *	                                            and event calls since sos_init (CRITICAL_SITE_SOS_SYNC, TIMER_1 1 us counter)
+ *  @param[out]     ptr_uint16_max_us       :   Pointer to store the time in microseconds
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_sync_lock_time(uint16_t_ * ptr_uint16_max_us)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    if(NULL_PTR == ptr_uint16_max_us)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        (void)critical_get_max_duration(CRITICAL_SITE_SOS_SYNC, ptr_uint16_max_us);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@author				                    :	Hossam Elwahsh - https://github.com/HossamElwahsh
+ *
+ *	@brief		                            :	Finds a task in DB using it's ID
+ *  @param[in]      ptr_str_db 	            :   Mode DB to search in
+ *  @param[in]      uint8_task_id 	        :   Task ID to search for
+ *  @param[out]     ptr_ptr_str_sos_task 	:   Pointer to pointer store found task address
+ *  @param[out]     uint8_task_index_in_db 	:   (optional) Pointer to store found task index in DB
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success,    Task found
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not found in DB
+ */
+static enu_sos_status_t_	sos_find_task		(str_sos_task_db_t_ * ptr_str_db, uint8_t_ uint8_task_id, str_sos_task_t_ ** ptr_ptr_str_sos_task, uint8_t_ * ptr_uint8_task_index_in_db)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    // SOS System State Check
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+        // Arguments check
+    else if(NULL_PTR == ptr_ptr_str_sos_task)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        /* search for task ID in DB */
+
+        uint8_t_ bool_found = FALSE;        // task found flag
+
+        for (uint8_t_ i = 0; i < ptr_str_db->uint8_number_of_tasks_added; ++i) {
+            if(uint8_task_id == ptr_str_db->arr_ptr_str_task[i]->uint8_task_id)
+            {
+                bool_found = TRUE;
+                *ptr_ptr_str_sos_task = ptr_str_db->arr_ptr_str_task[i]; // save found task pointer
+                if(NULL_PTR != ptr_uint8_task_index_in_db)
+                {
+                    // store DB index
+                    *ptr_uint8_task_index_in_db = i;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+                break;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        if(TRUE == bool_found)
+        {
+            /* Task Found */
+            enu_sos_status_retval = SOS_STATUS_SUCCESS;
+        }
+        else
+        {
+            /* Task not found */
+            enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
+        }
+
+    }
+
+    return enu_sos_status_retval;
+}
+
+
+/**
+ * @brief a private function to sort the task data base according to task
+ *		  priority after each modification to the Data base 
+ *
+ * @param ptr_str_db		   : the mode DB to sort
+ * @param uint8_task_db_index : the index of the add/deleted/modified task
+ *								in the task DB
+ *
+ * @return
+ */
+static void	sos_sort_database (str_sos_task_db_t_ * ptr_str_db, uint8_t_ uint8_task_db_index)
+{
+	str_sos_task_t_* lo_ptr_str_temp_task;
+
+	/* equal priority groups may change, their rotation starts over */
+	for (uint8_t_ lo_uint8_index = 0; lo_uint8_index < SOS_NUMBER_OF_TASKS; lo_uint8_index++)
+	{
+		ptr_str_db->arr_uint8_rr_first[lo_uint8_index] = 0;
+	}
+
+	/* Check if a task was deleted */
+	if(NULL_PTR == ptr_str_db->arr_ptr_str_task[uint8_task_db_index])
+	{
+		/* swap the deleted task with the last active task */
+		while(uint8_task_db_index < ptr_str_db->uint8_number_of_tasks_added-1)
+		{
+			ptr_str_db->arr_ptr_str_task[uint8_task_db_index] = ptr_str_db->arr_ptr_str_task[uint8_task_db_index+1];
+			ptr_str_db->arr_ptr_str_task[uint8_task_db_index+1] = NULL_PTR;
+			uint8_task_db_index++;
+		}
+	}
+	/* Check if a task was added (any new task is added after the last task in the array) */
+	else if(ptr_str_db->uint8_number_of_tasks_added-1 == uint8_task_db_index)
+	{
+		/* return if in case this is the first task in the DB */
+		if (!uint8_task_db_index) return;
+		
+		/* loop on previous tasks to insert new task in the right index according to priority */
+		while(ptr_str_db->arr_ptr_str_task[uint8_task_db_index]->uint8_task_priority 
+			< ptr_str_db->arr_ptr_str_task[uint8_task_db_index-1]->uint8_task_priority)
+			{
+				/* Swap the tasks */
+				lo_ptr_str_temp_task = ptr_str_db->arr_ptr_str_task[uint8_task_db_index];
+				ptr_str_db->arr_ptr_str_task[uint8_task_db_index] = ptr_str_db->arr_ptr_str_task[uint8_task_db_index-1];
+				ptr_str_db->arr_ptr_str_task[uint8_task_db_index-1] = lo_ptr_str_temp_task;
+				uint8_task_db_index --;
+				
+				/* Break out of loop if we reach the first index in DB */
+				if(0 == uint8_task_db_index) break;
+			}
+	}
+	else /* A task was modified */
+	{
+		uint8_t_ lo_uint8_temp_index = uint8_task_db_index;
+		
+		/* Check that the modified task is not the first in the DB */
+		if(uint8_task_db_index)
+		{
+			/* 
+			Check whether the priority of the task of the given index is smaller than
+			that of the task at the previous index, if so, loop on the previous tasks
+			to insert the modified task at the right index according to task priority
+			*/
+			
+			while(ptr_str_db->arr_ptr_str_task[lo_uint8_temp_index]->uint8_task_priority
+			< ptr_str_db->arr_ptr_str_task[lo_uint8_temp_index-1]->uint8_task_priority)
+			{
+				/* Swap the tasks */
+				lo_ptr_str_temp_task = ptr_str_db->arr_ptr_str_task[lo_uint8_temp_index];
+				ptr_str_db->arr_ptr_str_task[lo_uint8_temp_index] = ptr_str_db->arr_ptr_str_task[lo_uint8_temp_index-1];
+				ptr_str_db->arr_ptr_str_task[lo_uint8_temp_index-1] = lo_ptr_str_temp_task;
+				lo_uint8_temp_index --;
+				if(0 == lo_uint8_temp_index) break;
+			}
+		}		
+		
+		/* 
+		Check whether the priority of the task of the given index is bigger than
+		that of the task at the next index, if so, loop on the previous tasks
+		to insert the modified task at the right index according to task priority
+		*/
+		/* the last task index has no next task to compare with */
+		while((uint8_task_db_index < ptr_str_db->uint8_number_of_tasks_added-1)
+		&& (ptr_str_db->arr_ptr_str_task[uint8_task_db_index]->uint8_task_priority
+		> ptr_str_db->arr_ptr_str_task[uint8_task_db_index+1]->uint8_task_priority))
+		{
+			/* Swap the tasks */
+			lo_ptr_str_temp_task = ptr_str_db->arr_ptr_str_task[uint8_task_db_index];
+			ptr_str_db->arr_ptr_str_task[uint8_task_db_index] = ptr_str_db->arr_ptr_str_task[uint8_task_db_index+1];
+			ptr_str_db->arr_ptr_str_task[uint8_task_db_index+1] = lo_ptr_str_temp_task;
+			uint8_task_db_index ++;			
+		}
+	}
+}
+
+/**
+ *	@syntax				:	sos_run(void);
+ *	@description		:	Starts timer
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	None
+ *  @Parameters (out)	:	None
+ *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
+ *							SOS_STATUS_INVALID_STATE in case timers return an error
+ */
+void sos_run(void)
+{
+    if(gl_enu_sos_scheduler_state != SOS_SCHEDULER_INITIALIZED)
+    {
+        return;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+    sos_kernel_reset();
+#endif
+
+    /*
+     * running before the timer resumes, a tick of a timer paused close to its
+     * overflow may come at once and its jobs may call sos_disable
+     */
+    SOS_SET_SCHEDULER_STATE(SOS_SCHEDULER_BLOCKED);
+    if(TIMER_NOK == timer_resume(TIMER_0))
+    {
+        SOS_SET_SCHEDULER_STATE(SOS_SCHEDULER_INITIALIZED);
+        return;
+    }
+    else
+    {
+        /*
+         * cooperative: the loop runs the scheduler pass on every tick
+         * preemptive : the tick ISR dispatches the tasks, the loop is the idle task
+         * deferred ISR work is drained between ticks and before every pass
+         */
+        while((gl_enu_sos_scheduler_state == SOS_SCHEDULER_BLOCKED)
+              || (gl_enu_sos_scheduler_state == SOS_SCHEDULER_READY))
+        {
+            dwq_drain();
+
+            if (SOS_SCHEDULER_READY == gl_enu_sos_scheduler_state)
+            {
+                sos_system_scheduler();
+            }
+            else if(FALSE == sos_run_background())
+            {
+                /* no periodic task due and no background slice, wait for the next interrupt */
+                sos_port_idle();
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+
+
+}
+
+/**
+ *	@syntax				:	sos_disable(void);
+ *	@description		:	Stops the timer
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	uint8_taskID
+ *  @Parameters (out)	:	None
+ *  @Return value		:	SOS_STATUS_SUCCESS in case of SUCCESS
+ *							SOS_STATUS_INVALID_STATE in case timers return an error
+ */
+void sos_disable(void)
+{
+    if(
+            (gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED) ||
+            (TIMER_NOK == timer_pause(TIMER_0))
+    )
+    {
+        return;
+    }
+    else
+    {
+        /* Success */
+		SOS_SET_SCHEDULER_STATE(SOS_SCHEDULER_INITIALIZED);
+    }
+
+}
+
+/**
+ *	@syntax				:	sos_idle(void);
+ *	@description		:	Waits for the next interrupt through the port idle hook
+ *	@Sync\Async      	:	Synchronous
+ *  @Reentrancy      	:	Reentrant
+ *  @Parameters (in) 	:	None
+ *  @Parameters (out)	:	None
+ *  @Return value		:	None
+ */
+void sos_idle(void)
+{
+    sos_port_idle();
+}
+
+static void	sos_system_scheduler(void)
+{
+    str_sos_task_db_t_ * ptr_str_db = gl_ptr_str_active_db;
+    str_sos_task_t_ * ptr_str_task;
+    uint32_t_ uint32_now = sos_get_ticks();
+    uint8_t_ uint8_looping_variable;
+    uint8_t_ uint8_group_start = 0;
+    uint8_t_ uint8_group_end = 0;
+
+    /* software timers expire before the tasks of the same tick run */
+    swt_dispatch();
+
+    sos_rr_rotate(ptr_str_db, uint32_now);
+
+    for (uint8_looping_variable = 0; uint8_looping_variable < ptr_str_db->uint8_number_of_tasks_added; uint8_looping_variable++)
+    {
+        /* equal priority tasks are served in turn, starting from the group rotation */
+        if (uint8_looping_variable >= uint8_group_end)
+        {
+            uint8_group_start   = uint8_looping_variable;
+            uint8_group_end     = sos_rr_group_end(ptr_str_db, uint8_group_start);
+        }
+        else if (uint8_group_end > ptr_str_db->uint8_number_of_tasks_added)
+        {
+            /* a task deleted itself */
+            uint8_group_end     = ptr_str_db->uint8_number_of_tasks_added;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        ptr_str_task = ptr_str_db->arr_ptr_str_task[uint8_group_start +
+                ((uint8_looping_variable - uint8_group_start + ptr_str_db->arr_uint8_rr_first[uint8_group_start])
+                 % (uint8_group_end - uint8_group_start))];
+
+        if (TRUE == sos_task_due(ptr_str_task, uint32_now))
+        {
+            sos_run_job(ptr_str_task, uint32_now);
+
+            /* successors run right after their predecessors, same pass */
+            sos_chain_run_ready(uint32_now);
+        }
+        else
+        {
+            /*TASK IS NOT READY*/
+        }
+    }
+
+    if(SOS_SCHEDULER_READY == gl_enu_sos_scheduler_state)
+    {
+        SOS_SET_SCHEDULER_STATE(SOS_SCHEDULER_BLOCKED);
+    }
+
+    sos_handle_tick_boundary();
+}
+
+/**
+ * @brief a private function to run one job of a due task in the cooperative
+ *		  kernel, released by its period, by its chain predecessors or woken by
+ *		  a sync object, with the deadline, latency and monitor bookkeeping
+ *
+ * @param ptr_str_task  : due task of the active mode
+ * @param uint32_now    : tick of the scheduler pass
+ *
+ * @return
+ */
+static void sos_run_job(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_now)
+{
+    uint32_t_ uint32_release;
+    uint8_t_ bool_released_job;
+    uint16_t_ uint16_delay;
+
+    /* only released jobs have a deadline, an extra run woken by a sync object has none */
+    bool_released_job = sos_job_release(ptr_str_task, uint32_now, &uint32_release);
+
+    if (NULL_PTR == ptr_str_task->ptr_func_task)
+    {
+        /*FUNCTION DOES NOT EXIST*/
+    }
+    else if (
+            (TRUE == bool_released_job) &&
+            (FALSE == sos_deadline_dispatch(ptr_str_task, uint32_release, uint32_now))
+            )
+    {
+        /* job shed, the release moves on as if it ran */
+        SOS_SCM(scm_skip(ptr_str_task->uint8_task_id, uint32_now));
+        sos_advance_release(ptr_str_task, uint32_now, SOS_TASK_DEFAULT_PERIOD);
+    }
+    else
+    {
+        gl_ptr_str_running_task = ptr_str_task;
+        gl_arr_uint8_sync_state[gl_ptr_str_running_task->uint8_task_id] = SOS_SYNC_RUNNABLE;
+        if (TRUE == bool_released_job)
+        {
+            sos_record_dispatch_latency(gl_ptr_str_running_task, uint32_release);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        SOS_SCM(scm_dispatch(gl_ptr_str_running_task->uint8_task_id, uint32_now));
+        SOS_PORT_TRACE_JOB(gl_ptr_str_running_task->uint8_task_id, TRUE);
+        uint16_delay = gl_ptr_str_running_task->ptr_func_task();
+        SOS_PORT_TRACE_JOB(gl_ptr_str_running_task->uint8_task_id, FALSE);
+        SOS_SCM(scm_complete(gl_ptr_str_running_task->uint8_task_id, uint32_now, uint16_delay));
+        if (TRUE == bool_released_job)
+        {
+            sos_deadline_complete(gl_ptr_str_running_task, uint32_release, sos_get_ticks());
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        sos_advance_release(gl_ptr_str_running_task, uint32_now, uint16_delay);
+        sos_chain_complete(gl_ptr_str_running_task, uint32_release);
+        gl_ptr_str_running_task = NULL_PTR;
+    }
+}
+
+/**
+ * @brief a private function to restart the task set phase at the end of the
+ *		  hyper-period and to apply a pending mode switch at its switch point,
+ *		  called once per served tick after the released tasks are handled
+ *
+ * @return
+ */
+static void sos_handle_tick_boundary(void)
+{
+    str_critical_t_ lo_str_critical;
+
+    /* the tick ISR increments the counter, the compare and reset must not lose a tick */
+    enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+
+    /* an empty mode has a zero hyper-period, every tick is a boundary */
+    if (gl_ptr_str_active_db->uint32_hyper_period <= gl_uint32_tick_counter)
+    {
+        /* ticks served late (overshoot) stay in the phase of the next hyper-period */
+        gl_uint32_tick_counter = (0 != gl_ptr_str_active_db->uint32_hyper_period) ?
+                                 (gl_uint32_tick_counter - gl_ptr_str_active_db->uint32_hyper_period) : 0;
+        SOS_PORT_TRACE_EVENT("hyper-period");
+        sos_apply_mode_switch();
+    }
+    else if (
+            (SOS_MODE_ID_NONE != gl_uint8_pending_mode_id) &&
+            (SOS_MODE_SWITCH_NEXT_TICK == gl_enu_pending_mode_switch_point)
+            )
+    {
+        /* new mode starts its own phase from the next tick */
+        gl_uint32_tick_counter = 0;
+        sos_apply_mode_switch();
+    }
+    else
+    {
+        /*SCHEDULER HAVEN'T REACH TO HYPER PERIOD YET*/
+    }
+
+    exit_critical(&lo_str_critical);
+}
+
+/**
+ * @brief a private function to check a released job when it is about to
+ *		  start, a job that can not end before its deadline any more is a miss
+ *
+ * @param ptr_str_task      : task of the job
+ * @param uint32_release    : tick that released the job
+ * @param uint32_now        : current system tick
+ *
+ * @return TRUE to run the job, FALSE if it is shed (SOS_OVERLOAD_SKIP_NEXT)
+ */
+static uint8_t_ sos_deadline_dispatch(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_release, uint32_t_ uint32_now)
+{
+    str_sos_deadline_state_t_ * ptr_str_state = &gl_arr_str_deadline[ptr_str_task->uint8_task_id];
+    uint16_t_ uint16_deadline = (0 != ptr_str_task->uint16_task_deadline) ?
+                                ptr_str_task->uint16_task_deadline : ptr_str_task->uint16_task_periodicity;
+    uint8_t_ bool_run = TRUE;
+
+    ptr_str_state->uint8_job_missed = FALSE;
+
+    if (SOS_TICK_REACHED(uint32_now, uint32_release + uint16_deadline))
+    {
+        sos_deadline_miss(ptr_str_task);
+        ptr_str_state->uint8_job_missed = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if (TRUE == ptr_str_state->uint8_skip_next)
+    {
+        ptr_str_state->uint8_skip_next = FALSE;
+        if (0xFFFF != ptr_str_state->str_stats.uint16_shed)
+        {
+            ptr_str_state->str_stats.uint16_shed++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        bool_run = FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return bool_run;
+}
+
+/**
+ * @brief a private function to check a job when it returns, a degraded task
+ *		  gets one period step back after SOS_DEADLINE_RECOVER_JOBS jobs in time
+ *
+ * @param ptr_str_task      : task of the job
+ * @param uint32_release    : tick that released the job
+ * @param uint32_now        : current system tick
+ *
+ * @return
+ */
+static void sos_deadline_complete(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_release, uint32_t_ uint32_now)
+{
+    str_sos_deadline_state_t_ * ptr_str_state = &gl_arr_str_deadline[ptr_str_task->uint8_task_id];
+    uint16_t_ uint16_deadline = (0 != ptr_str_task->uint16_task_deadline) ?
+                                ptr_str_task->uint16_task_deadline : ptr_str_task->uint16_task_periodicity;
+
+    if (SOS_TICK_REACHED(uint32_now, uint32_release + uint16_deadline))
+    {
+        /* one miss per job, it may be counted at dispatch already */
+        if (FALSE == ptr_str_state->uint8_job_missed)
+        {
+            sos_deadline_miss(ptr_str_task);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if (0 != ptr_str_state->str_stats.uint8_degrade_shift)
+    {
+        ptr_str_state->uint8_met_streak++;
+        if (SOS_DEADLINE_RECOVER_JOBS <= ptr_str_state->uint8_met_streak)
+        {
+            ptr_str_state->str_stats.uint8_degrade_shift--;
+            ptr_str_state->uint8_met_streak = 0;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief a private function to count a deadline miss and apply the overload
+ *		  action of the task
+ *
+ * @param ptr_str_task : task that missed
+ *
+ * @return
+ */
+static void sos_deadline_miss(str_sos_task_t_ * ptr_str_task)
+{
+    str_sos_deadline_state_t_ * ptr_str_state = &gl_arr_str_deadline[ptr_str_task->uint8_task_id];
+
+    if (0xFFFF != ptr_str_state->str_stats.uint16_misses)
+    {
+        ptr_str_state->str_stats.uint16_misses++;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    ptr_str_state->uint8_met_streak = 0;
+
+    switch (ptr_str_task->enu_overload_action)
+    {
+        case SOS_OVERLOAD_SKIP_NEXT:
+            ptr_str_state->uint8_skip_next = TRUE;
+            break;
+
+        case SOS_OVERLOAD_DEGRADE:
+            if (SOS_DEADLINE_MAX_DEGRADE_SHIFT > ptr_str_state->str_stats.uint8_degrade_shift)
+            {
+                ptr_str_state->str_stats.uint8_degrade_shift++;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+            break;
+
+        case SOS_OVERLOAD_HANDLER:
+            ptr_str_task->ptr_func_overload(ptr_str_task->uint8_task_id);
+            break;
+
+        default:
+            /* SOS_OVERLOAD_NONE, counted only */
+            break;
+    }
+}
+
+/**
+ * @brief a private function to clear the deadline state of a task ID that
+ *		  left every mode
+ *
+ * @param uint8_task_id : task ID to forget
+ *
+ * @return
+ */
+static void sos_deadline_forget_task(uint8_t_ uint8_task_id)
+{
+    gl_arr_str_deadline[uint8_task_id].str_stats.uint16_misses       = 0;
+    gl_arr_str_deadline[uint8_task_id].str_stats.uint16_shed         = 0;
+    gl_arr_str_deadline[uint8_task_id].str_stats.uint8_degrade_shift = 0;
+    gl_arr_str_deadline[uint8_task_id].uint8_skip_next               = FALSE;
+    gl_arr_str_deadline[uint8_task_id].uint8_job_missed              = FALSE;
+    gl_arr_str_deadline[uint8_task_id].uint8_met_streak              = 0;
+}
+
+/**
+ * @brief a private function to give one slice to the next background task,
+ *		  called by the sos_run loop while no periodic task is due. No slice
+ *		  is started within SOS_BG_MARGIN_US of the next tick
+ *
+ * @return TRUE if a slice ran, FALSE otherwise
+ */
+static uint8_t_ sos_run_background(void)
+{
+    uint8_t_ bool_ran = FALSE;
+    str_sos_bg_task_t_ * ptr_str_bg_task;
+    uint32_t_ uint32_elapsed_us = 0;
+    uint32_t_ uint32_now;
+    uint16_t_ uint16_start = 0;
+    uint16_t_ uint16_end = 0;
+    uint16_t_ uint16_slice_us;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == gl_ptr_str_bg_head)
+    {
+        /* nothing to run */
+    }
+    else if(
+            (TIMER_OK != timer_get_elapsed_us(TIMER_0, &uint32_elapsed_us)) ||
+            ((uint32_elapsed_us + SOS_BG_MARGIN_US) >= ((uint32_t_)SOS_SYS_TICK_TIME_MS * 1000))
+            )
+    {
+        /* too close to the next tick, counted once per tick */
+        uint32_now = sos_get_ticks();
+        if(uint32_now != gl_uint32_bg_cutoff_tick)
+        {
+            gl_uint32_bg_cutoff_tick = uint32_now;
+            gl_str_bg_stats.uint32_cutoffs++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        ptr_str_bg_task = (NULL_PTR != gl_ptr_str_bg_next) ? gl_ptr_str_bg_next : gl_ptr_str_bg_head;
+        gl_ptr_str_bg_next = ptr_str_bg_task->ptr_str_next;
+        exit_critical(&lo_str_critical);
+
+        timer_get_count(TIMER_1, &uint16_start);
+        SOS_PORT_TRACE_BACKGROUND(TRUE);
+        ptr_str_bg_task->ptr_func_task();
+        SOS_PORT_TRACE_BACKGROUND(FALSE);
+        timer_get_count(TIMER_1, &uint16_end);
+
+        uint16_slice_us = uint16_end - uint16_start;
+        ptr_str_bg_task->uint32_slices++;
+
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        gl_str_bg_stats.uint32_slices++;
+        gl_str_bg_stats.uint32_busy_us += uint16_slice_us;
+        bool_ran = TRUE;
+        if(uint16_slice_us > gl_str_bg_stats.uint16_max_slice_us)
+        {
+            gl_str_bg_stats.uint16_max_slice_us = uint16_slice_us;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return bool_ran;
+}
+
+/**
+ *	@brief		                            :	Gets the deadline statistics of a task, misses are detected when
+ *	                                            a released job starts and when it returns
+ *  @param[in]      uint8_task_id           :   Task ID
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              SOS_STATUS_INVALID_TASK_ID  :   Failed,     Task ID not used by any mode
+ */
+enu_sos_status_t_ sos_get_deadline_stats(uint8_t_ uint8_task_id, str_sos_deadline_stats_t_ * ptr_str_stats)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_stats)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else if(FALSE == sos_task_registered(uint8_task_id))
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_TASK_ID;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        *ptr_str_stats = gl_arr_str_deadline[uint8_task_id].str_stats;
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Adds a background task to the round-robin, it gets slices of the
+ *	                                            time left after the periodic tasks of every tick
+ *  @param[in,out]  ptr_str_bg_task         :   Caller owned background task
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or task already added
+ */
+enu_sos_status_t_ sos_create_bg_task(str_sos_bg_task_t_ * ptr_str_bg_task)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_sos_bg_task_t_ * ptr_str_iterator;
+    str_critical_t_ lo_str_critical;
+
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else if(
+            (NULL_PTR == ptr_str_bg_task) ||
+            (NULL_PTR == ptr_str_bg_task->ptr_func_task)
+            )
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        for (ptr_str_iterator = gl_ptr_str_bg_head; NULL_PTR != ptr_str_iterator; ptr_str_iterator = ptr_str_iterator->ptr_str_next)
+        {
+            if(ptr_str_iterator == ptr_str_bg_task)
+            {
+                enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+                break;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        if(SOS_STATUS_SUCCESS == enu_sos_status_retval)
+        {
+            /* added at the head, it gets a slice once the current round ends */
+            ptr_str_bg_task->uint32_slices  = 0;
+            ptr_str_bg_task->ptr_str_next   = gl_ptr_str_bg_head;
+            gl_ptr_str_bg_head              = ptr_str_bg_task;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Removes a background task from the round-robin
+ *  @param[in,out]  ptr_str_bg_task         :   Background task to remove
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or task not added
+ */
+enu_sos_status_t_ sos_delete_bg_task(str_sos_bg_task_t_ * ptr_str_bg_task)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    str_sos_bg_task_t_ ** ptr_ptr_str_link;
+    str_critical_t_ lo_str_critical;
+
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else if(NULL_PTR == ptr_str_bg_task)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        for (ptr_ptr_str_link = &gl_ptr_str_bg_head; NULL_PTR != *ptr_ptr_str_link; ptr_ptr_str_link = &(*ptr_ptr_str_link)->ptr_str_next)
+        {
+            if(*ptr_ptr_str_link == ptr_str_bg_task)
+            {
+                *ptr_ptr_str_link = ptr_str_bg_task->ptr_str_next;
+                if(gl_ptr_str_bg_next == ptr_str_bg_task)
+                {
+                    gl_ptr_str_bg_next = ptr_str_bg_task->ptr_str_next;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+                enu_sos_status_retval = SOS_STATUS_SUCCESS;
+                break;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the background throughput since sos_init
+ *  @param[out]     ptr_str_bg_stats        :   Pointer to store the statistics
+ *
+ *  @Return     SOS_STATUS_SUCCESS		    :	Success
+ *              SOS_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_sos_status_t_ sos_get_bg_stats(str_sos_bg_stats_t_ * ptr_str_bg_stats)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_bg_stats)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enter_critical(&lo_str_critical, CRITICAL_SITE_SOS_DB);
+        *ptr_str_bg_stats = gl_str_bg_stats;
+        exit_critical(&lo_str_critical);
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets the task currently dispatched by the scheduler
+ *
+ *  @Return     Pointer to the running task, NULL_PTR when called outside of a task
+ */
+str_sos_task_t_ * sos_get_running_task(void)
+{
+    return gl_ptr_str_running_task;
+}
+
+/**
+ *	@brief		                            :	Gets the free running system tick count, read twice until both
+ *	                                            reads match so a tick landing in the middle of the 4 byte read is
+ *	                                            not seen torn, interrupts are never disabled. Task or ISR context
+ *
+ *  @Return     Ticks since start, wraps around to 0 after 2^32 ticks
+ */
+uint32_t_ sos_get_ticks(void)
+{
+    uint32_t_ uint32_ticks;
+
+    /* a torn first read differs from the second one, one tick per retry at most */
+    do
+    {
+        uint32_ticks = gl_uint32_sys_ticks;
+    }
+    while (uint32_ticks != gl_uint32_sys_ticks);
+
+    return uint32_ticks;
+}
+
+/**
+ *	@brief		                            :	Gets the ticks elapsed since a sos_get_ticks value, correct across
+ *	                                            the counter wraparound for intervals shorter than 2^32 ticks
+ *  @param[in]      uint32_since_tick       :   Earlier sos_get_ticks value
+ *
+ *  @Return     Elapsed ticks
+ */
+uint32_t_ sos_ticks_elapsed(uint32_t_ uint32_since_tick)
+{
+    /* unsigned subtraction is modulo 2^32 */
+    return (uint32_t_)(sos_get_ticks() - uint32_since_tick);
+}
+
+/**
+ *	@brief		                            :	Checks if a tick count has been reached, correct across the
+ *	                                            counter wraparound for ticks less than 2^31 ticks away
+ *  @param[in]      uint32_tick             :   Tick to check, e.g. sos_get_ticks() + SOS_MS_TO_TICKS(500)
+ *
+ *  @Return     TRUE when reached or passed, FALSE otherwise
+ */
+uint8_t_ sos_ticks_reached(uint32_t_ uint32_tick)
+{
+    return SOS_TICK_REACHED(sos_get_ticks(), uint32_tick) ? TRUE : FALSE;
+}
+
+/**
+ * @brief a private function to swap the active task set with a pending
+ *		  requested mode, the mode DBs are prebuilt and sorted so the
+ *		  switch is a pointer swap, the tasks of the new mode then restart
+ *		  their phase from the current tick (tick counter must be reset)
+ *
+ * @return
+ */
+static void sos_apply_mode_switch(void)
+{
+    uint8_t_ uint8_mode_id = gl_uint8_pending_mode_id;
+
+    if (SOS_MODE_ID_NONE != uint8_mode_id)
+    {
+        gl_ptr_str_active_db        = &gl_arr_str_task_db[uint8_mode_id];
+        gl_uint8_active_mode_id     = uint8_mode_id;
+        gl_uint8_pending_mode_id    = SOS_MODE_ID_NONE;
+        SOS_PORT_TRACE_EVENT("mode switch");
+        SOS_SCM(scm_forget_all());
+        gl_uint16_chain_ready       = 0;    /* chain runs released in the old mode are dropped */
+
+        for (uint8_t_ uint8_looping_variable = 0; uint8_looping_variable < gl_ptr_str_active_db->uint8_number_of_tasks_added; uint8_looping_variable++)
+        {
+            sos_phase_task(gl_ptr_str_active_db->arr_ptr_str_task[uint8_looping_variable]);
+            SOS_SCM(sos_scm_track(gl_ptr_str_active_db->arr_ptr_str_task[uint8_looping_variable]->uint8_task_id));
+        }
+
+        /* switch latency bookkeeping */
+        if (gl_uint32_mode_switch_wait_ticks > gl_uint32_mode_switch_max_latency)
+        {
+            gl_uint32_mode_switch_max_latency = gl_uint32_mode_switch_wait_ticks;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* No switch requested */
+    }
+}
+
+static void	sos_sys_tick_task	(void)
+{
+    uint16_t_ uint16_count = 0;
+    uint32_t_ uint32_since_tick_us = 0;
+
+    /* time stamp of the tick on the 1 us TIMER_1, back to the TIMER_0 event */
+    timer_get_count(TIMER_1, &uint16_count);
+    timer_get_elapsed_us(TIMER_0, &uint32_since_tick_us);
+    gl_uint16_tick_stamp = (uint16_t_)(uint16_count - ((uint32_since_tick_us * XTAL_FREQ) / SOS_LATENCY_TIMER_PRESCALER));
+
+    gl_uint32_tick_counter++;
+    gl_uint32_sys_ticks++;
+    swt_tick();
+    SOS_SCM(scm_tick(gl_uint32_sys_ticks));
+
+    if (SOS_MODE_ID_NONE != gl_uint8_pending_mode_id)
+    {
+        gl_uint32_mode_switch_wait_ticks++;
+    }
+
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+    sos_kernel_tick();
+#else
+    /* a tick pending when sos_disable paused the timer must not restart the loop */
+    if (SOS_SCHEDULER_BLOCKED == gl_enu_sos_scheduler_state)
+    {
+        SOS_SET_SCHEDULER_STATE(SOS_SCHEDULER_READY);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+}
+
+/**
+ * @brief a private function to align the first release of a task with the
+ *		  current hyper-period phase, same ticks as (tick counter % period == 0),
+ *		  a chained task may run at the next release by its predecessors
+ *
+ * @param ptr_str_task : the task to phase
+ *
+ * @return
+ */
+static void sos_phase_task(str_sos_task_t_ * ptr_str_task)
+{
+    if (0 != gl_arr_uint16_chain_predecessors[ptr_str_task->uint8_task_id])
+    {
+        /* released by its predecessors, nothing holds its first run back */
+        ptr_str_task->uint32_task_release_tick = gl_uint32_sys_ticks;
+    }
+    else
+    {
+        ptr_str_task->uint32_task_release_tick = gl_uint32_sys_ticks + ptr_str_task->uint16_task_periodicity
+                - (gl_uint32_tick_counter % ptr_str_task->uint16_task_periodicity);
+    }
+}
+
+/**
+ * @brief a private function to move the release time of a task after a run,
+ *		  constant time, the DB order is not touched
+ *
+ * @param ptr_str_task  : the task that ran
+ * @param uint32_now    : tick the run was served at
+ * @param uint16_delay  : value returned by the task
+ *
+ * @return
+ */
+static void sos_advance_release(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_now, uint16_t_ uint16_delay)
+{
+    /* a degraded task keeps the phase of its nominal period, it skips releases */
+    uint32_t_ uint32_period = (uint32_t_)ptr_str_task->uint16_task_periodicity
+            << gl_arr_str_deadline[ptr_str_task->uint8_task_id].str_stats.uint8_degrade_shift;
+
+    if (0 != gl_arr_uint16_chain_predecessors[ptr_str_task->uint8_task_id])
+    {
+        /* released by its predecessors, a returned delay holds the next chain run back */
+        ptr_str_task->uint32_task_release_tick = uint32_now + uint16_delay;
+    }
+    else if (FALSE == SOS_TICK_REACHED(uint32_now, ptr_str_task->uint32_task_release_tick))
+    {
+        /* extra run released by a sync object, the periodic release stays */
+        if (SOS_TASK_DEFAULT_PERIOD != uint16_delay)
+        {
+            ptr_str_task->uint32_task_release_tick = uint32_now + uint16_delay;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if (SOS_TASK_DEFAULT_PERIOD == uint16_delay)
+    {
+        ptr_str_task->uint32_task_release_tick += uint32_period;
+
+        /* releases missed while the CPU was late are dropped, stay in phase */
+        if (SOS_TICK_REACHED(uint32_now, ptr_str_task->uint32_task_release_tick))
+        {
+            ptr_str_task->uint32_task_release_tick +=
+                    (((uint32_now - ptr_str_task->uint32_task_release_tick) / uint32_period) + 1) * uint32_period;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        ptr_str_task->uint32_task_release_tick += uint16_delay;
+    }
+}
+
+/**
+ * @brief a private function to find the end of the group of equal priority
+ *		  tasks that starts at a DB index
+ *
+ * @param ptr_str_db        : sorted task DB
+ * @param uint8_group_start : index of the first task of the group
+ *
+ * @return index after the last task of the group
+ */
+static uint8_t_ sos_rr_group_end(str_sos_task_db_t_ * ptr_str_db, uint8_t_ uint8_group_start)
+{
+    uint8_t_ uint8_group_end = uint8_group_start + 1;
+
+    while (
+            (uint8_group_end < ptr_str_db->uint8_number_of_tasks_added) &&
+            (ptr_str_db->arr_ptr_str_task[uint8_group_end]->uint8_task_priority ==
+             ptr_str_db->arr_ptr_str_task[uint8_group_start]->uint8_task_priority)
+            )
+    {
+        uint8_group_end++;
+    }
+
+    return uint8_group_end;
+}
+
+/**
+ * @brief a private function to rotate the equal priority groups once per
+ *		  tick, when two or more tasks of a group are due together the group
+ *		  starts from the next due task after the one served first last time.
+ *		  Ticks with a single due task leave the rotation alone so a short
+ *		  period task can not keep the first slot of a longer period one
+ *
+ * @param ptr_str_db    : task DB about to be served
+ * @param uint32_now    : current system tick
+ *
+ * @return
+ */
+static void sos_rr_rotate(str_sos_task_db_t_ * ptr_str_db, uint32_t_ uint32_now)
+{
+    uint8_t_ uint8_group_start;
+    uint8_t_ uint8_group_end;
+    uint8_t_ uint8_group_size;
+    uint8_t_ uint8_offset;
+    uint8_t_ uint8_next_first = 0;
+    uint8_t_ uint8_due_count;
+
+    for (uint8_group_start = 0; uint8_group_start < ptr_str_db->uint8_number_of_tasks_added; uint8_group_start = uint8_group_end)
+    {
+        uint8_group_end     = sos_rr_group_end(ptr_str_db, uint8_group_start);
+        uint8_group_size    = uint8_group_end - uint8_group_start;
+        uint8_due_count     = 0;
+
+        /* the previous first task is checked last */
+        for (uint8_t_ uint8_step = 1; (uint8_group_size > 1) && (uint8_step <= uint8_group_size); uint8_step++)
+        {
+            uint8_offset = (ptr_str_db->arr_uint8_rr_first[uint8_group_start] + uint8_step) % uint8_group_size;
+
+            if (TRUE == sos_task_due(ptr_str_db->arr_ptr_str_task[uint8_group_start + uint8_offset], uint32_now))
+            {
+                if (0 == uint8_due_count)
+                {
+                    uint8_next_first = uint8_offset;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+                uint8_due_count++;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        if (uint8_due_count > 1)
+        {
+            ptr_str_db->arr_uint8_rr_first[uint8_group_start] = uint8_next_first;
+        }
+        else
+        {
+            /* no tie this tick */
+        }
+    }
+}
+
+/**
+ * @brief a private function to track the worst case time from the system tick
+ *		  that released a job to the start of the highest priority task of the
+ *		  active mode, whole ticks the job waited plus the time in the last one
+ *		  on TIMER_1 (1 us), the context switch of the preemptive kernel included
+ *
+ * @param ptr_str_task   : the task about to run
+ * @param uint32_release : tick that released the job
+ *
+ * @return
+ */
+static void sos_record_dispatch_latency(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_release)
+{
+    uint32_t_ uint32_latency_us = 0;
+    uint32_t_ uint32_now = gl_uint32_sys_ticks;
+    uint16_t_ uint16_stamp;
+    uint16_t_ uint16_count;
+
+    /* an extra run woken by a sync object was not released by a tick */
+    if (
+            (ptr_str_task == gl_ptr_str_active_db->arr_ptr_str_task[0]) &&
+            (TRUE == SOS_TICK_REACHED(uint32_now, uint32_release))
+            )
+    {
+        /* the tick count is read again so a tick between the reads is not lost */
+        do
+        {
+            uint32_now = gl_uint32_sys_ticks;
+            uint16_stamp = gl_uint16_tick_stamp;
+            uint16_count = 0;
+            timer_get_count(TIMER_1, &uint16_count);
+        } while (uint32_now != gl_uint32_sys_ticks);
+
+        /* less than a tick since the last one, TIMER_1 wraps every 65 ms */
+        uint32_latency_us = ((uint32_t_)(uint16_t_)(uint16_count - uint16_stamp) * SOS_LATENCY_TIMER_PRESCALER) / XTAL_FREQ;
+        uint32_latency_us += (uint32_now - uint32_release) * (SOS_SYS_TICK_TIME_MS * 1000UL);
+        if (uint32_latency_us > gl_uint32_dispatch_max_latency_us)
+        {
+            gl_uint32_dispatch_max_latency_us = uint32_latency_us;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+/**
+ * @brief a private function to drop all jobs, the sos_run caller becomes
+ *		  the idle task
+ *
+ * @return
+ */
+static void sos_kernel_reset(void)
+{
+    for (uint8_t_ uint8_task_id = 0; uint8_task_id < SOS_NUMBER_OF_TASK_IDS; ++uint8_task_id)
+    {
+        gl_arr_str_tcb[uint8_task_id].enu_state     = SOS_TCB_IDLE;
+        gl_arr_str_tcb[uint8_task_id].uint8_pending = FALSE;
+    }
+    gl_uint8_current_task_id = SOS_TASK_ID_IDLE;
+    gl_ptr_str_running_task  = NULL_PTR;
+}
+
+/**
+ * @brief a private function called from the tick ISR, releases the due tasks
+ *		  of the active mode and preempts the running task if a released one
+ *		  has a higher priority, returns when the preempted task is resumed
+ *
+ * @return
+ */
+static void sos_kernel_tick(void)
+{
+    str_sos_task_db_t_ * ptr_str_db = gl_ptr_str_active_db;
+    str_sos_task_t_ * ptr_str_task;
+    uint8_t_ uint8_next_task_id;
+
+    /* software timer callbacks run here, in the tick ISR */
+    swt_dispatch();
+
+    sos_rr_rotate(ptr_str_db, gl_uint32_sys_ticks);
+
+    for (uint8_t_ uint8_looping_variable = 0; uint8_looping_variable < ptr_str_db->uint8_number_of_tasks_added; uint8_looping_variable++)
+    {
+        ptr_str_task = ptr_str_db->arr_ptr_str_task[uint8_looping_variable];
+
+        if (
+                (TRUE == sos_task_due(ptr_str_task, gl_uint32_sys_ticks)) &&
+                (NULL_PTR != ptr_str_task->ptr_func_task)
+                )
+        {
+            sos_kernel_release(ptr_str_task);
+        }
+        else
+        {
+            /*TASK IS NOT READY*/
+        }
+    }
+
+    sos_handle_tick_boundary();
+
+    uint8_next_task_id = sos_kernel_pick(gl_uint8_current_task_id);
+    if (SOS_TASK_ID_IDLE != uint8_next_task_id)
+    {
+        sos_kernel_start_task(uint8_next_task_id, gl_uint8_current_task_id,
+                              (SOS_TASK_ID_IDLE == gl_uint8_current_task_id) ?
+                              &gl_str_idle_context : &gl_arr_str_tcb[gl_uint8_current_task_id].str_context);
+    }
+    else
+    {
+        /* running task keeps the CPU */
+    }
+}
+
+/**
+ * @brief a private function to release a job of a due task, it is started by
+ *		  sos_kernel_pick as soon as its priority allows, called in the tick ISR
+ *		  or when the last chain predecessor of the task finished
+ *
+ * @param ptr_str_task : due task of the active mode
+ *
+ * @return
+ */
+static void sos_kernel_release(str_sos_task_t_ * ptr_str_task)
+{
+    str_sos_tcb_t_ * ptr_str_tcb = &gl_arr_str_tcb[ptr_str_task->uint8_task_id];
+
+    gl_arr_uint8_sync_state[ptr_str_task->uint8_task_id] = SOS_SYNC_RUNNABLE;
+
+    /*
+     * a job still running is restarted once it ends (overrun), the
+     * release moves by one period now so the task is not released on
+     * every tick until it returns, a returned delay replaces it later
+     * a job not started yet keeps its release, it is late at dispatch
+     * like a late job of the cooperative kernel instead of being lost
+     */
+    ptr_str_tcb->ptr_str_task = ptr_str_task;
+    if (FALSE == ptr_str_tcb->uint8_pending)
+    {
+        ptr_str_tcb->uint8_pending = TRUE;
+        (void)sos_job_release(ptr_str_task, gl_uint32_sys_ticks, &ptr_str_tcb->uint32_job_release_tick);
+    }
+    else
+    {
+        /* a chain release waits for the running job */
+    }
+    sos_advance_release(ptr_str_task, gl_uint32_sys_ticks, SOS_TASK_DEFAULT_PERIOD);
+}
+
+/**
+ * @brief a private function to find the highest priority released task of the
+ *		  active mode that may preempt the given task
+ *
+ * @param uint8_running_task_id : task that would be preempted, SOS_TASK_ID_IDLE
+ *								  for the idle task
+ *
+ * @return task ID to start, SOS_TASK_ID_IDLE if none
+ */
+static uint8_t_ sos_kernel_pick(uint8_t_ uint8_running_task_id)
+{
+    str_sos_task_db_t_ * ptr_str_db = gl_ptr_str_active_db;
+    str_sos_task_t_ * ptr_str_task;
+    uint8_t_ uint8_task_id = SOS_TASK_ID_IDLE;
+    uint8_t_ uint8_running_priority = SOS_SYNC_NO_CEILING;
+    uint8_t_ uint8_group_start = 0;
+    uint8_t_ uint8_group_end = 0;
+
+    if (SOS_TASK_ID_IDLE != uint8_running_task_id)
+    {
+        /* a mutex owner runs at the mutex ceiling (immediate priority ceiling) */
+        uint8_running_priority = gl_arr_str_tcb[uint8_running_task_id].ptr_str_task->uint8_task_priority;
+        if (gl_arr_uint8_sync_ceiling[uint8_running_task_id] < uint8_running_priority)
+        {
+            uint8_running_priority = gl_arr_uint8_sync_ceiling[uint8_running_task_id];
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* DB is sorted by priority, the first released task is the best candidate, equal priorities in turn */
+    for (uint8_t_ uint8_looping_variable = 0; uint8_looping_variable < ptr_str_db->uint8_number_of_tasks_added; uint8_looping_variable++)
+    {
+        if (uint8_looping_variable >= uint8_group_end)
+        {
+            uint8_group_start   = uint8_looping_variable;
+            uint8_group_end     = sos_rr_group_end(ptr_str_db, uint8_group_start);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        ptr_str_task = ptr_str_db->arr_ptr_str_task[uint8_group_start +
+                ((uint8_looping_variable - uint8_group_start + ptr_str_db->arr_uint8_rr_first[uint8_group_start])
+                 % (uint8_group_end - uint8_group_start))];
+
+        if (
+                (SOS_TASK_ID_IDLE != uint8_running_task_id) &&
+                (ptr_str_task->uint8_task_priority >= uint8_running_priority)
+                )
+        {
+            /* equal or lower priority never preempts */
+            break;
+        }
+        else if (
+                (TRUE == gl_arr_str_tcb[ptr_str_task->uint8_task_id].uint8_pending) &&
+                (SOS_TCB_IDLE == gl_arr_str_tcb[ptr_str_task->uint8_task_id].enu_state)
+                )
+        {
+            uint8_task_id = ptr_str_task->uint8_task_id;
+            break;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return uint8_task_id;
+}
+
+/**
+ * @brief a private function to start a released job on a fresh context
+ *
+ * @param uint8_task_id         : task to start
+ * @param uint8_preempted_id    : task to resume when the job ends
+ * @param ptr_str_from          : where to save the running context
+ *
+ * @return
+ */
+static void sos_kernel_start_task(uint8_t_ uint8_task_id, uint8_t_ uint8_preempted_id, str_sos_port_context_t_ * ptr_str_from)
+{
+    str_sos_tcb_t_ * ptr_str_tcb = &gl_arr_str_tcb[uint8_task_id];
+
+    ptr_str_tcb->enu_state          = SOS_TCB_RUNNING;
+    ptr_str_tcb->uint8_preempted_id = uint8_preempted_id;
+    sos_port_init_context(&ptr_str_tcb->str_context, gl_arr_uint8_task_stack[uint8_task_id],
+                          sizeof(gl_arr_uint8_task_stack[uint8_task_id]), sos_kernel_task_entry);
+
+    gl_uint8_current_task_id = uint8_task_id;
+    sos_port_switch_context(ptr_str_from, &ptr_str_tcb->str_context);
+}
+
+/**
+ * @brief entry point of every job context, runs the task with interrupts
+ *		  enabled, then hands the CPU to the next released task or back to
+ *		  the preempted one, never returns
+ *
+ * @return
+ */
+static void sos_kernel_task_entry(void)
+{
+    uint8_t_ uint8_task_id = gl_uint8_current_task_id;
+    str_sos_tcb_t_ * ptr_str_tcb = &gl_arr_str_tcb[uint8_task_id];
+    uint8_t_ uint8_preempted_id = ptr_str_tcb->uint8_preempted_id;
+    uint8_t_ uint8_next_task_id;
+    uint16_t_ uint16_delay;
+    uint32_t_ uint32_release;
+
+    do
+    {
+        ptr_str_tcb->enu_state      = SOS_TCB_RUNNING;
+        ptr_str_tcb->uint8_pending  = FALSE;
+        /* a release during the job (overrun) overwrites the TCB copy */
+        uint32_release              = ptr_str_tcb->uint32_job_release_tick;
+
+        if (TRUE == sos_deadline_dispatch(ptr_str_tcb->ptr_str_task, uint32_release, gl_uint32_sys_ticks))
+        {
+            gl_ptr_str_running_task     = ptr_str_tcb->ptr_str_task;
+            sos_record_dispatch_latency(ptr_str_tcb->ptr_str_task, uint32_release);
+            SOS_SCM(scm_dispatch(ptr_str_tcb->ptr_str_task->uint8_task_id, gl_uint32_sys_ticks));
+
+            sei();
+            dwq_drain();    /* deferred ISR work goes before any job */
+            SOS_PORT_TRACE_JOB(ptr_str_tcb->ptr_str_task->uint8_task_id, TRUE);
+            uint16_delay = ptr_str_tcb->ptr_str_task->ptr_func_task();
+            cli();
+            SOS_PORT_TRACE_JOB(ptr_str_tcb->ptr_str_task->uint8_task_id, FALSE);
+            SOS_SCM(scm_complete(ptr_str_tcb->ptr_str_task->uint8_task_id, uint32_release, uint16_delay));
+
+            if (SOS_TASK_DEFAULT_PERIOD == uint16_delay)
+            {
+                /* already moved by one period at release */
+            }
+            else if (0 != gl_arr_uint16_chain_predecessors[uint8_task_id])
+            {
+                /* released by its predecessors, the next chain run is held back from now */
+                sos_advance_release(ptr_str_tcb->ptr_str_task, gl_uint32_sys_ticks, uint16_delay);
+            }
+            else
+            {
+                ptr_str_tcb->ptr_str_task->uint32_task_release_tick = uint32_release + uint16_delay;
+            }
+            sos_deadline_complete(ptr_str_tcb->ptr_str_task, uint32_release, gl_uint32_sys_ticks);
+            sos_chain_complete(ptr_str_tcb->ptr_str_task, uint32_release);
+        }
+        else
+        {
+            /* job shed, the release already moved by one period */
+            SOS_SCM(scm_skip(ptr_str_tcb->ptr_str_task->uint8_task_id, gl_uint32_sys_ticks));
+        }
+
+        ptr_str_tcb->enu_state = SOS_TCB_IDLE;
+        uint8_next_task_id = sos_kernel_pick(uint8_preempted_id);
+    }
+    while (uint8_next_task_id == uint8_task_id);    /* overrun, run the next job on the same context */
+
+    if (SOS_TASK_ID_IDLE != uint8_next_task_id)
+    {
+        sos_kernel_start_task(uint8_next_task_id, uint8_preempted_id, &gl_str_exit_context);
+    }
+    else
+    {
+        gl_uint8_current_task_id = uint8_preempted_id;
+        gl_ptr_str_running_task  = (SOS_TASK_ID_IDLE == uint8_preempted_id) ?
+                                   NULL_PTR : gl_arr_str_tcb[uint8_preempted_id].ptr_str_task;
+        sos_port_switch_context(&gl_str_exit_context,
+                                (SOS_TASK_ID_IDLE == uint8_preempted_id) ?
+                                &gl_str_idle_context : &gl_arr_str_tcb[uint8_preempted_id].str_context);
+    }
+}
+#endif
+
+
+/**
+ * @author                              :   Hossam Elwahsh
+ *
+ * @brief                               :   Generates a new unique ID for SOS task, IDs are unique across all
+ *                                          modes, a task already registered in another mode keeps its ID
+ *
+ * @param[in]   ptr_str_task            :   Task to generate the ID for
+ * @param[out]  uint8_new_task_id       :   Generated task ID
+ *
+ * @return  SOS_STATUS_SUCCESS          :   Success,    Task ID generated successfully
+ *          SOS_STATUS_DATABASE_FULL    :   Failed,     DB full, all unique IDs are in-use
+ *          SOS_STATUS_INVALID_STATE    :   Failed,     SOS Invalid State (uninitialized)
+ */
+static enu_sos_status_t_    sos_generate_task_id(str_sos_task_t_ * ptr_str_task, uint8_t_ * uint8_new_task_id)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_SUCCESS;
+
+    // SOS System State Check
+    if(gl_enu_sos_scheduler_state == SOS_SCHEDULER_UNINITIALIZED)
+    {
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else
+    {
+        /* generate a new task ID */
+
+        uint8_t_ uint8_generated = FALSE;       // generated flag
+
+        // IDs Maps
+        // 0(false): unused, 1(true): used
+        uint8_t_ uint8_ids_map[SOS_NUMBER_OF_TASK_IDS] = {FALSE};
+
+        // Calculate ids map of all modes DBs O(n * modes)
+        for (uint8_t_ uint8_mode_id = 0; uint8_mode_id < SOS_NUMBER_OF_MODES; ++uint8_mode_id) {
+            str_sos_task_db_t_ * ptr_str_db = &gl_arr_str_task_db[uint8_mode_id];
+
+            for (uint8_t_ i = 0; i < ptr_str_db->uint8_number_of_tasks_added; ++i) {
+                if(ptr_str_task == ptr_str_db->arr_ptr_str_task[i])
+                {
+                    // task shared with another mode, keep its ID
+                    *uint8_new_task_id = ptr_str_task->uint8_task_id;
+                    uint8_generated = TRUE;
+                }
+                else
+                {
+                    uint8_ids_map[ptr_str_db->arr_ptr_str_task[i]->uint8_task_id] = TRUE;
+                }
+            }
+        }
+
+        // Get first unused ID, worst case: O(n)
+        for (uint8_t_ id = 0; (FALSE == uint8_generated) && (id < SOS_NUMBER_OF_TASK_IDS); ++id) {
+            if(FALSE == uint8_ids_map[id])
+            {
+                *uint8_new_task_id = id;
+                uint8_generated = TRUE;
+                break;
+            }
+        }
+
+        if(FALSE == uint8_generated) // all possible ID numbers are in use == database is full
+        {
+            // DB Full
+            enu_sos_status_retval = SOS_STATUS_DATABASE_FULL;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return enu_sos_status_retval;
+}
+
+
+/**
+ * @brief a private function to check that a task ID is in use by any mode
+ *
+ * @param uint8_task_id : task ID to look for
+ *
+ * @return TRUE if found, FALSE otherwise
+ */
+static uint8_t_ sos_task_registered(uint8_t_ uint8_task_id)
+{
+    uint8_t_ bool_found = FALSE;
+    str_sos_task_t_ * ptr_str_task = NULL_PTR;
+    uint8_t_ uint8_task_index_in_db = 0;
+
+    for (uint8_t_ uint8_mode_id = 0; (FALSE == bool_found) && (uint8_mode_id < SOS_NUMBER_OF_MODES); ++uint8_mode_id)
+    {
+        if(SOS_STATUS_SUCCESS == sos_find_task(&gl_arr_str_task_db[uint8_mode_id], uint8_task_id, &ptr_str_task, &uint8_task_index_in_db))
+        {
+            bool_found = TRUE;
+        }
+        else
+        {
+            /* Task not in this mode */
+        }
+    }
+
+    return bool_found;
+}
+
+/**
+ * @brief a private function to check if a task can be reached from another
+ *		  one following successor links, used to keep the chains acyclic
+ *
+ * @param uint8_from_task_id : first task of the walk
+ * @param uint8_to_task_id   : task to look for
+ *
+ * @return TRUE if reachable, FALSE otherwise
+ */
+static uint8_t_ sos_chain_reaches(uint8_t_ uint8_from_task_id, uint8_t_ uint8_to_task_id)
+{
+    uint16_t_ uint16_visited    = 0;
+    uint16_t_ uint16_frontier   = SOS_TASK_ID_BIT(uint8_from_task_id);
+    uint16_t_ uint16_next;
+
+    /* breadth first walk over the successor masks, O(IDs^2) at most */
+    while(0 != uint16_frontier)
+    {
+        uint16_visited |= uint16_frontier;
+        uint16_next = 0;
+
+        for (uint8_t_ uint8_task_id = 0; uint8_task_id < SOS_NUMBER_OF_TASK_IDS; ++uint8_task_id)
+        {
+            if(0 != (uint16_frontier & SOS_TASK_ID_BIT(uint8_task_id)))
+            {
+                uint16_next |= gl_arr_uint16_chain_successors[uint8_task_id];
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        uint16_frontier = uint16_next & ~uint16_visited;
+    }
+
+    return (0 != (uint16_visited & SOS_TASK_ID_BIT(uint8_to_task_id))) ? TRUE : FALSE;
+}
+
+/**
+ * @brief a private function to drop every chain link of a task
+ *
+ * @param uint8_task_id : task ID to unlink
+ *
+ * @return
+ */
+static void sos_chain_remove_task(uint8_t_ uint8_task_id)
+{
+    for (uint8_t_ uint8_other_task_id = 0; uint8_other_task_id < SOS_NUMBER_OF_TASK_IDS; ++uint8_other_task_id)
+    {
+        gl_arr_uint16_chain_successors[uint8_other_task_id]     &= ~SOS_TASK_ID_BIT(uint8_task_id);
+        gl_arr_uint16_chain_predecessors[uint8_other_task_id]   &= ~SOS_TASK_ID_BIT(uint8_task_id);
+        gl_arr_uint16_chain_arrived[uint8_other_task_id]        &= ~SOS_TASK_ID_BIT(uint8_task_id);
+    }
+    gl_arr_uint16_chain_successors[uint8_task_id]       = 0;
+    gl_arr_uint16_chain_predecessors[uint8_task_id]     = 0;
+    gl_arr_uint16_chain_arrived[uint8_task_id]          = 0;
+    gl_arr_uint32_chain_max_latency_us[uint8_task_id]   = 0;
+    gl_uint16_chain_ready                               &= ~SOS_TASK_ID_BIT(uint8_task_id);
+}
+
+/**
+ * @brief a private function to phase a task that was just chained or unchained,
+ *		  the task object is shared by every mode it is in
+ *
+ * @param uint8_task_id : task ID
+ *
+ * @return
+ */
+static void sos_chain_phase_task(uint8_t_ uint8_task_id)
+{
+    str_sos_task_t_ * ptr_str_task = NULL_PTR;
+    uint8_t_ uint8_task_index_in_db = 0;
+
+    for (uint8_t_ uint8_mode_id = 0; uint8_mode_id < SOS_NUMBER_OF_MODES; ++uint8_mode_id)
+    {
+        if(SOS_STATUS_SUCCESS == sos_find_task(&gl_arr_str_task_db[uint8_mode_id], uint8_task_id, &ptr_str_task, &uint8_task_index_in_db))
+        {
+            sos_phase_task(ptr_str_task);
+            break;
+        }
+        else
+        {
+            /* Task not in this mode */
+        }
+    }
+}
+
+/**
+ * @brief a private function called when a task finished, releases every
+ *		  successor whose predecessors are now all done
+ *
+ * @param ptr_str_task      : the task that finished
+ * @param uint32_release    : release tick of the job that finished, the one of
+ *							  the chain run
+ *
+ * @return
+ */
+static void sos_chain_complete(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_release)
+{
+    uint8_t_ uint8_task_id = ptr_str_task->uint8_task_id;
+    uint16_t_ uint16_successors = gl_arr_uint16_chain_successors[uint8_task_id];
+    uint32_t_ uint32_latency_us = 0;
+
+    if (
+            (0 != gl_arr_uint16_chain_predecessors[uint8_task_id]) &&
+            (TIMER_OK == timer_get_elapsed_us(TIMER_0, &uint32_latency_us)) &&
+            (uint32_latency_us > gl_arr_uint32_chain_max_latency_us[uint8_task_id])
+            )
+    {
+        /* end to end latency up to this stage of the chain */
+        gl_arr_uint32_chain_max_latency_us[uint8_task_id] = uint32_latency_us;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    for (uint8_t_ uint8_successor_id = 0; (0 != uint16_successors) && (uint8_successor_id < SOS_NUMBER_OF_TASK_IDS); ++uint8_successor_id)
+    {
+        if(0 != (uint16_successors & SOS_TASK_ID_BIT(uint8_successor_id)))
+        {
+            uint16_successors &= ~SOS_TASK_ID_BIT(uint8_successor_id);
+            gl_arr_uint16_chain_arrived[uint8_successor_id] |= SOS_TASK_ID_BIT(uint8_task_id);
+
+            if(gl_arr_uint16_chain_arrived[uint8_successor_id] == gl_arr_uint16_chain_predecessors[uint8_successor_id])
+            {
+                gl_arr_uint16_chain_arrived[uint8_successor_id] = 0;
+
+                str_sos_task_t_ * ptr_str_successor = NULL_PTR;
+                uint8_t_ uint8_task_index_in_db = 0;
+
+                if(SOS_STATUS_SUCCESS == sos_find_task(gl_ptr_str_active_db, uint8_successor_id, &ptr_str_successor, &uint8_task_index_in_db))
+                {
+                    /* dispatched like a released job, as soon as its priority and sync state allow */
+                    gl_arr_uint32_chain_release[uint8_successor_id] = uint32_release;
+                    gl_uint16_chain_ready |= SOS_TASK_ID_BIT(uint8_successor_id);
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+                    if (
+                            (TRUE == sos_task_due(ptr_str_successor, gl_uint32_sys_ticks)) &&
+                            (NULL_PTR != ptr_str_successor->ptr_func_task)
+                            )
+                    {
+                        sos_kernel_release(ptr_str_successor);
+                    }
+                    else
+                    {
+                        /* blocked or held back by a returned delay, released by a later tick */
+                    }
+#endif
+                }
+                else
+                {
+                    /* successor not in the active mode */
+                }
+            }
+            else
+            {
+                /* waiting for other predecessors */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief a private function to run the released successors of the current
+ *		  pass, highest priority first, until the chains are drained, a
+ *		  blocked successor or one held back by a returned delay keeps its
+ *		  release for a later pass
+ *
+ * @param uint32_now : tick of the scheduler pass
+ *
+ * @return
+ */
+static void sos_chain_run_ready(uint32_t_ uint32_now)
+{
+    str_sos_task_db_t_ * ptr_str_db = gl_ptr_str_active_db;
+    str_sos_task_t_ * ptr_str_task;
+    uint8_t_ bool_found = (0 != gl_uint16_chain_ready) ? TRUE : FALSE;
+
+    while(TRUE == bool_found)
+    {
+        bool_found = FALSE;
+
+        for (uint8_t_ uint8_looping_variable = 0; uint8_looping_variable < ptr_str_db->uint8_number_of_tasks_added; uint8_looping_variable++)
+        {
+            ptr_str_task = ptr_str_db->arr_ptr_str_task[uint8_looping_variable];
+
+            if(
+                    (0 != (gl_uint16_chain_ready & SOS_TASK_ID_BIT(ptr_str_task->uint8_task_id))) &&
+                    (TRUE == sos_task_due(ptr_str_task, uint32_now))
+                    )
+            {
+                sos_run_job(ptr_str_task, uint32_now);
+
+                bool_found = TRUE;
+                break;      /* rescan, the task may have released better ones */
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+}
+
+/**
+ * @brief a private function to register the running task as a waiter, the
+ *		  scheduler skips it until sos_sync_wake, called in a sync section
+ *
+ * @param ptr_uint16_waiters : waiters mask of the object
+ *
+ * @return SOS_STATUS_WOULD_BLOCK, SOS_STATUS_INVALID_STATE outside of a task
+ */
+static enu_sos_status_t_ sos_sync_block(uint16_t_ * ptr_uint16_waiters)
+{
+    enu_sos_status_t_ enu_sos_status_retval = SOS_STATUS_WOULD_BLOCK;
+    str_sos_task_t_ * ptr_str_task = gl_ptr_str_running_task;
+
+    if(NULL_PTR == ptr_str_task)
+    {
+        /* ISR or main loop, can not wait */
+        enu_sos_status_retval = SOS_STATUS_INVALID_STATE;
+    }
+    else
+    {
+        *ptr_uint16_waiters                                     |= SOS_TASK_ID_BIT(ptr_str_task->uint8_task_id);
+        gl_arr_ptr_str_sync_task[ptr_str_task->uint8_task_id]   = ptr_str_task;
+        gl_arr_uint8_sync_state[ptr_str_task->uint8_task_id]    = SOS_SYNC_BLOCKED;
+        SOS_SCM(scm_block(ptr_str_task->uint8_task_id));
+    }
+
+    return enu_sos_status_retval;
+}
+
+/**
+ * @brief a private function to release a waiter, it runs on the next scheduler
+ *		  pass (cooperative) or tick (preemptive) even if not due by its period
+ *
+ * @param uint8_task_id : waiter to release
+ *
+ * @return
+ */
+static void sos_sync_wake(uint8_t_ uint8_task_id)
+{
+    gl_arr_uint8_sync_state[uint8_task_id] = SOS_SYNC_WOKEN;
+    SOS_SCM(scm_wake(uint8_task_id));
+}
+
+/**
+ * @brief a private function to remove the highest priority waiter that is
+ *		  still blocked from a waiters mask, stale bits (deleted or released
+ *		  tasks) are dropped on the way
+ *
+ * @param ptr_uint16_waiters : waiters mask of the object
+ *
+ * @return waiter task ID, SOS_SYNC_NO_OWNER if none
+ */
+static uint8_t_ sos_sync_pick_waiter(uint16_t_ * ptr_uint16_waiters)
+{
+    uint8_t_ uint8_best_id = SOS_SYNC_NO_OWNER;
+
+    for (uint8_t_ uint8_task_id = 0; (0 != *ptr_uint16_waiters) && (uint8_task_id < SOS_NUMBER_OF_TASK_IDS); ++uint8_task_id)
+    {
+        if(0 == (*ptr_uint16_waiters & SOS_TASK_ID_BIT(uint8_task_id)))
+        {
+            /* Do Nothing */
+        }
+        else if(SOS_SYNC_BLOCKED != gl_arr_uint8_sync_state[uint8_task_id])
+        {
+            *ptr_uint16_waiters &= ~SOS_TASK_ID_BIT(uint8_task_id);
+        }
+        else if(
+                (SOS_SYNC_NO_OWNER == uint8_best_id) ||
+                (gl_arr_ptr_str_sync_task[uint8_task_id]->uint8_task_priority <
+                 gl_arr_ptr_str_sync_task[uint8_best_id]->uint8_task_priority)
+                )
+        {
+            uint8_best_id = uint8_task_id;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    if(SOS_SYNC_NO_OWNER != uint8_best_id)
+    {
+        *ptr_uint16_waiters &= ~SOS_TASK_ID_BIT(uint8_best_id);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return uint8_best_id;
+}
+
+/**
+ * @brief a private function to give a mutex to a task and raise the task to
+ *		  the mutex ceiling, called in a sync section
+ *
+ * @param ptr_str_mutex : mutex to give
+ * @param uint8_task_id : new owner
+ *
+ * @return
+ */
+static void sos_mutex_take_ownership(str_sos_mutex_t_ * ptr_str_mutex, uint8_t_ uint8_task_id)
+{
+    ptr_str_mutex->uint8_owner_id       = uint8_task_id;
+    ptr_str_mutex->uint8_owner_ceiling  = gl_arr_uint8_sync_ceiling[uint8_task_id];
+
+    if(ptr_str_mutex->uint8_ceiling < gl_arr_uint8_sync_ceiling[uint8_task_id])
+    {
+        gl_arr_uint8_sync_ceiling[uint8_task_id] = ptr_str_mutex->uint8_ceiling;
+    }
+    else
+    {
+        /* already at an equal or higher ceiling */
+    }
+}
+
+/**
+ * @brief a private function to drop the wait state and mutex ceiling of a
+ *		  task ID that left every mode
+ *
+ * @param uint8_task_id : task ID to forget
+ *
+ * @return
+ */
+static void sos_sync_forget_task(uint8_t_ uint8_task_id)
+{
+    gl_arr_uint8_sync_state[uint8_task_id]      = SOS_SYNC_RUNNABLE;
+    gl_arr_uint8_sync_ceiling[uint8_task_id]    = SOS_SYNC_NO_CEILING;
+}
+
+/**
+ * @brief a private function to decide whether the scheduler runs a task of
+ *		  the active mode now, due by its release tick or released by a sync
+ *		  object, a task waiting on a sync object is skipped, a chained task
+ *		  also needs a release by its predecessors
+ *
+ * @param ptr_str_task  : task to check
+ * @param uint32_now    : current system tick
+ *
+ * @return TRUE if the task has to run
+ */
+static uint8_t_ sos_task_due(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_now)
+{
+    uint8_t_ uint8_task_id = ptr_str_task->uint8_task_id;
+    uint8_t_ uint8_state = gl_arr_uint8_sync_state[uint8_task_id];
+
+    return (uint8_t_)(
+            (SOS_SYNC_BLOCKED != uint8_state) &&
+            (
+                    (SOS_SYNC_WOKEN == uint8_state) ||
+                    (
+                            (
+                                    (0 == gl_arr_uint16_chain_predecessors[uint8_task_id]) ||
+                                    (0 != (gl_uint16_chain_ready & SOS_TASK_ID_BIT(uint8_task_id)))
+                            ) &&
+                            (SOS_TICK_REACHED(uint32_now, ptr_str_task->uint32_task_release_tick))
+                    )
+            ));
+}
+
+/**
+ * @brief a private function to find the release tick of the job a task starts
+ *		  now, the one of its period or of the chain run that released it, a
+ *		  chain release is consumed
+ *
+ * @param ptr_str_task          : task about to start
+ * @param uint32_now            : current system tick
+ * @param ptr_uint32_release    : [out] release tick of the job, uint32_now for
+ *								  an extra run woken by a sync object
+ *
+ * @return TRUE for a released job, FALSE for an extra run woken by a sync object
+ */
+static uint8_t_ sos_job_release(str_sos_task_t_ * ptr_str_task, uint32_t_ uint32_now, uint32_t_ * ptr_uint32_release)
+{
+    uint8_t_ uint8_task_id = ptr_str_task->uint8_task_id;
+    uint8_t_ bool_released_job = TRUE;
+
+    if (0 != (gl_uint16_chain_ready & SOS_TASK_ID_BIT(uint8_task_id)))
+    {
+        gl_uint16_chain_ready   &= ~SOS_TASK_ID_BIT(uint8_task_id);
+        *ptr_uint32_release     = gl_arr_uint32_chain_release[uint8_task_id];
+    }
+    else if (
+            (0 == gl_arr_uint16_chain_predecessors[uint8_task_id]) &&
+            (SOS_TICK_REACHED(uint32_now, ptr_str_task->uint32_task_release_tick))
+            )
+    {
+        *ptr_uint32_release     = ptr_str_task->uint32_task_release_tick;
+    }
+    else
+    {
+        *ptr_uint32_release     = uint32_now;
+        bool_released_job       = FALSE;
+    }
+
+    return bool_released_job;
+}
+
+#if (TRUE == SOS_CONFORMANCE_MONITOR)
+/**
+ * @brief a private function to hand a task to the conformance monitor as it
+ *		  stands in the active mode now: released by its period, released by
+ *		  its chain predecessors or not there at all, called in a DB section
+ *
+ * @param uint8_task_id : task ID
+ *
+ * @return
+ */
+static void sos_scm_track(uint8_t_ uint8_task_id)
+{
+    str_sos_task_t_ * ptr_str_task = NULL_PTR;
+    uint8_t_ uint8_task_index_in_db = 0;
+
+    if (SOS_STATUS_SUCCESS != sos_find_task(gl_ptr_str_active_db, uint8_task_id, &ptr_str_task, &uint8_task_index_in_db))
+    {
+        scm_forget(uint8_task_id);
+    }
+    else if (0 != gl_arr_uint16_chain_predecessors[uint8_task_id])
+    {
+        scm_track(uint8_task_id, ptr_str_task->uint8_task_priority, SCM_EVENT_TASK, 0);
+    }
+    else
+    {
+        scm_track(uint8_task_id, ptr_str_task->uint8_task_priority,
+                  ptr_str_task->uint16_task_periodicity, ptr_str_task->uint32_task_release_tick);
+    }
+}
+#endif
+
+static uint32_t_ gcd(uint32_t_ uint32_first_var, uint32_t_ uint32_second_variable)
+{
+    // Declare and initialize a uint32_t variable named uint32_gcd_value to 0.
+    uint32_t_ uint32_gcd_value = 0;
+    // Declare a uint32_t variable named uint32_temp.
+    uint32_t_ uint32_temp;
+
+    // Start a while loop that continues until uint32_second_variable is not equal to 0.
+    while (uint32_second_variable != 0)
+    {
+        // Store the value of uint32_second_variable in uint32_temp.
+        uint32_temp = uint32_second_variable;
+        // Calculate the remainder of uint32_first_var
+        //  divided by uint32_second_variable and assign it to uint32_second_variable.
+        uint32_second_variable = uint32_first_var % uint32_second_variable;
+        // Assign the value of uint32_temp to uint32_first_var.
+        uint32_first_var = uint32_temp;
+    }
+
+    // Assign the value of uint32_first_var to uint32_gcd_value.
+    uint32_gcd_value = uint32_first_var;
+
+    // Return the calculated gcd value.
+    return uint32_gcd_value;
+}
+
+
+static uint32_t_ lcm(uint32_t_ uint32_first_var, uint32_t_ uint32_second_variable)
+{
+    // Declare and initialize a uint32_t variable named uint32_lcm_return_value to 0.
+    uint32_t_ uint32_lcm_return_value = 0;
+
+    // Declare and initialize an uint32_t variable named uint32_gcd_value to 0.
+    uint32_t_ uint32_gcd_value = 0;
+
+    // Call the gcd (Greatest Common Divisor) function
+    //  with uint32_first_var and uint32_second_variable as arguments
+    //  and assign the returned value to uint32_gcd_value.
+    uint32_gcd_value = gcd(uint32_first_var, uint32_second_variable);
+
+    // Calculate the least common multiple (lcm)
+    // by multiplying uint32_first_var and uint32_second_variable
+    // and then dividing the result by uint32_gcd_value.
+    // Assign the calculated value to uint32_lcm_return_value.
+    uint32_lcm_return_value = (uint32_first_var * uint32_second_variable) / uint32_gcd_value;
+
+    // Return the calculated lcm value.
+    return uint32_lcm_return_value;
+}
+
+
+static void calculate_hyper_period(str_sos_task_db_t_ * ptr_str_db)
+{
+    // Declare and initialize an uint8_t variable named uint8_looping_variable to 0.
+    uint8_t_ uint8_looping_variable = 0;
+
+    // An empty mode has no hyper-period, the scheduler treats every tick as a boundary.
+    if (0 == ptr_str_db->uint8_number_of_tasks_added)
+    {
+        ptr_str_db->uint32_hyper_period = 0;
+        return;
+    }
+
+    // Assign the value of uint16_task_periodicity from the first element of the
+    // mode DB tasks array to the mode DB hyper period.
+    ptr_str_db->uint32_hyper_period = ptr_str_db->arr_ptr_str_task[0]->uint16_task_periodicity;
+
+    // Start a for loop that iterates until uint8_looping_variable
+    // is less than the number of tasks in the mode DB,
+    // incrementing uint8_looping_variable after each iteration.
+    for (; uint8_looping_variable < ptr_str_db->uint8_number_of_tasks_added; uint8_looping_variable++)
+    {
+        // Update the value of the hyper period
+        // by finding the least common multiple (lcm)
+        // between the current value of the hyper period
+        // and the uint16_task_periodicity of the task
+        // pointed to by the arr_ptr_str_task[uint8_looping_variable].
+        // This basically calculates the hyper period of the first two tasks periodicity,
+        // then incrementally re-calculate the hyper period for the last result with the next task periodicity
+        // until all the tasks have been processed we get the final total least hyper-period for all tasks
+        ptr_str_db->uint32_hyper_period = lcm(ptr_str_db->uint32_hyper_period, ptr_str_db->arr_ptr_str_task[uint8_looping_variable]->uint16_task_periodicity);
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ * @fileName	:	swt_interface.h
+ * @Created		: 	1:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for the software timer service, one-shot and periodic
+ *					timeouts multiplexed on the Simple Operating System tick
+ *
+ * Timers are owned by the caller (static or global str_swt_timer_t_, zero initialized), the service
+ * only links them in a delta list sorted by expiry, so there is no limit on the
+ * number of timers and no SOS task is used per timeout.
+ * Callbacks run from the SOS scheduler (tick ISR in the preemptive kernel), keep
+ * them short, they may start/stop/restart any timer including their own.
+ */
+
+
+#ifndef SWT_INTERFACE_H_
+#define SWT_INTERFACE_H_
+
+#include "std.h"
+
+typedef void(*ptr_func_swt_callback_t_)(void);
+
+typedef enum
+{
+	SWT_STATUS_SUCCESS				= 0	,
+	SWT_STATUS_INVALID_ARGS				,
+	SWT_STATUS_NOT_RUNNING				,
+	SWT_STATUS_TOTAL
+}enu_swt_status_t_;
+
+typedef struct str_swt_timer_t_
+{
+	/** Owned by SWT */
+	struct str_swt_timer_t_ *	ptr_str_next;
+	uint16_t_					uint16_delta;			/* ticks after the previous timer in the list	*/
+	uint8_t_					uint8_running;
+	/** Set by swt_start */
+	uint16_t_					uint16_timeout;			/* first expiry, in SOS ticks					*/
+	uint16_t_					uint16_period;			/* reload after expiry, 0 for a one-shot timer	*/
+	ptr_func_swt_callback_t_	ptr_func_callback;
+}str_swt_timer_t_;
+
+
+/**
+ *	@brief		                            :	Initializes the software timer service, all timers are dropped,
+ *	                                            called by sos_init
+ */
+void swt_init(void);
+
+/**
+ *	@brief		                            :	Starts (or re-arms) a software timer
+ *  @param[in,out]  ptr_str_timer 	        :   Timer to start
+ *  @param[in]      uint16_timeout          :   Ticks until the first expiry (1 or more)
+ *  @param[in]      uint16_period           :   Ticks between the next expiries, 0 for a one-shot timer
+ *  @param[in]      ptr_func_callback       :   Called on every expiry
+ *
+ *  @Return     SWT_STATUS_SUCCESS		    :	Success
+ *              SWT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or zero timeout
+ */
+enu_swt_status_t_ swt_start(str_swt_timer_t_ * ptr_str_timer, uint16_t_ uint16_timeout,
+                            uint16_t_ uint16_period, ptr_func_swt_callback_t_ ptr_func_callback);
+
+/**
+ *	@brief		                            :	Stops a running software timer, its callback is not called
+ *  @param[in,out]  ptr_str_timer 	        :   Timer to stop
+ *
+ *  @Return     SWT_STATUS_SUCCESS		    :	Success
+ *              SWT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              SWT_STATUS_NOT_RUNNING      :   Failed,     Timer was not running
+ */
+enu_swt_status_t_ swt_stop(str_swt_timer_t_ * ptr_str_timer);
+
+/**
+ *	@brief		                            :	Re-arms a timer with the timeout and period of its last start,
+ *	                                            running or not (e.g. to extend a protocol timeout)
+ *  @param[in,out]  ptr_str_timer 	        :   Timer to restart, must have been started once
+ *
+ *  @Return     SWT_STATUS_SUCCESS		    :	Success
+ *              SWT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or timer never started
+ */
+enu_swt_status_t_ swt_restart(str_swt_timer_t_ * ptr_str_timer);
+
+/**
+ *	@brief		                            :	Gets whether a timer is running
+ *  @param[in]      ptr_str_timer 	        :   Timer to check
+ *  @param[out]     ptr_uint8_running       :   TRUE if running, FALSE otherwise
+ *
+ *  @Return     SWT_STATUS_SUCCESS		    :	Success
+ *              SWT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_swt_status_t_ swt_is_running(str_swt_timer_t_ * ptr_str_timer, uint8_t_ * ptr_uint8_running);
+
+/**
+ *	@brief		                            :	Counts one SOS tick, O(1), called from the tick ISR
+ */
+void swt_tick(void);
+
+/**
+ *	@brief		                            :	Handles the counted ticks and calls the callbacks of the expired
+ *	                                            timers, O(1) per tick when nothing expires, called by the SOS
+ *	                                            scheduler
+ */
+void swt_dispatch(void);
+
+#endif /* SWT_INTERFACE_H_ */
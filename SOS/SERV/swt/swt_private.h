@@ -0,0 +1,33 @@
+/**
+ * @fileName	:	swt_private.h
+ * @Created		: 	1:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Private file for the software timer service
+ */
+
+
+#ifndef SWT_PRIVATE_H_
+#define SWT_PRIVATE_H_
+
+#include "swt_interface.h"
+#include "sos_preconfig.h"
+#include "critical.h"
+
+/*
+ * The cooperative kernel dispatches from task context and the tick ISR only
+ * counts ticks, so the list needs no locking. The preemptive kernel dispatches
+ * from the tick ISR, list updates from tasks mask it (the section keeps
+ * interrupts disabled when a callback updates the list from the dispatcher).
+ */
+#if (SOS_KERNEL_MODE == SOS_KERNEL_PREEMPTIVE)
+#define SWT_LOCK(PTR_CRITICAL)		enter_critical((PTR_CRITICAL), CRITICAL_SITE_SWT)
+#define SWT_UNLOCK(PTR_CRITICAL)	exit_critical(PTR_CRITICAL)
+#else
+#define SWT_LOCK(PTR_CRITICAL)		((void)(PTR_CRITICAL))
+#define SWT_UNLOCK(PTR_CRITICAL)	((void)(PTR_CRITICAL))
+#endif
+
+static void swt_insert	(str_swt_timer_t_ * ptr_str_timer, uint16_t_ uint16_ticks);
+static void swt_remove	(str_swt_timer_t_ * ptr_str_timer);
+
+#endif /* SWT_PRIVATE_H_ */
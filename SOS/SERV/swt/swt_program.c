@@ -0,0 +1,287 @@
+/**
+ * @fileName	:	swt_program.c
+ * @Created		: 	1:05 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Program file for the software timer service
+ */
+#include "swt_private.h"
+
+static INSTANCE str_swt_timer_t_ *	gl_ptr_str_swt_head = NULL_PTR;			/* nearest expiry first */
+static INSTANCE volatile uint8_t_	gl_uint8_swt_ticks_counted = 0;			/* written by the tick ISR only */
+static INSTANCE uint8_t_			gl_uint8_swt_ticks_handled = 0;			/* written by the dispatcher only */
+
+/**
+ *	@brief		                            :	Initializes the software timer service, all timers are dropped,
+ *	                                            called by sos_init
+ */
+void swt_init(void)
+{
+    gl_ptr_str_swt_head         = NULL_PTR;
+    gl_uint8_swt_ticks_handled  = gl_uint8_swt_ticks_counted;
+}
+
+/**
+ *	@brief		                            :	Starts (or re-arms) a software timer
+ *  @param[in,out]  ptr_str_timer 	        :   Timer to start
+ *  @param[in]      uint16_timeout          :   Ticks until the first expiry (1 or more)
+ *  @param[in]      uint16_period           :   Ticks between the next expiries, 0 for a one-shot timer
+ *  @param[in]      ptr_func_callback       :   Called on every expiry
+ *
+ *  @Return     SWT_STATUS_SUCCESS		    :	Success
+ *              SWT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or zero timeout
+ */
+enu_swt_status_t_ swt_start(str_swt_timer_t_ * ptr_str_timer, uint16_t_ uint16_timeout,
+                            uint16_t_ uint16_period, ptr_func_swt_callback_t_ ptr_func_callback)
+{
+    enu_swt_status_t_ enu_swt_status_retval = SWT_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(
+            (NULL_PTR == ptr_str_timer)     ||
+            (NULL_PTR == ptr_func_callback) ||
+            (0 == uint16_timeout)
+            )
+    {
+        enu_swt_status_retval = SWT_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        SWT_LOCK(&lo_str_critical);
+        if(TRUE == ptr_str_timer->uint8_running)
+        {
+            swt_remove(ptr_str_timer);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        ptr_str_timer->uint16_timeout       = uint16_timeout;
+        ptr_str_timer->uint16_period        = uint16_period;
+        ptr_str_timer->ptr_func_callback    = ptr_func_callback;
+        swt_insert(ptr_str_timer, uint16_timeout);
+        SWT_UNLOCK(&lo_str_critical);
+    }
+
+    return enu_swt_status_retval;
+}
+
+/**
+ *	@brief		                            :	Stops a running software timer, its callback is not called
+ *  @param[in,out]  ptr_str_timer 	        :   Timer to stop
+ *
+ *  @Return     SWT_STATUS_SUCCESS		    :	Success
+ *              SWT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ *              SWT_STATUS_NOT_RUNNING      :   Failed,     Timer was not running
+ */
+enu_swt_status_t_ swt_stop(str_swt_timer_t_ * ptr_str_timer)
+{
+    enu_swt_status_t_ enu_swt_status_retval = SWT_STATUS_SUCCESS;
+    str_critical_t_ lo_str_critical;
+
+    if(NULL_PTR == ptr_str_timer)
+    {
+        enu_swt_status_retval = SWT_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        SWT_LOCK(&lo_str_critical);
+        if(TRUE == ptr_str_timer->uint8_running)
+        {
+            swt_remove(ptr_str_timer);
+        }
+        else
+        {
+            enu_swt_status_retval = SWT_STATUS_NOT_RUNNING;
+        }
+        SWT_UNLOCK(&lo_str_critical);
+    }
+
+    return enu_swt_status_retval;
+}
+
+/**
+ *	@brief		                            :	Re-arms a timer with the timeout and period of its last start,
+ *	                                            running or not (e.g. to extend a protocol timeout)
+ *  @param[in,out]  ptr_str_timer 	        :   Timer to restart, must have been started once
+ *
+ *  @Return     SWT_STATUS_SUCCESS		    :	Success
+ *              SWT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given or timer never started
+ */
+enu_swt_status_t_ swt_restart(str_swt_timer_t_ * ptr_str_timer)
+{
+    enu_swt_status_t_ enu_swt_status_retval = SWT_STATUS_SUCCESS;
+
+    if(NULL_PTR == ptr_str_timer)
+    {
+        enu_swt_status_retval = SWT_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        enu_swt_status_retval = swt_start(ptr_str_timer, ptr_str_timer->uint16_timeout,
+                                          ptr_str_timer->uint16_period, ptr_str_timer->ptr_func_callback);
+    }
+
+    return enu_swt_status_retval;
+}
+
+/**
+ *	@brief		                            :	Gets whether a timer is running
+ *  @param[in]      ptr_str_timer 	        :   Timer to check
+ *  @param[out]     ptr_uint8_running       :   TRUE if running, FALSE otherwise
+ *
+ *  @Return     SWT_STATUS_SUCCESS		    :	Success
+ *              SWT_STATUS_INVALID_ARGS     :   Failed,     Null pointer given
+ */
+enu_swt_status_t_ swt_is_running(str_swt_timer_t_ * ptr_str_timer, uint8_t_ * ptr_uint8_running)
+{
+    enu_swt_status_t_ enu_swt_status_retval = SWT_STATUS_SUCCESS;
+
+    if(
+            (NULL_PTR == ptr_str_timer) ||
+            (NULL_PTR == ptr_uint8_running)
+            )
+    {
+        enu_swt_status_retval = SWT_STATUS_INVALID_ARGS;
+    }
+    else
+    {
+        *ptr_uint8_running = ptr_str_timer->uint8_running;
+    }
+
+    return enu_swt_status_retval;
+}
+
+/**
+ *	@brief		                            :	Counts one SOS tick, O(1), called from the tick ISR
+ */
+void swt_tick(void)
+{
+    gl_uint8_swt_ticks_counted++;
+}
+
+/**
+ *	@brief		                            :	Handles the counted ticks and calls the callbacks of the expired
+ *	                                            timers, O(1) per tick when nothing expires, called by the SOS
+ *	                                            scheduler
+ */
+void swt_dispatch(void)
+{
+    str_swt_timer_t_ * ptr_str_expired;
+
+    /* ticks missed by a late scheduler pass are caught up here */
+    while(gl_uint8_swt_ticks_handled != gl_uint8_swt_ticks_counted)
+    {
+        gl_uint8_swt_ticks_handled++;
+
+        if(NULL_PTR != gl_ptr_str_swt_head)
+        {
+            /* only the head delta moves, the rest of the list is relative to it */
+            gl_ptr_str_swt_head->uint16_delta--;
+
+            while(
+                    (NULL_PTR != gl_ptr_str_swt_head) &&
+                    (0 == gl_ptr_str_swt_head->uint16_delta)
+                    )
+            {
+                ptr_str_expired = gl_ptr_str_swt_head;
+                swt_remove(ptr_str_expired);
+
+                /* re-arm before the callback so it may stop its own timer */
+                if(0 != ptr_str_expired->uint16_period)
+                {
+                    swt_insert(ptr_str_expired, ptr_str_expired->uint16_period);
+                }
+                else
+                {
+                    /* one-shot */
+                }
+
+                ptr_str_expired->ptr_func_callback();
+            }
+        }
+        else
+        {
+            /* no running timer */
+        }
+    }
+}
+
+/**
+ * @brief a private function to link a timer in the delta list, O(n) in the
+ *		  number of timers expiring before it
+ *
+ * @param ptr_str_timer : the timer to link (not in the list)
+ * @param uint16_ticks  : ticks until it expires
+ *
+ * @return
+ */
+static void swt_insert(str_swt_timer_t_ * ptr_str_timer, uint16_t_ uint16_ticks)
+{
+    str_swt_timer_t_ ** ptr_ptr_str_link = &gl_ptr_str_swt_head;
+
+    /* timers expiring at the same tick keep their start order */
+    while(
+            (NULL_PTR != *ptr_ptr_str_link) &&
+            ((*ptr_ptr_str_link)->uint16_delta <= uint16_ticks)
+            )
+    {
+        uint16_ticks -= (*ptr_ptr_str_link)->uint16_delta;
+        ptr_ptr_str_link = &((*ptr_ptr_str_link)->ptr_str_next);
+    }
+
+    ptr_str_timer->uint16_delta = uint16_ticks;
+    ptr_str_timer->ptr_str_next = *ptr_ptr_str_link;
+    ptr_str_timer->uint8_running = TRUE;
+
+    if(NULL_PTR != ptr_str_timer->ptr_str_next)
+    {
+        ptr_str_timer->ptr_str_next->uint16_delta -= uint16_ticks;
+    }
+    else
+    {
+        /* last timer */
+    }
+
+    *ptr_ptr_str_link = ptr_str_timer;
+}
+
+/**
+ * @brief a private function to unlink a running timer, its remaining delta
+ *		  is handed to the next timer
+ *
+ * @param ptr_str_timer : the timer to unlink (in the list)
+ *
+ * @return
+ */
+static void swt_remove(str_swt_timer_t_ * ptr_str_timer)
+{
+    str_swt_timer_t_ ** ptr_ptr_str_link = &gl_ptr_str_swt_head;
+
+    while(
+            (NULL_PTR != *ptr_ptr_str_link) &&
+            (ptr_str_timer != *ptr_ptr_str_link)
+            )
+    {
+        ptr_ptr_str_link = &((*ptr_ptr_str_link)->ptr_str_next);
+    }
+
+    if(NULL_PTR != *ptr_ptr_str_link)
+    {
+        if(NULL_PTR != ptr_str_timer->ptr_str_next)
+        {
+            ptr_str_timer->ptr_str_next->uint16_delta += ptr_str_timer->uint16_delta;
+        }
+        else
+        {
+            /* last timer */
+        }
+        *ptr_ptr_str_link = ptr_str_timer->ptr_str_next;
+    }
+    else
+    {
+        /* not linked */
+    }
+
+    ptr_str_timer->ptr_str_next = NULL_PTR;
+    ptr_str_timer->uint8_running = FALSE;
+}
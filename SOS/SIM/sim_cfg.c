@@ -0,0 +1,44 @@
+/**
+ * @fileName	:	sim_cfg.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Scripted pin changes of the host simulator
+ */
+
+#include "sim_cfg.h"
+
+/**
+ * Buttons of APP/app.h, both have external pull-downs and are active high:
+ * 			start button	PB2 (INT2, rising edge)
+ * 			stop button		PC4 (polled by the stop button task)
+ */
+const str_sim_stimulus_t_ arr_g_sim_stimuli[SIM_NUMBER_OF_STIMULI] =
+{
+		{
+				.uint32_time_ms	= 100	,
+				.enu_port		= SIM_PORT_B,
+				.uint8_pin		= 2		,
+				.uint8_level	= 1
+		},
+
+		{
+				.uint32_time_ms	= 300	,
+				.enu_port		= SIM_PORT_B,
+				.uint8_pin		= 2		,
+				.uint8_level	= 0
+		},
+
+		{
+				.uint32_time_ms	= 9000	,
+				.enu_port		= SIM_PORT_C,
+				.uint8_pin		= 4		,
+				.uint8_level	= 1
+		},
+
+		{
+				.uint32_time_ms	= 9500	,
+				.enu_port		= SIM_PORT_C,
+				.uint8_pin		= 4		,
+				.uint8_level	= 0
+		}
+};
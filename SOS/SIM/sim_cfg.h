@@ -0,0 +1,28 @@
+/**
+ * @fileName	:	sim_cfg.h
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Configuration file for the host simulator
+ */
+
+
+#ifndef SIM_CFG_H_
+#define SIM_CFG_H_
+
+#include "sim_interface.h"
+
+/* CPU clock of the emulated MCU, same as F_CPU of the timer driver */
+#define SIM_CPU_FREQ_HZ					8000000UL
+
+/* virtual cycles charged to every register access, the code in between is free */
+#define SIM_CYCLES_PER_ACCESS			4
+
+/* length of a run started by sim_init, 0 never ends */
+#define SIM_RUN_TIME_MS					10000
+
+#define SIM_NUMBER_OF_STIMULI			4
+
+/* in time order */
+extern const str_sim_stimulus_t_ arr_g_sim_stimuli[SIM_NUMBER_OF_STIMULI];
+
+#endif /* SIM_CFG_H_ */
@@ -0,0 +1,240 @@
+/**
+ * @fileName	:	sim_interface.h
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Interface file for the host simulator of the ATmega32 I/O
+ *
+ * Host builds only. Every REG8/REG16 access (LIB/registers.h) lands in an
+ * emulated register file, before the access the simulator charges
+ * SIM_CYCLES_PER_ACCESS CPU cycles to its virtual clock, brings TIMER_0/1/2
+ * and the port pins up to date and calls the pending ISRs whose enable bit
+ * and SREG I bit are set, in AVR vector order.
+ * Code between two register accesses takes no virtual time, sim_idle jumps
+ * the clock straight to the next timer interrupt or scripted pin change, so
+ * an idle system runs much faster than real time.
+ * In real time mode (sim_set_realtime, see sim_realtime.c) the virtual clock
+ * follows the host monotonic clock instead and sim_idle sleeps until the next
+ * event, the firmware runs as a real time Linux process.
+ */
+
+
+#ifndef SIM_INTERFACE_H_
+#define SIM_INTERFACE_H_
+
+#include "std.h"
+
+typedef enum
+{
+	SIM_PORT_A						= 0	,
+	SIM_PORT_B							,
+	SIM_PORT_C							,
+	SIM_PORT_D							,
+	SIM_PORT_TOTAL
+}enu_sim_port_t_;
+
+/* Pin level driven from outside the MCU at a given time, see sim_cfg.c */
+typedef struct
+{
+	uint32_t_			uint32_time_ms;
+	enu_sim_port_t_		enu_port;
+	uint8_t_			uint8_pin;
+	uint8_t_			uint8_level;
+}str_sim_stimulus_t_;
+
+/* Trace event rows, see sim_trace_open */
+#define SIM_TRACE_TRACK_ISR				1
+#define SIM_TRACE_TRACK_KERNEL			2
+#define SIM_TRACE_TRACK_BACKGROUND		3
+#define SIM_TRACE_TRACK_TASKS			16		/* + task ID */
+
+/* Environment variable holding the trace file path, sim_init opens it */
+#define SIM_TRACE_ENV					"SIM_TRACE"
+
+/* Environment variables holding the input log paths, sim_init opens them, see sim_replay.c */
+#define SIM_RECORD_ENV					"SIM_RECORD"
+#define SIM_REPLAY_ENV					"SIM_REPLAY"
+
+/* Environment variable, any value but "0" runs from sim_init on in real time */
+#define SIM_REALTIME_ENV				"SIM_REALTIME"
+
+/* Wake-up lateness of the real time clock, see sim_get_realtime_stats */
+typedef struct
+{
+	uint32_t_			uint32_wakes;				/* sim_idle sleeps ended by their event		*/
+	uint32_t_			uint32_late_min_ns;
+	uint32_t_			uint32_late_max_ns;
+	uint64_t_			uint64_late_total_ns;
+}str_sim_realtime_stats_t_;
+
+/* Called once the virtual time reaches the end of the run */
+typedef void(*ptr_func_sim_end_t_)(void);
+
+
+/**
+ *	@brief		                            :	Resets the register file and the virtual clock, loads the stimuli of
+ *	                                            sim_cfg.c and ends the run after SIM_RUN_TIME_MS with a report
+ */
+void sim_init(void);
+
+/**
+ *	@brief		                            :	Drives an input pin from outside, a change on INT0 (PD2), INT1 (PD3)
+ *	                                            or INT2 (PB2) raises the external interrupt like on the chip
+ *  @param[in]      enu_port                :   Port of the pin
+ *  @param[in]      uint8_pin               :   Pin number 0 -> 7
+ *  @param[in]      uint8_level             :   0 low, otherwise high
+ */
+void sim_set_pin(enu_sim_port_t_ enu_port, uint8_t_ uint8_pin, uint8_t_ uint8_level);
+
+/**
+ *	@brief		                            :	Waits for the next interrupt, returns at once if an interrupt ran
+ *	                                            since the previous call, otherwise moves the virtual clock to the
+ *	                                            next enabled timer event or stimulus and serves it
+ */
+void sim_idle(void);
+
+/**
+ *	@brief		                            :	Charges computation time that has no register access (busy loops)
+ *  @param[in]      uint32_cycles           :   CPU cycles
+ */
+void sim_consume_cycles(uint32_t_ uint32_cycles);
+
+/**
+ *	@brief		                            :	Gets the virtual time
+ *
+ *  @Return     CPU cycles since sim_init
+ */
+uint64_t_ sim_get_cycles(void);
+
+/**
+ *	@brief		                            :	Gets the virtual time skipped by sim_idle, the time the MCU had
+ *	                                            nothing to do. sim_get_cycles minus this is the busy time
+ *
+ *  @Return     CPU cycles since sim_init
+ */
+uint64_t_ sim_get_idle_cycles(void);
+
+/**
+ *	@brief		                            :	Gets the longest time the interrupts stayed masked (I bit of SREG
+ *	                                            cleared: ISRs, cli/sei pairs, critical sections), seen at the
+ *	                                            register accesses, since sim_init or sim_clear_masked_max
+ *
+ *  @Return     CPU cycles
+ */
+uint64_t_ sim_get_masked_max_cycles(void);
+
+/**
+ *	@brief		                            :	Restarts the longest masked time, a masked span in progress counts from now
+ */
+void sim_clear_masked_max(void);
+
+/**
+ *	@brief		                            :	Replaces the end of the run
+ *  @param[in]      uint32_end_ms           :   Virtual time to end at, 0 never ends
+ *  @param[in]      ptr_func_end            :   Called at the end, NULL_PTR prints sim_report and exits
+ */
+void sim_set_end(uint32_t_ uint32_end_ms, ptr_func_sim_end_t_ ptr_func_end);
+
+/**
+ *	@brief		                            :	Prints the virtual/host time, the interrupts served per vector and the
+ *	                                            output pins that changed
+ */
+void sim_report(void);
+
+/**
+ *	@brief		                            :	Starts writing a Chrome/Perfetto trace event JSON file (chrome://tracing,
+ *	                                            ui.perfetto.dev) of the run, closed at exit. Every served interrupt is
+ *	                                            a slice named after its vector on the interrupts row, SOS adds its
+ *	                                            jobs and scheduler states. sim_init calls it with $SIM_TRACE if set
+ *  @param[in]      ptr_str_path            :   File path
+ *
+ *  @Return     TRUE if the file was opened, FALSE if it can't be or a trace is already open
+ */
+uint8_t_ sim_trace_open(const char * ptr_str_path);
+
+/**
+ *	@brief		                            :	Ends the trace file, nothing if none is open
+ */
+void sim_trace_close(void);
+
+/**
+ *	@brief		                            :	Opens a slice on a row at the current virtual time, slices of a row nest
+ *  @param[in]      uint16_track            :   SIM_TRACE_TRACK_x
+ *  @param[in]      ptr_str_name            :   Slice name
+ */
+void sim_trace_begin(uint16_t_ uint16_track, const char * ptr_str_name);
+
+/**
+ *	@brief		                            :	Closes the last slice opened on a row
+ *  @param[in]      uint16_track            :   SIM_TRACE_TRACK_x
+ */
+void sim_trace_end(uint16_t_ uint16_track);
+
+/**
+ *	@brief		                            :	Marks an instant on a row
+ *  @param[in]      uint16_track            :   SIM_TRACE_TRACK_x
+ *  @param[in]      ptr_str_name            :   Event name
+ */
+void sim_trace_instant(uint16_t_ uint16_track, const char * ptr_str_name);
+
+/**
+ *	@brief		                            :	Sets a counter, drawn as a step graph above the rows
+ *  @param[in]      ptr_str_name            :   Counter name
+ *  @param[in]      uint32_value            :   New value
+ */
+void sim_trace_counter(const char * ptr_str_name, uint32_t_ uint32_value);
+
+/**
+ *	@brief		                            :	Tells the trace the CPU leaves the running context, the interrupt
+ *	                                            being served (if any) ends here and not when its context resumes
+ */
+void sim_trace_switch(void);
+
+/**
+ *	@brief		                            :	Starts logging the external inputs, every INT0/1/2 flag raised and every
+ *	                                            new value read from a PINx register, with its virtual time. Closed at
+ *	                                            exit, sim_init calls it with $SIM_RECORD if set
+ *  @param[in]      ptr_str_path            :   File path
+ *
+ *  @Return     TRUE if the file was opened, FALSE if it can't be or a log is already open
+ */
+uint8_t_ sim_record_open(const char * ptr_str_path);
+
+/**
+ *	@brief		                            :	Ends the input log, nothing if none is open
+ */
+void sim_record_close(void);
+
+/**
+ *	@brief		                            :	Loads an input log written by sim_record_open, from the next sim_init
+ *	                                            on the external interrupts and PINx reads come from the log at the
+ *	                                            logged virtual times. sim_init calls it with $SIM_REPLAY if set
+ *  @param[in]      ptr_str_path            :   File path
+ *
+ *  @Return     TRUE if the log was loaded, FALSE if it can't be or a log is already loaded
+ */
+uint8_t_ sim_replay_open(const char * ptr_str_path);
+
+/**
+ *	@brief		                            :	Locks the virtual clock to the host monotonic clock or unlocks it, the
+ *	                                            clock goes on from its current value. A sleep of sim_idle is a timerfd
+ *	                                            wait, sim_consume_cycles busy waits. sim_init calls it with TRUE if
+ *	                                            $SIM_REALTIME is set
+ *  @param[in]      bool_enable             :   TRUE real time, FALSE virtual time
+ *
+ *  @Return     TRUE if done, FALSE if the host timer can't be created
+ */
+uint8_t_ sim_set_realtime(uint8_t_ bool_enable);
+
+/**
+ *	@brief		                            :	Gets how late the sim_idle sleeps woke up after their event, host timer
+ *	                                            and scheduler latency, since sim_set_realtime or sim_clear_realtime_stats
+ *  @param[out]     ptr_str_stats           :   Pointer to store the statistics
+ */
+void sim_get_realtime_stats(str_sim_realtime_stats_t_ * ptr_str_stats);
+
+/**
+ *	@brief		                            :	Clears the wake-up statistics
+ */
+void sim_clear_realtime_stats(void);
+
+#endif /* SIM_INTERFACE_H_ */
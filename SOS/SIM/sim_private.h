@@ -0,0 +1,111 @@
+/**
+ * @fileName	:	sim_private.h
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Private file for the host simulator
+ */
+
+
+#ifndef SIM_PRIVATE_H_
+#define SIM_PRIVATE_H_
+
+#include "sim_interface.h"
+#include "sim_cfg.h"
+
+/* I/O space in data addresses, 0x20 -> 0x5F */
+#define SIM_IO_SIZE						0x60
+#define SIM_NO_ADDRESS					0xFF
+
+#define SIM_SREG						0x5F
+#define SIM_SREG_I						7
+
+/* flag registers are cleared by writing 1, they read back as 0 */
+#define SIM_TIFR						0x58
+#define SIM_GIFR						0x5A
+#define SIM_TIMSK						0x59
+#define SIM_GICR						0x5B
+#define SIM_MCUCR						0x55
+#define SIM_MCUCSR						0x54
+
+/* PINx, DDRx, PORTx of port A, the other ports follow 3 addresses lower each */
+#define SIM_PIN_A						0x39
+#define SIM_DDR_A						0x3A
+#define SIM_PORT_A_REG					0x3B
+#define SIM_PORT_STRIDE					3
+
+/* external interrupt pins and GIFR/GICR bits */
+#define SIM_INT0_PORT					SIM_PORT_D
+#define SIM_INT0_PIN					2
+#define SIM_INT1_PORT					SIM_PORT_D
+#define SIM_INT1_PIN					3
+#define SIM_INT2_PORT					SIM_PORT_B
+#define SIM_INT2_PIN					2
+#define SIM_INTF0						6
+#define SIM_INTF1						7
+#define SIM_INTF2						5
+#define SIM_NUMBER_OF_EXI				3
+
+#define SIM_NUMBER_OF_TIMERS			3
+#define SIM_NUMBER_OF_VECTORS			11		/* __vector_1 -> __vector_11, reset is not served */
+
+typedef void(*ptr_func_sim_vector_t_)(void);
+
+/* One timer/counter, addresses and bit numbers of the chip */
+typedef struct
+{
+	uint8_t_			uint8_tccr;				/* register holding CS bits 2:0				*/
+	uint8_t_			uint8_tcnt;
+	uint8_t_			uint8_ocr_a;
+	uint8_t_			uint8_ocr_b;			/* 0 when the timer has one compare unit	*/
+	uint8_t_			uint8_ctc_bit;			/* WGMx1/WGM12 in uint8_tccr, top is OCR A	*/
+	uint8_t_			bool_16_bit;
+	uint8_t_			uint8_tov_bit;			/* TIFR/TIMSK bits							*/
+	uint8_t_			uint8_ocf_a_bit;
+	uint8_t_			uint8_ocf_b_bit;
+	const uint16_t_ *	ptr_uint16_prescalers;	/* by CS value, 0 stopped					*/
+}str_sim_timer_t_;
+
+/* One interrupt vector, the flag and enable bits */
+typedef struct
+{
+	uint8_t_			uint8_flag_reg;			/* SIM_TIFR or SIM_GIFR						*/
+	uint8_t_			uint8_enable_reg;		/* SIM_TIMSK or SIM_GICR					*/
+	uint8_t_			uint8_bit;				/* same bit in both							*/
+}str_sim_vector_t_;
+
+/* sim_trace.c, called by sim_program.c */
+uint32_t_			sim_trace_isr_enter		(const char * ptr_str_name);
+void				sim_trace_isr_exit		(uint32_t_ uint32_mark);
+void				sim_trace_restart		(uint64_t_ uint64_cycles);
+
+/* sim_replay.c, called by sim_program.c */
+void				sim_replay_restart		(void);
+uint8_t_			sim_replay_active		(void);
+uint8_t_			sim_replay_update		(uint64_t_ uint64_cycle);
+uint8_t_			sim_replay_next_exi		(uint64_t_ * ptr_uint64_cycle);
+uint8_t_			sim_replay_pin			(enu_sim_port_t_ enu_port, uint8_t_ * ptr_uint8_value);
+void				sim_record_exi			(uint8_t_ uint8_int, uint64_t_ uint64_cycle);
+void				sim_record_pin			(enu_sim_port_t_ enu_port, uint64_t_ uint64_cycle, uint8_t_ uint8_value);
+
+/* sim_realtime.c, called by sim_program.c */
+void				sim_realtime_restart	(void);
+uint8_t_			sim_realtime_active		(void);
+uint64_t_			sim_realtime_cycles		(void);
+void				sim_realtime_wait		(uint64_t_ uint64_cycle);
+
+static void			sim_sync				(uint8_t_ uint8_address);
+static void			sim_post_access			(void);
+static void			sim_track_mask			(void);
+static void			sim_update				(void);
+static void			sim_update_timer		(uint8_t_ uint8_timer, uint64_t_ uint64_delta);
+static void			sim_update_pins			(void);
+static void			sim_raise_exi			(uint8_t_ uint8_int);
+static void			sim_sample_input		(uint8_t_ uint8_address);
+static void			sim_dispatch			(void);
+static uint64_t_	sim_next_event			(void);
+static uint32_t_	sim_timer_counts_to		(uint8_t_ uint8_timer, uint8_t_ uint8_flag_bit);
+static uint16_t_	sim_read_counter		(uint8_t_ uint8_address, uint8_t_ bool_16_bit);
+static void			sim_write_counter		(uint8_t_ uint8_address, uint8_t_ bool_16_bit, uint16_t_ uint16_value);
+static uint64_t_	sim_host_time_us		(void);
+
+#endif /* SIM_PRIVATE_H_ */
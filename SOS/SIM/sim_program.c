@@ -0,0 +1,995 @@
+/**
+ * @fileName	:	sim_program.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Host simulator of the ATmega32 registers, timers, pins and interrupts
+ */
+
+#define _POSIX_C_SOURCE		199309L		/* clock_gettime */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "sim_private.h"
+
+#define SIM_NO_BIT						0xFF
+#define SIM_NO_EVENT					(~(uint64_t_)0)
+#define SIM_MS_TO_CYCLES(MS)			((uint64_t_)(MS) * (SIM_CPU_FREQ_HZ / 1000UL))
+
+/* vectors defined by the drivers, an unused one stays NULL */
+extern void __vector_1(void)  __attribute__((weak));
+extern void __vector_2(void)  __attribute__((weak));
+extern void __vector_3(void)  __attribute__((weak));
+extern void __vector_4(void)  __attribute__((weak));
+extern void __vector_5(void)  __attribute__((weak));
+extern void __vector_6(void)  __attribute__((weak));
+extern void __vector_7(void)  __attribute__((weak));
+extern void __vector_8(void)  __attribute__((weak));
+extern void __vector_9(void)  __attribute__((weak));
+extern void __vector_10(void) __attribute__((weak));
+extern void __vector_11(void) __attribute__((weak));
+
+static const ptr_func_sim_vector_t_ gl_arr_ptr_func_sim_vectors[SIM_NUMBER_OF_VECTORS] =
+{
+		__vector_1, __vector_2, __vector_3, __vector_4, __vector_5, __vector_6,
+		__vector_7, __vector_8, __vector_9, __vector_10, __vector_11
+};
+
+/* highest priority first, same order as the vector table */
+static const str_sim_vector_t_ gl_arr_str_sim_vectors[SIM_NUMBER_OF_VECTORS] =
+{
+		{SIM_GIFR, SIM_GICR,  SIM_INTF0},	/* INT0			*/
+		{SIM_GIFR, SIM_GICR,  SIM_INTF1},	/* INT1			*/
+		{SIM_GIFR, SIM_GICR,  SIM_INTF2},	/* INT2			*/
+		{SIM_TIFR, SIM_TIMSK, 7},			/* TIMER2 COMP	*/
+		{SIM_TIFR, SIM_TIMSK, 6},			/* TIMER2 OVF	*/
+		{SIM_TIFR, SIM_TIMSK, 5},			/* TIMER1 CAPT	*/
+		{SIM_TIFR, SIM_TIMSK, 4},			/* TIMER1 COMPA	*/
+		{SIM_TIFR, SIM_TIMSK, 3},			/* TIMER1 COMPB	*/
+		{SIM_TIFR, SIM_TIMSK, 2},			/* TIMER1 OVF	*/
+		{SIM_TIFR, SIM_TIMSK, 1},			/* TIMER0 COMP	*/
+		{SIM_TIFR, SIM_TIMSK, 0}			/* TIMER0 OVF	*/
+};
+
+static const char * const gl_arr_ptr_sim_vector_names[SIM_NUMBER_OF_VECTORS] =
+{
+		"INT0", "INT1", "INT2", "TIMER2_COMP", "TIMER2_OVF", "TIMER1_CAPT",
+		"TIMER1_COMPA", "TIMER1_COMPB", "TIMER1_OVF", "TIMER0_COMP", "TIMER0_OVF"
+};
+
+static const uint8_t_ gl_arr_uint8_sim_exi_flags[SIM_NUMBER_OF_EXI] = {SIM_INTF0, SIM_INTF1, SIM_INTF2};
+
+static const uint16_t_ gl_arr_uint16_sim_prescalers_0_1[8] = {0, 1, 8, 64, 256, 1024, 0, 0};	/* 6, 7 external clock */
+static const uint16_t_ gl_arr_uint16_sim_prescalers_2[8]   = {0, 1, 8, 32, 64, 128, 256, 1024};
+
+static const str_sim_timer_t_ gl_arr_str_sim_timers[SIM_NUMBER_OF_TIMERS] =
+{
+		{0x53, 0x52, 0x5C, 0,    3, FALSE, 0, 1, SIM_NO_BIT, gl_arr_uint16_sim_prescalers_0_1},	/* TIMER0	*/
+		{0x4E, 0x4C, 0x4A, 0x48, 3, TRUE,  2, 4, 3,          gl_arr_uint16_sim_prescalers_0_1},	/* TIMER1	*/
+		{0x45, 0x44, 0x43, 0,    3, FALSE, 6, 7, SIM_NO_BIT, gl_arr_uint16_sim_prescalers_2}	/* TIMER2	*/
+};
+
+/* register file, the 16 bit registers sit on even addresses */
+static INSTANCE union
+{
+	uint8_t_	arr_uint8[SIM_IO_SIZE];
+	uint16_t_	arr_uint16[SIM_IO_SIZE / 2];
+}gl_un_sim_io;
+
+static INSTANCE uint8_t_				gl_uint8_sim_dummy_cell;							/* out of range addresses		*/
+static INSTANCE uint16_t_			gl_uint16_sim_dummy_cell;
+
+static INSTANCE uint64_t_			gl_uint64_sim_cycles = 0;
+static INSTANCE uint64_t_			gl_uint64_sim_updated_cycles = 0;
+static INSTANCE uint64_t_			gl_uint64_sim_idle_cycles = 0;						/* skipped by sim_idle				*/
+static INSTANCE uint64_t_			gl_uint64_sim_end_cycles = SIM_NO_EVENT;
+static INSTANCE ptr_func_sim_end_t_	gl_ptr_func_sim_end = NULL_PTR;
+static INSTANCE uint64_t_			gl_uint64_sim_host_start_us = 0;
+
+static INSTANCE uint8_t_				gl_uint8_sim_last_address = SIM_NO_ADDRESS;			/* access not post-processed yet	*/
+static INSTANCE uint8_t_				gl_uint8_sim_tifr = 0;								/* real flags, the cells read 0		*/
+static INSTANCE uint8_t_				gl_uint8_sim_gifr = 0;
+static INSTANCE uint32_t_			gl_arr_uint32_sim_residue[SIM_NUMBER_OF_TIMERS];		/* cycles not counted yet			*/
+
+static INSTANCE uint8_t_				gl_arr_uint8_sim_levels[SIM_PORT_TOTAL];			/* driven from outside				*/
+static INSTANCE uint8_t_				gl_arr_uint8_sim_pins[SIM_PORT_TOTAL];				/* PINx seen last, edge detection	*/
+static INSTANCE uint8_t_				gl_arr_uint8_sim_outputs[SIM_PORT_TOTAL];
+static INSTANCE uint32_t_			gl_arr_uint32_sim_toggles[SIM_PORT_TOTAL][8];
+static INSTANCE uint8_t_				gl_uint8_sim_next_stimulus = 0;
+
+static INSTANCE uint32_t_			gl_arr_uint32_sim_isr_count[SIM_NUMBER_OF_VECTORS];
+static INSTANCE uint32_t_			gl_uint32_sim_isr_total = 0;
+static INSTANCE uint32_t_			gl_uint32_sim_idle_mark = 0;						/* ISR total at the last sim_idle	*/
+
+static INSTANCE uint8_t_				gl_uint8_sim_masked = TRUE;							/* I bit of SREG seen cleared		*/
+static INSTANCE uint64_t_			gl_uint64_sim_masked_start = 0;
+static INSTANCE uint64_t_			gl_uint64_sim_masked_max = 0;
+
+
+void sim_init(void)
+{
+	uint8_t_ uint8_index;
+
+	for(uint8_index = 0; uint8_index < SIM_IO_SIZE; uint8_index++)
+	{
+		gl_un_sim_io.arr_uint8[uint8_index] = 0;
+	}
+	for(uint8_index = 0; uint8_index < SIM_NUMBER_OF_TIMERS; uint8_index++)
+	{
+		gl_arr_uint32_sim_residue[uint8_index] = 0;
+	}
+	for(uint8_index = 0; uint8_index < SIM_PORT_TOTAL; uint8_index++)
+	{
+		gl_arr_uint8_sim_levels[uint8_index]	= 0;
+		gl_arr_uint8_sim_pins[uint8_index]		= 0;
+		gl_arr_uint8_sim_outputs[uint8_index]	= 0;
+		for(uint8_t_ uint8_pin = 0; uint8_pin < 8; uint8_pin++)
+		{
+			gl_arr_uint32_sim_toggles[uint8_index][uint8_pin] = 0;
+		}
+	}
+	for(uint8_index = 0; uint8_index < SIM_NUMBER_OF_VECTORS; uint8_index++)
+	{
+		gl_arr_uint32_sim_isr_count[uint8_index] = 0;
+	}
+
+	sim_trace_restart(gl_uint64_sim_cycles);
+	sim_replay_restart();
+
+	gl_uint64_sim_cycles			= 0;
+	gl_uint64_sim_updated_cycles	= 0;
+	gl_uint64_sim_idle_cycles		= 0;
+	gl_uint8_sim_last_address		= SIM_NO_ADDRESS;
+	gl_uint8_sim_tifr				= 0;
+	gl_uint8_sim_gifr				= 0;
+	gl_uint8_sim_next_stimulus		= 0;
+	gl_uint32_sim_isr_total			= 0;
+	gl_uint32_sim_idle_mark			= 0;
+	gl_uint8_sim_masked				= TRUE;		/* SREG resets with the I bit cleared */
+	gl_uint64_sim_masked_start		= 0;
+	gl_uint64_sim_masked_max		= 0;
+	gl_uint64_sim_host_start_us		= sim_host_time_us();
+	sim_realtime_restart();
+
+	sim_set_end(SIM_RUN_TIME_MS, NULL_PTR);
+}
+
+volatile uint8_t_ * sim_reg8(uint8_t_ uint8_address)
+{
+	volatile uint8_t_ * ptr_uint8_cell = &gl_uint8_sim_dummy_cell;
+
+	if(SIM_IO_SIZE > uint8_address)
+	{
+		sim_sync(uint8_address);
+		sim_sample_input(uint8_address);
+		ptr_uint8_cell = &gl_un_sim_io.arr_uint8[uint8_address];
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return ptr_uint8_cell;
+}
+
+volatile uint16_t_ * sim_reg16(uint8_t_ uint8_address)
+{
+	volatile uint16_t_ * ptr_uint16_cell = &gl_uint16_sim_dummy_cell;
+
+	if(
+			(SIM_IO_SIZE > uint8_address) &&
+			(0 == (uint8_address & 1))
+			)
+	{
+		sim_sync(uint8_address);
+		ptr_uint16_cell = &gl_un_sim_io.arr_uint16[uint8_address / 2];
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return ptr_uint16_cell;
+}
+
+void sim_set_pin(enu_sim_port_t_ enu_port, uint8_t_ uint8_pin, uint8_t_ uint8_level)
+{
+	if(
+			(SIM_PORT_TOTAL > enu_port) &&
+			(8 > uint8_pin)
+			)
+	{
+		if(0 != uint8_level)
+		{
+			gl_arr_uint8_sim_levels[enu_port] |= (uint8_t_)(1 << uint8_pin);
+		}
+		else
+		{
+			gl_arr_uint8_sim_levels[enu_port] &= (uint8_t_)~(1 << uint8_pin);
+		}
+		sim_update_pins();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void sim_idle(void)
+{
+	uint64_t_ uint64_next_event;
+
+	sim_sync(SIM_NO_ADDRESS);
+
+	/* an interrupt since the last call may have left work for the caller */
+	if(gl_uint32_sim_isr_total == gl_uint32_sim_idle_mark)
+	{
+		uint64_next_event = sim_next_event();
+		if(TRUE == sim_realtime_active())
+		{
+			/* sleep until the host clock gets there, the clock then jumps to where it is */
+			sim_realtime_wait(uint64_next_event);
+			uint64_next_event = sim_realtime_cycles();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		if(
+				(SIM_NO_EVENT != uint64_next_event) &&
+				(uint64_next_event > gl_uint64_sim_cycles)
+				)
+		{
+			gl_uint64_sim_idle_cycles += uint64_next_event - gl_uint64_sim_cycles;
+			gl_uint64_sim_cycles = uint64_next_event;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		sim_sync(SIM_NO_ADDRESS);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	gl_uint32_sim_idle_mark = gl_uint32_sim_isr_total;
+}
+
+void sim_consume_cycles(uint32_t_ uint32_cycles)
+{
+	uint64_t_ uint64_end = gl_uint64_sim_cycles + uint32_cycles;
+
+	sim_track_mask();
+	if(TRUE == sim_realtime_active())
+	{
+		/* busy, the interrupts are served meanwhile */
+		do
+		{
+			sim_sync(SIM_NO_ADDRESS);
+		}
+		while(gl_uint64_sim_cycles < uint64_end);
+	}
+	else
+	{
+		gl_uint64_sim_cycles = uint64_end;
+		sim_sync(SIM_NO_ADDRESS);
+	}
+}
+
+uint64_t_ sim_get_cycles(void)
+{
+	return gl_uint64_sim_cycles;
+}
+
+uint64_t_ sim_get_idle_cycles(void)
+{
+	return gl_uint64_sim_idle_cycles;
+}
+
+uint64_t_ sim_get_masked_max_cycles(void)
+{
+	return gl_uint64_sim_masked_max;
+}
+
+void sim_clear_masked_max(void)
+{
+	gl_uint64_sim_masked_start	= gl_uint64_sim_cycles;
+	gl_uint64_sim_masked_max	= 0;
+}
+
+void sim_set_end(uint32_t_ uint32_end_ms, ptr_func_sim_end_t_ ptr_func_end)
+{
+	gl_uint64_sim_end_cycles	= (0 != uint32_end_ms) ? SIM_MS_TO_CYCLES(uint32_end_ms) : SIM_NO_EVENT;
+	gl_ptr_func_sim_end			= ptr_func_end;
+}
+
+void sim_report(void)
+{
+	uint64_t_ uint64_virtual_us	= gl_uint64_sim_cycles / (SIM_CPU_FREQ_HZ / 1000000UL);
+	uint64_t_ uint64_host_us	= sim_host_time_us() - gl_uint64_sim_host_start_us;
+
+	str_sim_realtime_stats_t_ str_realtime;
+
+	printf("sim: %llu.%06llu s virtual in %llu.%06llu s host (x%llu)\n",
+		   (unsigned long long)(uint64_virtual_us / 1000000UL), (unsigned long long)(uint64_virtual_us % 1000000UL),
+		   (unsigned long long)(uint64_host_us / 1000000UL), (unsigned long long)(uint64_host_us % 1000000UL),
+		   (unsigned long long)((uint64_virtual_us + (uint64_host_us / 2)) / ((0 != uint64_host_us) ? uint64_host_us : 1)));
+
+	sim_get_realtime_stats(&str_realtime);
+	if(
+			(TRUE == sim_realtime_active()) &&
+			(0 != str_realtime.uint32_wakes)
+			)
+	{
+		printf("sim: real time, %lu wake-ups late by %lu / %lu / %lu us min / avg / max\n",
+			   (unsigned long)str_realtime.uint32_wakes,
+			   (unsigned long)(str_realtime.uint32_late_min_ns / 1000UL),
+			   (unsigned long)((str_realtime.uint64_late_total_ns / str_realtime.uint32_wakes) / 1000UL),
+			   (unsigned long)(str_realtime.uint32_late_max_ns / 1000UL));
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	for(uint8_t_ uint8_vector = 0; uint8_vector < SIM_NUMBER_OF_VECTORS; uint8_vector++)
+	{
+		if(0 != gl_arr_uint32_sim_isr_count[uint8_vector])
+		{
+			printf("sim: vector %2u %-12s %10lu\n", uint8_vector + 1, gl_arr_ptr_sim_vector_names[uint8_vector],
+				   (unsigned long)gl_arr_uint32_sim_isr_count[uint8_vector]);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	for(uint8_t_ uint8_port = 0; uint8_port < SIM_PORT_TOTAL; uint8_port++)
+	{
+		for(uint8_t_ uint8_pin = 0; uint8_pin < 8; uint8_pin++)
+		{
+			if(0 != gl_arr_uint32_sim_toggles[uint8_port][uint8_pin])
+			{
+				printf("sim: pin P%c%u %-12s %10lu\n", 'A' + uint8_port, uint8_pin, "changes",
+					   (unsigned long)gl_arr_uint32_sim_toggles[uint8_port][uint8_pin]);
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+	}
+}
+
+/**
+ * @brief a private function run before every register access, moves the
+ *		  virtual clock, updates the peripherals and serves the interrupts
+ *
+ * @param uint8_address : register about to be accessed, SIM_NO_ADDRESS for none
+ *
+ * @return
+ */
+static void sim_sync(uint8_t_ uint8_address)
+{
+	uint64_t_ uint64_now;
+
+	sim_post_access();
+	sim_track_mask();		/* the last access (cli/sei) took effect at its own time */
+
+	if(TRUE == sim_realtime_active())
+	{
+		/* the code since the last access took host time, the clock never goes back */
+		uint64_now = sim_realtime_cycles();
+		gl_uint64_sim_cycles = (uint64_now > gl_uint64_sim_cycles) ? uint64_now : gl_uint64_sim_cycles;
+	}
+	else
+	{
+		gl_uint64_sim_cycles += SIM_CYCLES_PER_ACCESS;
+	}
+	sim_update();
+	sim_dispatch();
+
+	/* the access itself happens after the return, it is looked at on the next sync */
+	gl_uint8_sim_last_address = uint8_address;
+	if(
+			(SIM_TIFR == uint8_address) ||
+			(SIM_GIFR == uint8_address)
+			)
+	{
+		gl_un_sim_io.arr_uint8[uint8_address] = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to apply the side effect of the previous access,
+ *		  a 1 written to TIFR/GIFR clears that flag
+ *
+ * @return
+ */
+static void sim_post_access(void)
+{
+	if(SIM_TIFR == gl_uint8_sim_last_address)
+	{
+		gl_uint8_sim_tifr &= (uint8_t_)~gl_un_sim_io.arr_uint8[SIM_TIFR];
+		gl_un_sim_io.arr_uint8[SIM_TIFR] = 0;
+	}
+	else if(SIM_GIFR == gl_uint8_sim_last_address)
+	{
+		gl_uint8_sim_gifr &= (uint8_t_)~gl_un_sim_io.arr_uint8[SIM_GIFR];
+		gl_un_sim_io.arr_uint8[SIM_GIFR] = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	gl_uint8_sim_last_address = SIM_NO_ADDRESS;
+}
+
+/**
+ * @brief a private function to follow the I bit of SREG on the virtual clock,
+ *		  keeps the longest time the interrupts stayed masked (ISR, cli/sei)
+ *
+ * @return
+ */
+static void sim_track_mask(void)
+{
+	uint8_t_ bool_masked = (0 == (gl_un_sim_io.arr_uint8[SIM_SREG] & (1 << SIM_SREG_I))) ? TRUE : FALSE;
+
+	if((TRUE == bool_masked) && (FALSE == gl_uint8_sim_masked))
+	{
+		gl_uint64_sim_masked_start = gl_uint64_sim_cycles;
+	}
+	else if(
+			(FALSE == bool_masked) &&
+			(TRUE == gl_uint8_sim_masked) &&
+			((gl_uint64_sim_cycles - gl_uint64_sim_masked_start) > gl_uint64_sim_masked_max)
+			)
+	{
+		gl_uint64_sim_masked_max = gl_uint64_sim_cycles - gl_uint64_sim_masked_start;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	gl_uint8_sim_masked = bool_masked;
+}
+
+/**
+ * @brief a private function to bring the timers, the stimuli and the pins up
+ *		  to the virtual clock, ends the run when its time is reached
+ *
+ * @return
+ */
+static void sim_update(void)
+{
+	uint64_t_ uint64_delta = gl_uint64_sim_cycles - gl_uint64_sim_updated_cycles;
+	uint8_t_ uint8_ints;
+
+	gl_uint64_sim_updated_cycles = gl_uint64_sim_cycles;
+
+	for(uint8_t_ uint8_timer = 0; uint8_timer < SIM_NUMBER_OF_TIMERS; uint8_timer++)
+	{
+		sim_update_timer(uint8_timer, uint64_delta);
+	}
+
+	while(
+			(SIM_NUMBER_OF_STIMULI > gl_uint8_sim_next_stimulus) &&
+			(SIM_MS_TO_CYCLES(arr_g_sim_stimuli[gl_uint8_sim_next_stimulus].uint32_time_ms) <= gl_uint64_sim_cycles)
+			)
+	{
+		/* a replayed run takes its inputs from the log, the stimulus only wakes the MCU like when recorded */
+		if(FALSE == sim_replay_active())
+		{
+			sim_set_pin(arr_g_sim_stimuli[gl_uint8_sim_next_stimulus].enu_port,
+						arr_g_sim_stimuli[gl_uint8_sim_next_stimulus].uint8_pin,
+						arr_g_sim_stimuli[gl_uint8_sim_next_stimulus].uint8_level);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		gl_uint8_sim_next_stimulus++;
+	}
+
+	sim_update_pins();
+
+	uint8_ints = sim_replay_update(gl_uint64_sim_cycles);
+	for(uint8_t_ uint8_int = 0; uint8_int < SIM_NUMBER_OF_EXI; uint8_int++)
+	{
+		if(0 != (uint8_ints & (1 << uint8_int)))
+		{
+			gl_uint8_sim_gifr |= (uint8_t_)(1 << gl_arr_uint8_sim_exi_flags[uint8_int]);
+			sim_record_exi(uint8_int, gl_uint64_sim_cycles);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	/* an end callback is served like an interrupt, with interrupts enabled and not nested */
+	if(
+			(gl_uint64_sim_cycles >= gl_uint64_sim_end_cycles) &&
+			(
+					(NULL_PTR == gl_ptr_func_sim_end) ||
+					(0 != (gl_un_sim_io.arr_uint8[SIM_SREG] & (1 << SIM_SREG_I)))
+					)
+			)
+	{
+		gl_uint64_sim_end_cycles = SIM_NO_EVENT;
+		if(NULL_PTR != gl_ptr_func_sim_end)
+		{
+			gl_un_sim_io.arr_uint8[SIM_SREG] &= (uint8_t_)~(1 << SIM_SREG_I);
+			sim_track_mask();
+			gl_ptr_func_sim_end();
+			sim_post_access();
+			gl_un_sim_io.arr_uint8[SIM_SREG] |= (uint8_t_)(1 << SIM_SREG_I);
+			sim_track_mask();
+		}
+		else
+		{
+			sim_report();
+			exit(0);
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to count a timer for the given cycles, normal
+ *		  and CTC (top = OCR A) modes, the PWM modes count like normal mode
+ *
+ * @param uint8_timer   : timer index
+ * @param uint64_delta  : CPU cycles since the last update
+ *
+ * @return
+ */
+static void sim_update_timer(uint8_t_ uint8_timer, uint64_t_ uint64_delta)
+{
+	const str_sim_timer_t_ * ptr_str_timer = &gl_arr_str_sim_timers[uint8_timer];
+	uint8_t_ uint8_tccr = gl_un_sim_io.arr_uint8[ptr_str_timer->uint8_tccr];
+	uint16_t_ uint16_prescaler = ptr_str_timer->ptr_uint16_prescalers[uint8_tccr & 0x07];
+	uint64_t_ uint64_counts;
+	uint32_t_ uint32_max = (TRUE == ptr_str_timer->bool_16_bit) ? 0xFFFF : 0xFF;
+	uint32_t_ uint32_period;
+	uint32_t_ uint32_value;
+	uint8_t_ bool_ctc = (uint8_t_)((uint8_tccr >> ptr_str_timer->uint8_ctc_bit) & 1);
+
+	if(0 == uint16_prescaler)
+	{
+		/* stopped, the prescaler keeps its phase */
+		return;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	uint64_counts = (gl_arr_uint32_sim_residue[uint8_timer] + uint64_delta) / uint16_prescaler;
+	gl_arr_uint32_sim_residue[uint8_timer] = (uint32_t_)((gl_arr_uint32_sim_residue[uint8_timer] + uint64_delta) % uint16_prescaler);
+
+	if(0 != uint64_counts)
+	{
+		uint32_value	= sim_read_counter(ptr_str_timer->uint8_tcnt, ptr_str_timer->bool_16_bit);
+		uint32_period	= (TRUE == bool_ctc) ?
+						  (uint32_t_)sim_read_counter(ptr_str_timer->uint8_ocr_a, ptr_str_timer->bool_16_bit) + 1 :
+						  uint32_max + 1;
+
+		if(uint64_counts >= sim_timer_counts_to(uint8_timer, ptr_str_timer->uint8_ocf_a_bit))
+		{
+			gl_uint8_sim_tifr |= (uint8_t_)(1 << ptr_str_timer->uint8_ocf_a_bit);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		if(
+				(SIM_NO_BIT != ptr_str_timer->uint8_ocf_b_bit) &&
+				(uint64_counts >= sim_timer_counts_to(uint8_timer, ptr_str_timer->uint8_ocf_b_bit))
+				)
+		{
+			gl_uint8_sim_tifr |= (uint8_t_)(1 << ptr_str_timer->uint8_ocf_b_bit);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		if(uint64_counts >= sim_timer_counts_to(uint8_timer, ptr_str_timer->uint8_tov_bit))
+		{
+			gl_uint8_sim_tifr |= (uint8_t_)(1 << ptr_str_timer->uint8_tov_bit);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		sim_write_counter(ptr_str_timer->uint8_tcnt, ptr_str_timer->bool_16_bit,
+						  (uint16_t_)(((uint32_value % uint32_period) + uint64_counts) % uint32_period));
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to find the counts a timer needs from its current
+ *		  value to raise one of its flags
+ *
+ * @param uint8_timer   : timer index
+ * @param uint8_flag_bit: TOV or OCF bit of the timer
+ *
+ * @return counts (1 or more), SIM_NO_EVENT truncated (never) if the flag can not be raised
+ */
+static uint32_t_ sim_timer_counts_to(uint8_t_ uint8_timer, uint8_t_ uint8_flag_bit)
+{
+	const str_sim_timer_t_ * ptr_str_timer = &gl_arr_str_sim_timers[uint8_timer];
+	uint8_t_ bool_ctc = (uint8_t_)((gl_un_sim_io.arr_uint8[ptr_str_timer->uint8_tccr] >> ptr_str_timer->uint8_ctc_bit) & 1);
+	uint32_t_ uint32_max = (TRUE == ptr_str_timer->bool_16_bit) ? 0xFFFF : 0xFF;
+	uint32_t_ uint32_value = sim_read_counter(ptr_str_timer->uint8_tcnt, ptr_str_timer->bool_16_bit);
+	uint32_t_ uint32_period;
+	uint32_t_ uint32_compare;
+	uint32_t_ uint32_counts = (uint32_t_)SIM_NO_EVENT;
+
+	uint32_period = (TRUE == bool_ctc) ?
+					(uint32_t_)sim_read_counter(ptr_str_timer->uint8_ocr_a, ptr_str_timer->bool_16_bit) + 1 :
+					uint32_max + 1;
+	uint32_value %= uint32_period;
+
+	if(uint8_flag_bit == ptr_str_timer->uint8_tov_bit)
+	{
+		/* MAX is not reached in CTC mode */
+		if(FALSE == bool_ctc)
+		{
+			uint32_counts = uint32_period - uint32_value;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else if(
+			(uint8_flag_bit == ptr_str_timer->uint8_ocf_a_bit) ||
+			(uint8_flag_bit == ptr_str_timer->uint8_ocf_b_bit)
+			)
+	{
+		uint32_compare = sim_read_counter((uint8_flag_bit == ptr_str_timer->uint8_ocf_a_bit) ?
+										  ptr_str_timer->uint8_ocr_a : ptr_str_timer->uint8_ocr_b,
+										  ptr_str_timer->bool_16_bit);
+		if(uint32_compare < uint32_period)
+		{
+			/* the flag is raised when the counter becomes the compare value */
+			uint32_counts = (uint32_compare + uint32_period - uint32_value) % uint32_period;
+			uint32_counts = (0 != uint32_counts) ? uint32_counts : uint32_period;
+		}
+		else
+		{
+			/* compare value above top, never matched */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return uint32_counts;
+}
+
+/**
+ * @brief a private function to rebuild PINx from the outputs and the driven
+ *		  levels, count output changes and raise the external interrupt flags
+ *
+ * @return
+ */
+static void sim_update_pins(void)
+{
+	uint8_t_ uint8_old_pins[SIM_PORT_TOTAL];
+	uint8_t_ uint8_ddr;
+	uint8_t_ uint8_outputs;
+	uint8_t_ uint8_changed;
+	uint8_t_ uint8_mcucr = gl_un_sim_io.arr_uint8[SIM_MCUCR];
+	uint8_t_ uint8_old;
+	uint8_t_ uint8_new;
+
+	for(uint8_t_ uint8_port = 0; uint8_port < SIM_PORT_TOTAL; uint8_port++)
+	{
+		uint8_ddr		= gl_un_sim_io.arr_uint8[SIM_DDR_A - (uint8_port * SIM_PORT_STRIDE)];
+		uint8_outputs	= gl_un_sim_io.arr_uint8[SIM_PORT_A_REG - (uint8_port * SIM_PORT_STRIDE)] & uint8_ddr;
+
+		uint8_changed = uint8_outputs ^ gl_arr_uint8_sim_outputs[uint8_port];
+		for(uint8_t_ uint8_pin = 0; (0 != uint8_changed) && (uint8_pin < 8); uint8_pin++)
+		{
+			if(0 != (uint8_changed & (1 << uint8_pin)))
+			{
+				gl_arr_uint32_sim_toggles[uint8_port][uint8_pin]++;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		gl_arr_uint8_sim_outputs[uint8_port] = uint8_outputs;
+
+		uint8_old_pins[uint8_port] = gl_arr_uint8_sim_pins[uint8_port];
+		gl_arr_uint8_sim_pins[uint8_port] = uint8_outputs | (gl_arr_uint8_sim_levels[uint8_port] & (uint8_t_)~uint8_ddr);
+		gl_un_sim_io.arr_uint8[SIM_PIN_A - (uint8_port * SIM_PORT_STRIDE)] = gl_arr_uint8_sim_pins[uint8_port];
+	}
+
+	/* INT0/INT1, ISCx1:0 = low level, any change, falling, rising */
+	for(uint8_t_ uint8_int = 0; uint8_int < 2; uint8_int++)
+	{
+		uint8_t_ uint8_pin = (0 == uint8_int) ? SIM_INT0_PIN : SIM_INT1_PIN;
+		uint8_t_ uint8_flag = (0 == uint8_int) ? SIM_INTF0 : SIM_INTF1;
+		uint8_t_ uint8_sense = (uint8_t_)((uint8_mcucr >> (uint8_int * 2)) & 0x03);
+
+		uint8_old = (uint8_t_)((uint8_old_pins[SIM_INT0_PORT] >> uint8_pin) & 1);
+		uint8_new = (uint8_t_)((gl_arr_uint8_sim_pins[SIM_INT0_PORT] >> uint8_pin) & 1);
+
+		if(
+				((0 == uint8_sense) && (0 == uint8_new) &&
+				 (0 != (gl_un_sim_io.arr_uint8[SIM_GICR] & (1 << uint8_flag)))) ||
+				((1 == uint8_sense) && (uint8_old != uint8_new)) ||
+				((2 == uint8_sense) && (1 == uint8_old) && (0 == uint8_new)) ||
+				((3 == uint8_sense) && (0 == uint8_old) && (1 == uint8_new))
+				)
+		{
+			sim_raise_exi(uint8_int);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	/* INT2, ISC2 = falling, rising */
+	uint8_old = (uint8_t_)((uint8_old_pins[SIM_INT2_PORT] >> SIM_INT2_PIN) & 1);
+	uint8_new = (uint8_t_)((gl_arr_uint8_sim_pins[SIM_INT2_PORT] >> SIM_INT2_PIN) & 1);
+	if(uint8_old != uint8_new)
+	{
+		if(((gl_un_sim_io.arr_uint8[SIM_MCUCSR] >> 6) & 1) == uint8_new)
+		{
+			sim_raise_exi(2);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to raise the flag of an external interrupt on a
+ *		  pin edge or level, a replayed run raises them from the log instead
+ *
+ * @param uint8_int : INT0, INT1 or INT2
+ *
+ * @return
+ */
+static void sim_raise_exi(uint8_t_ uint8_int)
+{
+	uint8_t_ uint8_flag_mask = (uint8_t_)(1 << gl_arr_uint8_sim_exi_flags[uint8_int]);
+
+	if(
+			(FALSE == sim_replay_active()) &&
+			(0 == (gl_uint8_sim_gifr & uint8_flag_mask))
+			)
+	{
+		gl_uint8_sim_gifr |= uint8_flag_mask;
+		sim_record_exi(uint8_int, gl_uint64_sim_cycles);
+	}
+	else
+	{
+		/* already pending or replayed */
+	}
+}
+
+/**
+ * @brief a private function run on a register read before the value is
+ *		  taken, a PINx read gets the replayed value and is logged
+ *
+ * @param uint8_address : register about to be accessed
+ *
+ * @return
+ */
+static void sim_sample_input(uint8_t_ uint8_address)
+{
+	enu_sim_port_t_ enu_port;
+	uint8_t_ uint8_value;
+
+	if(
+			(SIM_PIN_A >= uint8_address) &&
+			(0 == ((SIM_PIN_A - uint8_address) % SIM_PORT_STRIDE)) &&
+			(SIM_PORT_TOTAL > ((SIM_PIN_A - uint8_address) / SIM_PORT_STRIDE))
+			)
+	{
+		enu_port = (enu_sim_port_t_)((SIM_PIN_A - uint8_address) / SIM_PORT_STRIDE);
+
+		if(TRUE == sim_replay_pin(enu_port, &uint8_value))
+		{
+			gl_un_sim_io.arr_uint8[uint8_address] = uint8_value;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		sim_record_pin(enu_port, gl_uint64_sim_cycles, gl_un_sim_io.arr_uint8[uint8_address]);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to call the pending enabled vectors while the
+ *		  I bit is set, the I bit is cleared during an ISR like on the chip
+ *
+ * @return
+ */
+static void sim_dispatch(void)
+{
+	uint8_t_ uint8_vector;
+	uint8_t_ * ptr_uint8_flags;
+	uint32_t_ uint32_trace_mark;
+
+	while(0 != (gl_un_sim_io.arr_uint8[SIM_SREG] & (1 << SIM_SREG_I)))
+	{
+		for(uint8_vector = 0; uint8_vector < SIM_NUMBER_OF_VECTORS; uint8_vector++)
+		{
+			ptr_uint8_flags = (SIM_TIFR == gl_arr_str_sim_vectors[uint8_vector].uint8_flag_reg) ?
+							  &gl_uint8_sim_tifr : &gl_uint8_sim_gifr;
+
+			if(0 != (*ptr_uint8_flags & gl_un_sim_io.arr_uint8[gl_arr_str_sim_vectors[uint8_vector].uint8_enable_reg] &
+					 (1 << gl_arr_str_sim_vectors[uint8_vector].uint8_bit)))
+			{
+				*ptr_uint8_flags &= (uint8_t_)~(1 << gl_arr_str_sim_vectors[uint8_vector].uint8_bit);
+				break;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+
+		if(SIM_NUMBER_OF_VECTORS == uint8_vector)
+		{
+			break;
+		}
+		else
+		{
+			gl_arr_uint32_sim_isr_count[uint8_vector]++;
+			gl_uint32_sim_isr_total++;
+
+			gl_un_sim_io.arr_uint8[SIM_SREG] &= (uint8_t_)~(1 << SIM_SREG_I);
+			sim_track_mask();
+			uint32_trace_mark = sim_trace_isr_enter(gl_arr_ptr_sim_vector_names[uint8_vector]);
+			if(NULL_PTR != gl_arr_ptr_func_sim_vectors[uint8_vector])
+			{
+				gl_arr_ptr_func_sim_vectors[uint8_vector]();
+			}
+			else
+			{
+				/* no handler linked, the chip would jump to the reset vector */
+			}
+			sim_post_access();
+			sim_trace_isr_exit(uint32_trace_mark);
+			gl_un_sim_io.arr_uint8[SIM_SREG] |= (uint8_t_)(1 << SIM_SREG_I);		/* reti */
+			sim_track_mask();
+		}
+	}
+}
+
+/**
+ * @brief a private function to find the cycle of the next event that can
+ *		  wake an idle MCU, an enabled timer interrupt, a stimulus or the end
+ *
+ * @return CPU cycle of the event, SIM_NO_EVENT if none
+ */
+static uint64_t_ sim_next_event(void)
+{
+	const str_sim_timer_t_ * ptr_str_timer;
+	uint64_t_ uint64_next = gl_uint64_sim_end_cycles;
+	uint64_t_ uint64_event;
+	uint32_t_ uint32_counts;
+	uint16_t_ uint16_prescaler;
+	uint8_t_ uint8_timsk = gl_un_sim_io.arr_uint8[SIM_TIMSK];
+	uint8_t_ arr_uint8_bits[3];
+
+	for(uint8_t_ uint8_timer = 0; uint8_timer < SIM_NUMBER_OF_TIMERS; uint8_timer++)
+	{
+		ptr_str_timer		= &gl_arr_str_sim_timers[uint8_timer];
+		uint16_prescaler	= ptr_str_timer->ptr_uint16_prescalers[gl_un_sim_io.arr_uint8[ptr_str_timer->uint8_tccr] & 0x07];
+		arr_uint8_bits[0]	= ptr_str_timer->uint8_tov_bit;
+		arr_uint8_bits[1]	= ptr_str_timer->uint8_ocf_a_bit;
+		arr_uint8_bits[2]	= ptr_str_timer->uint8_ocf_b_bit;
+
+		for(uint8_t_ uint8_index = 0; (0 != uint16_prescaler) && (uint8_index < 3); uint8_index++)
+		{
+			if(
+					(SIM_NO_BIT != arr_uint8_bits[uint8_index]) &&
+					(0 != (uint8_timsk & (1 << arr_uint8_bits[uint8_index])))
+					)
+			{
+				uint32_counts = sim_timer_counts_to(uint8_timer, arr_uint8_bits[uint8_index]);
+				if((uint32_t_)SIM_NO_EVENT != uint32_counts)
+				{
+					uint64_event = gl_uint64_sim_cycles + ((uint64_t_)uint32_counts * uint16_prescaler)
+								   - gl_arr_uint32_sim_residue[uint8_timer];
+					uint64_next = (uint64_event < uint64_next) ? uint64_event : uint64_next;
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+	}
+
+	if(SIM_NUMBER_OF_STIMULI > gl_uint8_sim_next_stimulus)
+	{
+		uint64_event = SIM_MS_TO_CYCLES(arr_g_sim_stimuli[gl_uint8_sim_next_stimulus].uint32_time_ms);
+		uint64_next = (uint64_event < uint64_next) ? uint64_event : uint64_next;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(TRUE == sim_replay_next_exi(&uint64_event))
+	{
+		uint64_next = (uint64_event < uint64_next) ? uint64_event : uint64_next;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return uint64_next;
+}
+
+static uint16_t_ sim_read_counter(uint8_t_ uint8_address, uint8_t_ bool_16_bit)
+{
+	return (TRUE == bool_16_bit) ? gl_un_sim_io.arr_uint16[uint8_address / 2] : gl_un_sim_io.arr_uint8[uint8_address];
+}
+
+static void sim_write_counter(uint8_t_ uint8_address, uint8_t_ bool_16_bit, uint16_t_ uint16_value)
+{
+	if(TRUE == bool_16_bit)
+	{
+		gl_un_sim_io.arr_uint16[uint8_address / 2] = uint16_value;
+	}
+	else
+	{
+		gl_un_sim_io.arr_uint8[uint8_address] = (uint8_t_)uint16_value;
+	}
+}
+
+static uint64_t_ sim_host_time_us(void)
+{
+	struct timespec str_now;
+
+	clock_gettime(CLOCK_MONOTONIC, &str_now);
+
+	return ((uint64_t_)str_now.tv_sec * 1000000UL) + ((uint64_t_)str_now.tv_nsec / 1000UL);
+}
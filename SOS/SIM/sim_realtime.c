@@ -0,0 +1,187 @@
+/**
+ * @fileName	:	sim_realtime.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Real time clock of the host simulator (Linux timerfd)
+ *
+ * In real time mode the virtual clock is the host monotonic clock scaled to
+ * CPU cycles: a register access reads it instead of charging
+ * SIM_CYCLES_PER_ACCESS, sim_consume_cycles busy waits and sim_idle sleeps on
+ * a timerfd armed at the next event instead of jumping to it. The emulated
+ * timers, hence timer_interface.h and the SOS tick, run at their real rate.
+ * Every sleep that ends on its event is a wake-up, its lateness (host timer
+ * and scheduler latency) is the jitter of the interrupt served next.
+ */
+
+#define _POSIX_C_SOURCE		199309L		/* clock_gettime */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+#include "sim_interface.h"
+#include "sim_cfg.h"
+
+#define SIM_RT_NO_FD					(-1)
+#define SIM_RT_NO_EVENT					(~(uint64_t_)0)
+#define SIM_RT_MAX_SLEEP_NS				100000000ULL		/* nothing to wake the MCU, look again later */
+#define SIM_RT_CYCLES_TO_NS(CYCLES)		((uint64_t_)(CYCLES) * 1000UL / (SIM_CPU_FREQ_HZ / 1000000UL))
+#define SIM_RT_NS_TO_CYCLES(NS)			((uint64_t_)(NS) * (SIM_CPU_FREQ_HZ / 1000000UL) / 1000UL)
+
+static uint64_t_	sim_realtime_now_ns		(void);
+
+static INSTANCE int							gl_sint_sim_rt_fd = SIM_RT_NO_FD;
+static INSTANCE uint64_t_					gl_uint64_sim_rt_base_ns = 0;				/* host time of virtual cycle 0	*/
+static INSTANCE str_sim_realtime_stats_t_	gl_str_sim_rt_stats;
+
+
+uint8_t_ sim_set_realtime(uint8_t_ bool_enable)
+{
+	uint8_t_ bool_retval = TRUE;
+
+	if(
+			(FALSE != bool_enable) &&
+			(SIM_RT_NO_FD == gl_sint_sim_rt_fd)
+			)
+	{
+		gl_sint_sim_rt_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+		if(SIM_RT_NO_FD != gl_sint_sim_rt_fd)
+		{
+			/* the virtual clock goes on from where it is */
+			gl_uint64_sim_rt_base_ns = sim_realtime_now_ns() - SIM_RT_CYCLES_TO_NS(sim_get_cycles());
+			sim_clear_realtime_stats();
+		}
+		else
+		{
+			bool_retval = FALSE;
+		}
+	}
+	else if(
+			(FALSE == bool_enable) &&
+			(SIM_RT_NO_FD != gl_sint_sim_rt_fd)
+			)
+	{
+		close(gl_sint_sim_rt_fd);
+		gl_sint_sim_rt_fd = SIM_RT_NO_FD;
+	}
+	else
+	{
+		/* already in that mode */
+	}
+
+	return bool_retval;
+}
+
+void sim_get_realtime_stats(str_sim_realtime_stats_t_ * ptr_str_stats)
+{
+	if(NULL_PTR != ptr_str_stats)
+	{
+		*ptr_str_stats = gl_str_sim_rt_stats;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void sim_clear_realtime_stats(void)
+{
+	gl_str_sim_rt_stats.uint32_wakes			= 0;
+	gl_str_sim_rt_stats.uint32_late_min_ns		= 0xFFFFFFFFUL;
+	gl_str_sim_rt_stats.uint32_late_max_ns		= 0;
+	gl_str_sim_rt_stats.uint64_late_total_ns	= 0;
+}
+
+uint8_t_ sim_realtime_active(void)
+{
+	return (SIM_RT_NO_FD != gl_sint_sim_rt_fd) ? TRUE : FALSE;
+}
+
+void sim_realtime_restart(void)
+{
+	const char * ptr_str_value = getenv(SIM_REALTIME_ENV);
+
+	if(
+			(NULL_PTR != ptr_str_value) &&
+			('\0' != ptr_str_value[0]) &&
+			('0' != ptr_str_value[0]) &&
+			(FALSE == sim_set_realtime(TRUE))
+			)
+	{
+		fprintf(stderr, "sim: can't create the real time clock\n");
+		exit(1);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* sim_init restarts the virtual clock at 0 */
+	gl_uint64_sim_rt_base_ns = sim_realtime_now_ns();
+}
+
+uint64_t_ sim_realtime_cycles(void)
+{
+	return SIM_RT_NS_TO_CYCLES(sim_realtime_now_ns() - gl_uint64_sim_rt_base_ns);
+}
+
+void sim_realtime_wait(uint64_t_ uint64_cycle)
+{
+	struct itimerspec str_timer = {0};
+	uint64_t_ uint64_target_ns;
+	uint64_t_ uint64_late_ns;
+	uint64_t_ uint64_expiries;
+	uint8_t_ bool_event = (SIM_RT_NO_EVENT != uint64_cycle) ? TRUE : FALSE;
+
+	uint64_target_ns = (TRUE == bool_event) ?
+					   (gl_uint64_sim_rt_base_ns + SIM_RT_CYCLES_TO_NS(uint64_cycle)) :
+					   (sim_realtime_now_ns() + SIM_RT_MAX_SLEEP_NS);
+
+	str_timer.it_value.tv_sec	= (time_t)(uint64_target_ns / 1000000000ULL);
+	str_timer.it_value.tv_nsec	= (long)(uint64_target_ns % 1000000000ULL);
+
+	/* an event already due fires at once */
+	if(
+			(0 == timerfd_settime(gl_sint_sim_rt_fd, TFD_TIMER_ABSTIME, &str_timer, NULL_PTR)) &&
+			(sizeof(uint64_expiries) == read(gl_sint_sim_rt_fd, &uint64_expiries, sizeof(uint64_expiries))) &&
+			(TRUE == bool_event)
+			)
+	{
+		uint64_late_ns = sim_realtime_now_ns() - uint64_target_ns;
+		uint64_late_ns = (uint64_late_ns > 0xFFFFFFFFULL) ? 0xFFFFFFFFULL : uint64_late_ns;
+
+		gl_str_sim_rt_stats.uint32_wakes++;
+		gl_str_sim_rt_stats.uint64_late_total_ns += uint64_late_ns;
+		if(uint64_late_ns < gl_str_sim_rt_stats.uint32_late_min_ns)
+		{
+			gl_str_sim_rt_stats.uint32_late_min_ns = (uint32_t_)uint64_late_ns;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		if(uint64_late_ns > gl_str_sim_rt_stats.uint32_late_max_ns)
+		{
+			gl_str_sim_rt_stats.uint32_late_max_ns = (uint32_t_)uint64_late_ns;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* interrupted, or no event to be late for */
+	}
+}
+
+static uint64_t_ sim_realtime_now_ns(void)
+{
+	struct timespec str_now;
+
+	clock_gettime(CLOCK_MONOTONIC, &str_now);
+
+	return ((uint64_t_)str_now.tv_sec * 1000000000ULL) + (uint64_t_)str_now.tv_nsec;
+}
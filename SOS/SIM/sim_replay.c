@@ -0,0 +1,406 @@
+/**
+ * @fileName	:	sim_replay.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Record and replay of the external inputs of a simulated run
+ *
+ * The input log is a text file, one event per line, times in CPU cycles:
+ * 			run							a sim_init, the clock restarts at 0
+ * 			exi <int> <cycle>			INT0/1/2 flag raised
+ * 			pin <port> <cycle> <value>	PINx read returned a new value
+ * Lines starting with # are comments. A replayed run raises the same flags
+ * at the same cycles and its PINx reads return the last value logged at or
+ * before the read. The sim_cfg.c stimuli still wake an idle MCU at their
+ * time but leave the pins alone. Same firmware and same log give the same
+ * run, cycle for cycle.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim_interface.h"
+
+#define SIM_LOG_LINE_SIZE				64
+#define SIM_LOG_NO_PORT_VALUE			0xFFFF
+
+typedef enum
+{
+	SIM_LOG_RUN						= 0	,
+	SIM_LOG_EXI							,
+	SIM_LOG_PIN							,
+	SIM_LOG_END							,	/* end of file					*/
+	SIM_LOG_COMMENT						,	/* skipped while loading		*/
+}enu_sim_log_event_t_;
+
+typedef struct
+{
+	enu_sim_log_event_t_	enu_event;
+	uint8_t_				uint8_index;		/* INT number or port			*/
+	uint64_t_				uint64_cycle;
+	uint8_t_				uint8_value;
+}str_sim_log_event_t_;
+
+static uint8_t_		sim_replay_load			(FILE * ptr_file);
+
+static INSTANCE FILE *				gl_ptr_sim_record_file = NULL_PTR;
+static INSTANCE str_sim_log_event_t_ *	gl_ptr_str_sim_replay_log = NULL_PTR;			/* whole log, ends with SIM_LOG_END			*/
+static INSTANCE uint32_t_			gl_uint32_sim_replay_next = 0;					/* next event, not applied yet				*/
+static INSTANCE uint16_t_			gl_arr_uint16_sim_replay_pins[SIM_PORT_TOTAL];	/* SIM_LOG_NO_PORT_VALUE none logged yet	*/
+static INSTANCE uint8_t_				gl_arr_uint8_sim_record_pins[SIM_PORT_TOTAL];
+static INSTANCE uint8_t_				gl_uint8_sim_record_known = 0;					/* ports logged since the run started		*/
+
+
+uint8_t_ sim_record_open(const char * ptr_str_path)
+{
+	uint8_t_ bool_retval = FALSE;
+
+	if(NULL_PTR == gl_ptr_sim_record_file)
+	{
+		gl_ptr_sim_record_file = fopen(ptr_str_path, "w");
+		if(NULL_PTR != gl_ptr_sim_record_file)
+		{
+			fprintf(gl_ptr_sim_record_file, "# SOS simulator input log, times in CPU cycles\n");
+			atexit(sim_record_close);
+			bool_retval = TRUE;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* already recording */
+	}
+
+	return bool_retval;
+}
+
+void sim_record_close(void)
+{
+	if(NULL_PTR != gl_ptr_sim_record_file)
+	{
+		fclose(gl_ptr_sim_record_file);
+		gl_ptr_sim_record_file = NULL_PTR;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+uint8_t_ sim_replay_open(const char * ptr_str_path)
+{
+	FILE * ptr_file;
+	uint8_t_ bool_retval = FALSE;
+
+	if(NULL_PTR == gl_ptr_str_sim_replay_log)
+	{
+		ptr_file = fopen(ptr_str_path, "r");
+		if(NULL_PTR != ptr_file)
+		{
+			bool_retval					= sim_replay_load(ptr_file);
+			gl_uint32_sim_replay_next	= 0;
+			fclose(ptr_file);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* already replaying */
+	}
+
+	return bool_retval;
+}
+
+uint8_t_ sim_replay_active(void)
+{
+	return (NULL_PTR != gl_ptr_str_sim_replay_log) ? TRUE : FALSE;
+}
+
+void sim_replay_restart(void)
+{
+	const char * ptr_str_path;
+
+	ptr_str_path = getenv(SIM_RECORD_ENV);
+	if(
+			(NULL_PTR != ptr_str_path) &&
+			('\0' != ptr_str_path[0])
+			)
+	{
+		(void)sim_record_open(ptr_str_path);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	ptr_str_path = getenv(SIM_REPLAY_ENV);
+	if(
+			(NULL_PTR != ptr_str_path) &&
+			('\0' != ptr_str_path[0]) &&
+			(FALSE == sim_replay_open(ptr_str_path)) &&
+			(FALSE == sim_replay_active())
+			)
+	{
+		fprintf(stderr, "sim: can't replay %s\n", ptr_str_path);
+		exit(1);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(NULL_PTR != gl_ptr_sim_record_file)
+	{
+		fprintf(gl_ptr_sim_record_file, "run\n");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	gl_uint8_sim_record_known = 0;
+
+	/* the events left of the previous run are dropped, the log moves to the next run */
+	if(TRUE == sim_replay_active())
+	{
+		while(
+				(SIM_LOG_RUN != gl_ptr_str_sim_replay_log[gl_uint32_sim_replay_next].enu_event) &&
+				(SIM_LOG_END != gl_ptr_str_sim_replay_log[gl_uint32_sim_replay_next].enu_event)
+				)
+		{
+			gl_uint32_sim_replay_next++;
+		}
+		if(SIM_LOG_RUN == gl_ptr_str_sim_replay_log[gl_uint32_sim_replay_next].enu_event)
+		{
+			gl_uint32_sim_replay_next++;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	for(uint8_t_ uint8_port = 0; uint8_port < SIM_PORT_TOTAL; uint8_port++)
+	{
+		gl_arr_uint16_sim_replay_pins[uint8_port] = SIM_LOG_NO_PORT_VALUE;
+	}
+}
+
+void sim_record_exi(uint8_t_ uint8_int, uint64_t_ uint64_cycle)
+{
+	if(NULL_PTR != gl_ptr_sim_record_file)
+	{
+		fprintf(gl_ptr_sim_record_file, "exi %u %llu\n", uint8_int, (unsigned long long)uint64_cycle);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void sim_record_pin(enu_sim_port_t_ enu_port, uint64_t_ uint64_cycle, uint8_t_ uint8_value)
+{
+	if(
+			(NULL_PTR != gl_ptr_sim_record_file) &&
+			(
+					(0 == (gl_uint8_sim_record_known & (1 << enu_port))) ||
+					(uint8_value != gl_arr_uint8_sim_record_pins[enu_port])
+					)
+			)
+	{
+		gl_uint8_sim_record_known |= (uint8_t_)(1 << enu_port);
+		gl_arr_uint8_sim_record_pins[enu_port] = uint8_value;
+		fprintf(gl_ptr_sim_record_file, "pin %u %llu %u\n", enu_port, (unsigned long long)uint64_cycle, uint8_value);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+uint8_t_ sim_replay_update(uint64_t_ uint64_cycle)
+{
+	str_sim_log_event_t_ * ptr_str_event;
+	uint8_t_ uint8_ints = 0;
+
+	while(TRUE == sim_replay_active())
+	{
+		ptr_str_event = &gl_ptr_str_sim_replay_log[gl_uint32_sim_replay_next];
+
+		if(
+				(
+						(SIM_LOG_EXI == ptr_str_event->enu_event) ||
+						(SIM_LOG_PIN == ptr_str_event->enu_event)
+						) &&
+				(ptr_str_event->uint64_cycle <= uint64_cycle)
+				)
+		{
+			if(SIM_LOG_EXI == ptr_str_event->enu_event)
+			{
+				uint8_ints |= (uint8_t_)(1 << ptr_str_event->uint8_index);
+			}
+			else
+			{
+				gl_arr_uint16_sim_replay_pins[ptr_str_event->uint8_index] = ptr_str_event->uint8_value;
+			}
+			gl_uint32_sim_replay_next++;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	return uint8_ints;
+}
+
+uint8_t_ sim_replay_next_exi(uint64_t_ * ptr_uint64_cycle)
+{
+	uint8_t_ bool_retval = FALSE;
+	uint32_t_ uint32_index = gl_uint32_sim_replay_next;
+
+	/* pin values only matter when read, they never wake the MCU */
+	while(
+			(TRUE == sim_replay_active()) &&
+			(SIM_LOG_PIN == gl_ptr_str_sim_replay_log[uint32_index].enu_event)
+			)
+	{
+		uint32_index++;
+	}
+
+	if(
+			(TRUE == sim_replay_active()) &&
+			(SIM_LOG_EXI == gl_ptr_str_sim_replay_log[uint32_index].enu_event)
+			)
+	{
+		*ptr_uint64_cycle	= gl_ptr_str_sim_replay_log[uint32_index].uint64_cycle;
+		bool_retval			= TRUE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return bool_retval;
+}
+
+uint8_t_ sim_replay_pin(enu_sim_port_t_ enu_port, uint8_t_ * ptr_uint8_value)
+{
+	uint8_t_ bool_retval = FALSE;
+
+	if(SIM_LOG_NO_PORT_VALUE != gl_arr_uint16_sim_replay_pins[enu_port])
+	{
+		*ptr_uint8_value	= (uint8_t_)gl_arr_uint16_sim_replay_pins[enu_port];
+		bool_retval			= TRUE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return bool_retval;
+}
+
+/**
+ * @brief a private function to read the whole log, a malformed line ends
+ *		  the program with an error
+ *
+ * @param ptr_file : log opened for reading
+ *
+ * @return TRUE if the log was loaded
+ */
+static uint8_t_ sim_replay_load(FILE * ptr_file)
+{
+	char arr_char_line[SIM_LOG_LINE_SIZE];
+	str_sim_log_event_t_ str_event;
+	str_sim_log_event_t_ * ptr_str_log = NULL_PTR;
+	uint32_t_ uint32_count = 0;
+	uint32_t_ uint32_size = 0;
+	unsigned int uint_index;
+	unsigned int uint_value;
+	unsigned long long uint64_cycle;
+	uint8_t_ bool_retval = TRUE;
+
+	do
+	{
+		str_event.enu_event = SIM_LOG_END;
+
+		if(NULL_PTR == fgets(arr_char_line, sizeof(arr_char_line), ptr_file))
+		{
+			/* end of the log, the SIM_LOG_END entry is added */
+		}
+		else if(
+				('#' == arr_char_line[0]) ||
+				('\n' == arr_char_line[0])
+				)
+		{
+			str_event.enu_event = SIM_LOG_COMMENT;
+		}
+		else if(0 == strncmp(arr_char_line, "run", 3))
+		{
+			str_event.enu_event = SIM_LOG_RUN;
+		}
+		else if(
+				(2 == sscanf(arr_char_line, "exi %u %llu", &uint_index, &uint64_cycle)) &&
+				(3 > uint_index)
+				)
+		{
+			str_event.enu_event		= SIM_LOG_EXI;
+			str_event.uint8_index	= (uint8_t_)uint_index;
+			str_event.uint64_cycle	= uint64_cycle;
+		}
+		else if(
+				(3 == sscanf(arr_char_line, "pin %u %llu %u", &uint_index, &uint64_cycle, &uint_value)) &&
+				(SIM_PORT_TOTAL > uint_index)
+				)
+		{
+			str_event.enu_event		= SIM_LOG_PIN;
+			str_event.uint8_index	= (uint8_t_)uint_index;
+			str_event.uint64_cycle	= uint64_cycle;
+			str_event.uint8_value	= (uint8_t_)uint_value;
+		}
+		else
+		{
+			fprintf(stderr, "sim: bad input log line: %s", arr_char_line);
+			exit(1);
+		}
+
+		if(SIM_LOG_COMMENT == str_event.enu_event)
+		{
+			continue;		/* not stored */
+		}
+		else if(uint32_count == uint32_size)
+		{
+			uint32_size = (0 != uint32_size) ? (uint32_size * 2) : 256;
+			ptr_str_log = realloc(ptr_str_log, uint32_size * sizeof(str_sim_log_event_t_));
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		if(NULL_PTR != ptr_str_log)
+		{
+			ptr_str_log[uint32_count] = str_event;
+			uint32_count++;
+		}
+		else
+		{
+			bool_retval = FALSE;
+			break;
+		}
+	}
+	while(SIM_LOG_END != str_event.enu_event);
+
+	gl_ptr_str_sim_replay_log = ptr_str_log;
+
+	return bool_retval;
+}
@@ -0,0 +1,247 @@
+/**
+ * @fileName	:	sim_trace.c
+ * @Created		: 	8:15 PM Sunday, October 18, 2026
+ * @Author		: 	Hamsters
+ * @brief		: 	Trace event (Chrome/Perfetto JSON) timeline of a simulated run
+ *
+ * One row (tid) per track: interrupts, scheduler, background and one per
+ * task ID. Time stamps are virtual microseconds, a sim_init during the run
+ * continues the timeline instead of starting it again.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim_interface.h"
+#include "sim_cfg.h"
+
+#define SIM_TRACE_PID					1
+#define SIM_TRACE_MAX_TRACKS			(SIM_TRACE_TRACK_TASKS + 256)
+
+static void			sim_trace_header		(uint16_t_ uint16_track, const char * ptr_str_phase, const char * ptr_str_name);
+static void			sim_trace_name_track	(uint16_t_ uint16_track);
+
+static INSTANCE FILE *		gl_ptr_sim_trace_file = NULL_PTR;
+static INSTANCE uint64_t_	gl_uint64_sim_trace_base = 0;						/* cycles of the runs before the last sim_init	*/
+static INSTANCE uint32_t_	gl_uint32_sim_trace_isr_open = 0;					/* mark of the ISR with an open slice, 0 none	*/
+static INSTANCE uint32_t_	gl_uint32_sim_trace_isr_marks = 0;
+static INSTANCE uint8_t_		gl_arr_uint8_sim_trace_named[SIM_TRACE_MAX_TRACKS];
+
+
+uint8_t_ sim_trace_open(const char * ptr_str_path)
+{
+	uint8_t_ bool_retval = FALSE;
+
+	if(NULL_PTR == gl_ptr_sim_trace_file)
+	{
+		gl_ptr_sim_trace_file = fopen(ptr_str_path, "w");
+		if(NULL_PTR != gl_ptr_sim_trace_file)
+		{
+			fprintf(gl_ptr_sim_trace_file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+					"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"SOS host simulation\"}}",
+					SIM_TRACE_PID);
+			atexit(sim_trace_close);
+			bool_retval = TRUE;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* already tracing */
+	}
+
+	return bool_retval;
+}
+
+void sim_trace_close(void)
+{
+	if(NULL_PTR != gl_ptr_sim_trace_file)
+	{
+		fprintf(gl_ptr_sim_trace_file, "\n]}\n");
+		fclose(gl_ptr_sim_trace_file);
+		gl_ptr_sim_trace_file = NULL_PTR;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void sim_trace_begin(uint16_t_ uint16_track, const char * ptr_str_name)
+{
+	if(NULL_PTR != gl_ptr_sim_trace_file)
+	{
+		sim_trace_header(uint16_track, "B", ptr_str_name);
+		fprintf(gl_ptr_sim_trace_file, "}");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void sim_trace_end(uint16_t_ uint16_track)
+{
+	if(NULL_PTR != gl_ptr_sim_trace_file)
+	{
+		sim_trace_header(uint16_track, "E", NULL_PTR);
+		fprintf(gl_ptr_sim_trace_file, "}");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void sim_trace_instant(uint16_t_ uint16_track, const char * ptr_str_name)
+{
+	if(NULL_PTR != gl_ptr_sim_trace_file)
+	{
+		sim_trace_header(uint16_track, "i", ptr_str_name);
+		fprintf(gl_ptr_sim_trace_file, ",\"s\":\"t\"}");
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void sim_trace_counter(const char * ptr_str_name, uint32_t_ uint32_value)
+{
+	if(NULL_PTR != gl_ptr_sim_trace_file)
+	{
+		sim_trace_header(SIM_TRACE_TRACK_KERNEL, "C", ptr_str_name);
+		fprintf(gl_ptr_sim_trace_file, ",\"args\":{\"value\":%lu}}", (unsigned long)uint32_value);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+void sim_trace_switch(void)
+{
+	/* an ISR that switches context has ended for the CPU, the rest runs later in the other context */
+	if(0 != gl_uint32_sim_trace_isr_open)
+	{
+		gl_uint32_sim_trace_isr_open = 0;
+		sim_trace_end(SIM_TRACE_TRACK_ISR);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+uint32_t_ sim_trace_isr_enter(const char * ptr_str_name)
+{
+	gl_uint32_sim_trace_isr_marks++;
+	gl_uint32_sim_trace_isr_open = gl_uint32_sim_trace_isr_marks;
+	sim_trace_begin(SIM_TRACE_TRACK_ISR, ptr_str_name);
+
+	return gl_uint32_sim_trace_isr_marks;
+}
+
+void sim_trace_isr_exit(uint32_t_ uint32_mark)
+{
+	if(uint32_mark == gl_uint32_sim_trace_isr_open)
+	{
+		gl_uint32_sim_trace_isr_open = 0;
+		sim_trace_end(SIM_TRACE_TRACK_ISR);
+	}
+	else
+	{
+		/* closed by a context switch */
+	}
+}
+
+void sim_trace_restart(uint64_t_ uint64_cycles)
+{
+	const char * ptr_str_path;
+
+	gl_uint64_sim_trace_base		+= uint64_cycles;
+	gl_uint32_sim_trace_isr_open	= 0;
+
+	ptr_str_path = getenv(SIM_TRACE_ENV);
+	if(
+			(NULL_PTR == gl_ptr_sim_trace_file) &&
+			(NULL_PTR != ptr_str_path) &&
+			('\0' != ptr_str_path[0])
+			)
+	{
+		(void)sim_trace_open(ptr_str_path);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to write the common fields of an event, the
+ *		  caller adds its own fields and the closing brace
+ *
+ * @param uint16_track   : row of the event
+ * @param ptr_str_phase  : trace event phase
+ * @param ptr_str_name   : event name, NULL_PTR for none
+ *
+ * @return
+ */
+static void sim_trace_header(uint16_t_ uint16_track, const char * ptr_str_phase, const char * ptr_str_name)
+{
+	uint64_t_ uint64_cycles = gl_uint64_sim_trace_base + sim_get_cycles();
+	uint64_t_ uint64_cycles_per_us = SIM_CPU_FREQ_HZ / 1000000UL;
+
+	sim_trace_name_track(uint16_track);
+
+	fprintf(gl_ptr_sim_trace_file, ",\n{\"ph\":\"%s\",\"pid\":%u,\"tid\":%u,\"ts\":%llu.%03llu",
+			ptr_str_phase, SIM_TRACE_PID, uint16_track,
+			(unsigned long long)(uint64_cycles / uint64_cycles_per_us),
+			(unsigned long long)(((uint64_cycles % uint64_cycles_per_us) * 1000UL) / uint64_cycles_per_us));
+	if(NULL_PTR != ptr_str_name)
+	{
+		fprintf(gl_ptr_sim_trace_file, ",\"name\":\"%s\"", ptr_str_name);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+ * @brief a private function to write the name and order of a row the first
+ *		  time it is used
+ *
+ * @return
+ */
+static void sim_trace_name_track(uint16_t_ uint16_track)
+{
+	if(
+			(SIM_TRACE_MAX_TRACKS > uint16_track) &&
+			(FALSE == gl_arr_uint8_sim_trace_named[uint16_track])
+			)
+	{
+		gl_arr_uint8_sim_trace_named[uint16_track] = TRUE;
+
+		fprintf(gl_ptr_sim_trace_file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"",
+				SIM_TRACE_PID, uint16_track);
+		switch(uint16_track)
+		{
+			case SIM_TRACE_TRACK_ISR:			fprintf(gl_ptr_sim_trace_file, "interrupts");	break;
+			case SIM_TRACE_TRACK_KERNEL:		fprintf(gl_ptr_sim_trace_file, "scheduler");	break;
+			case SIM_TRACE_TRACK_BACKGROUND:	fprintf(gl_ptr_sim_trace_file, "background");	break;
+			default:
+				fprintf(gl_ptr_sim_trace_file, "task %u", uint16_track - SIM_TRACE_TRACK_TASKS);
+				break;
+		}
+		fprintf(gl_ptr_sim_trace_file, "\"}},\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,"
+				"\"args\":{\"sort_index\":%u}}", SIM_TRACE_PID, uint16_track, uint16_track);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
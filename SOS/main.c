@@ -9,10 +9,19 @@
 
 #include "app.h"
 
+#if !defined(__AVR__)
+#include "sim_interface.h"
+#endif
+
 int main(void)
 {
 	enu_app_init_status_t_ enu_init_status;
 	
+#if !defined(__AVR__)
+	/* host build, registers and interrupts are simulated */
+	sim_init();
+#endif
+	
 	enu_init_status = app_init();
 	
 	if(APP_INIT_SUCCESS == enu_init_status)